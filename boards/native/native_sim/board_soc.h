@@ -24,4 +24,11 @@
 
 #define NSOS_IRQ 3
 
+#ifdef CONFIG_PROFILING_PERF_BACKEND_NATIVE_SIM
+/* Frame of the outermost posix_irq_handler() call, from which the code
+ * interrupted by it can be unwound
+ */
+extern void *posix_irq_frame;
+#endif
+
 #endif /* BOARDS_POSIX_NATIVE_SIM_BOARD_SOC_H */
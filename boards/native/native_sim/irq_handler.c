@@ -29,6 +29,10 @@ static struct _isr_list irq_vector_table[N_IRQS] = { { 0 } };
 
 static int currently_running_irq = -1;
 
+#ifdef CONFIG_PROFILING_PERF_BACKEND_NATIVE_SIM
+void *posix_irq_frame;
+#endif
+
 static inline void vector_to_irq(int irq_nbr, int *may_swap)
 {
 	sys_trace_isr_enter();
@@ -86,6 +90,9 @@ void posix_irq_handler(void)
 
 	if (_kernel.cpus[0].nested == 0) {
 		may_swap = 0;
+#ifdef CONFIG_PROFILING_PERF_BACKEND_NATIVE_SIM
+		posix_irq_frame = __builtin_frame_address(0);
+#endif
 	}
 
 	_kernel.cpus[0].nested++;
@@ -104,6 +104,93 @@ int loopback_get_num_dropped_packets(void)
 
 #endif
 
+#ifdef CONFIG_NET_LOOPBACK_SIMULATE_PACKET_DELAY
+#define LOOPBACK_DELAY_QUEUE_SIZE CONFIG_NET_LOOPBACK_SIMULATE_PACKET_DELAY_QUEUE_SIZE
+
+struct loopback_delayed_pkt {
+	struct net_pkt *pkt;
+	int64_t recv_time;
+};
+
+static struct loopback_delayed_pkt loopback_delay_queue[LOOPBACK_DELAY_QUEUE_SIZE];
+static size_t loopback_delay_head;
+static size_t loopback_delay_count;
+static uint32_t loopback_packet_delay;
+static struct k_spinlock loopback_delay_lock;
+
+static void loopback_delay_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(loopback_delay_work, loopback_delay_handler);
+
+int loopback_set_packet_delay(uint32_t delay_ms)
+{
+	loopback_packet_delay = delay_ms;
+	return 0;
+}
+
+/* Receive the packets whose delay is over, they are queued in order */
+static void loopback_delay_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct loopback_delayed_pkt *delayed;
+	k_spinlock_key_t key;
+	struct net_pkt *pkt;
+	int64_t now;
+
+	while (true) {
+		key = k_spin_lock(&loopback_delay_lock);
+
+		if (loopback_delay_count == 0) {
+			k_spin_unlock(&loopback_delay_lock, key);
+			break;
+		}
+
+		delayed = &loopback_delay_queue[loopback_delay_head];
+		now = k_uptime_get();
+
+		if (delayed->recv_time > now) {
+			k_work_reschedule(dwork, K_MSEC(delayed->recv_time - now));
+			k_spin_unlock(&loopback_delay_lock, key);
+			break;
+		}
+
+		pkt = delayed->pkt;
+		loopback_delay_head = (loopback_delay_head + 1) % LOOPBACK_DELAY_QUEUE_SIZE;
+		loopback_delay_count--;
+
+		k_spin_unlock(&loopback_delay_lock, key);
+
+		if (net_recv_data(net_pkt_iface(pkt), pkt) < 0) {
+			LOG_ERR("Data receive failed.");
+			net_pkt_unref(pkt);
+		}
+	}
+}
+
+static void loopback_delay_pkt(struct net_pkt *pkt)
+{
+	k_spinlock_key_t key;
+	size_t tail;
+
+	key = k_spin_lock(&loopback_delay_lock);
+
+	if (loopback_delay_count == LOOPBACK_DELAY_QUEUE_SIZE) {
+		k_spin_unlock(&loopback_delay_lock, key);
+		net_pkt_unref(pkt);
+		return;
+	}
+
+	tail = (loopback_delay_head + loopback_delay_count) % LOOPBACK_DELAY_QUEUE_SIZE;
+	loopback_delay_queue[tail].pkt = pkt;
+	loopback_delay_queue[tail].recv_time = k_uptime_get() + loopback_packet_delay;
+
+	if (loopback_delay_count++ == 0) {
+		k_work_reschedule(&loopback_delay_work, K_MSEC(loopback_packet_delay));
+	}
+
+	k_spin_unlock(&loopback_delay_lock, key);
+}
+#endif
+
 static int loopback_send(const struct device *dev, struct net_pkt *pkt)
 {
 	struct net_pkt *cloned;
@@ -160,6 +247,14 @@ static int loopback_send(const struct device *dev, struct net_pkt *pkt)
 		}
 	}
 
+#ifdef CONFIG_NET_LOOPBACK_SIMULATE_PACKET_DELAY
+	if (loopback_packet_delay > 0) {
+		loopback_delay_pkt(cloned);
+		res = 0;
+		goto out;
+	}
+#endif
+
 	res = net_recv_data(net_pkt_iface(cloned), cloned);
 	if (res < 0) {
 		LOG_ERR("Data receive failed.");
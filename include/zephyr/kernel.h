@@ -2173,6 +2173,34 @@ int k_queue_merge_slist(struct k_queue *queue, sys_slist_t *list);
  */
 __syscall void *k_queue_get(struct k_queue *queue, k_timeout_t timeout);
 
+/**
+ * @brief Get several elements from a queue.
+ *
+ * This routine removes up to @a max data items from the head of @a queue
+ * and stores their addresses in @a out, taking the queue's lock only once
+ * for all of them. The first word of each data item is reserved for the
+ * kernel's use.
+ *
+ * If @a queue is empty, the caller waits for the first data item to be
+ * added. Data items added while it is being woken up are returned along
+ * with it.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue Address of the queue.
+ * @param out Array receiving the addresses of the data items.
+ * @param max Number of entries in @a out.
+ * @param timeout Waiting period to obtain a data item, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of data items stored in @a out; 0 if returned without
+ * waiting, waiting period timed out, or the wait was cancelled.
+ */
+__syscall size_t k_queue_get_batch(struct k_queue *queue, void **out, size_t max,
+				   k_timeout_t timeout);
+
 /**
  * @brief Remove an element from a queue.
  *
@@ -2358,6 +2386,11 @@ struct k_event {
 	uint32_t          events;
 	struct k_spinlock lock;
 
+#ifdef CONFIG_EVENTS_WAIT_Q_PER_BIT
+	/* Threads waiting for a single event, by event bit */
+	_wait_q_t         bit_wait_q[32];
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_event)
 
 #ifdef CONFIG_OBJ_CORE_EVENT
@@ -2366,11 +2399,20 @@ struct k_event {
 
 };
 
+#ifdef CONFIG_EVENTS_WAIT_Q_PER_BIT
+#define Z_EVENT_BIT_WAIT_Q_INIT(i, obj) Z_WAIT_Q_INIT(&(obj).bit_wait_q[i])
+#define Z_EVENT_BIT_WAIT_Q_INITIALIZER(obj) \
+	.bit_wait_q = { LISTIFY(32, Z_EVENT_BIT_WAIT_Q_INIT, (,), obj) },
+#else
+#define Z_EVENT_BIT_WAIT_Q_INITIALIZER(obj)
+#endif
+
 #define Z_EVENT_INITIALIZER(obj) \
 	{ \
 	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
 	.events = 0, \
 	.lock = {}, \
+	Z_EVENT_BIT_WAIT_Q_INITIALIZER(obj) \
 	}
 
 /**
@@ -2401,6 +2443,34 @@ __syscall void k_event_init(struct k_event *event);
  */
 __syscall uint32_t k_event_post(struct k_event *event, uint32_t events);
 
+/**
+ * @brief Wake only the highest priority thread whose wait conditions are met
+ *
+ * Option of k_event_post_options(). Other threads whose wait conditions are
+ * met stay pended, until a later posting of events meeting them.
+ */
+#define K_EVENT_WAKE_ONE BIT(0)
+
+/**
+ * @brief Post one or more events to an event object with options
+ *
+ * This routine posts one or more events to an event object like
+ * @ref k_event_post. With @ref K_EVENT_WAKE_ONE in @a options, only the
+ * highest priority thread whose waiting conditions become met is unpended,
+ * e.g. to hand out work to one of several threads waiting on the same
+ * event.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param event Address of the event object
+ * @param events Set of events to post to @a event
+ * @param options Posting options, 0 or @ref K_EVENT_WAKE_ONE
+ *
+ * @retval Previous value of the events in @a event
+ */
+__syscall uint32_t k_event_post_options(struct k_event *event, uint32_t events,
+					uint32_t options);
+
 /**
  * @brief Set the events in an event object
  *
@@ -2707,6 +2777,34 @@ struct k_fifo {
 	fg_ret; \
 	})
 
+/**
+ * @brief Get several elements from a FIFO queue.
+ *
+ * This routine removes up to @a max data items from @a fifo in a "first in,
+ * first out" manner under a single acquisition of the queue's lock. The
+ * first word of each data item is reserved for the kernel's use.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param fifo Address of the FIFO queue.
+ * @param out Array receiving the addresses of the data items.
+ * @param max Number of entries in @a out.
+ * @param timeout Waiting period to obtain a data item,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of data items stored in @a out; 0 if returned without
+ * waiting, or waiting period timed out.
+ */
+#define k_fifo_get_batch(fifo, out, max, timeout) \
+	({ \
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_fifo, get_batch, fifo, timeout); \
+	size_t fgb_ret = k_queue_get_batch(&(fifo)->_queue, out, max, timeout); \
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_fifo, get_batch, fifo, timeout, fgb_ret); \
+	fgb_ret; \
+	})
+
 /**
  * @brief Query a FIFO queue to see if it has data available.
  *
@@ -2890,6 +2988,34 @@ struct k_lifo {
 	lg_ret; \
 	})
 
+/**
+ * @brief Get several elements from a LIFO queue.
+ *
+ * This routine removes up to @a max data items from @a lifo in a "last in,
+ * first out" manner under a single acquisition of the queue's lock. The
+ * first word of each data item is reserved for the kernel's use.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param lifo Address of the LIFO queue.
+ * @param out Array receiving the addresses of the data items.
+ * @param max Number of entries in @a out.
+ * @param timeout Waiting period to obtain a data item,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of data items stored in @a out; 0 if returned without
+ * waiting, or waiting period timed out.
+ */
+#define k_lifo_get_batch(lifo, out, max, timeout) \
+	({ \
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_lifo, get_batch, lifo, timeout); \
+	size_t lgb_ret = k_queue_get_batch(&(lifo)->_queue, out, max, timeout); \
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_lifo, get_batch, lifo, timeout, lgb_ret); \
+	lgb_ret; \
+	})
+
 /**
  * @brief Statically define and initialize a LIFO queue.
  *
@@ -3050,6 +3176,7 @@ __syscall int k_stack_pop(struct k_stack *stack, stack_data_t *data,
 
 struct k_work;
 struct k_work_q;
+struct k_work_q_worker;
 struct k_work_queue_config;
 extern struct k_work_q k_sys_work_q;
 
@@ -3260,6 +3387,198 @@ __syscall int k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
  * @}
  */
 
+/**
+ * @defgroup rwlock_apis Reader-Writer Lock APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Reader-writer lock statistics
+ */
+struct k_rwlock_stats {
+	/** Number of times the lock was taken for reading */
+	uint32_t read_locks;
+	/** Number of times the lock was taken for writing */
+	uint32_t write_locks;
+	/** Number of times a reader had to wait for the lock */
+	uint32_t read_waits;
+	/** Number of times a writer had to wait for the lock */
+	uint32_t write_waits;
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#ifdef CONFIG_RWLOCK_PERCPU_READERS
+struct z_rwlock_cpu {
+	/* Readers that took the lock on this CPU, minus readers that
+	 * released it on this CPU, only the sum over all CPUs counts.
+	 * Released readers are only taken off a CPU that counts some.
+	 */
+	atomic_t readers;
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	uint32_t read_locks;
+#endif
+};
+#endif /* CONFIG_RWLOCK_PERCPU_READERS */
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * Reader-writer lock structure
+ * @ingroup rwlock_apis
+ */
+struct k_rwlock {
+	struct k_spinlock lock;
+	/** Threads waiting to read */
+	_wait_q_t read_wait_q;
+	/** Threads waiting to write */
+	_wait_q_t write_wait_q;
+	/** Thread holding the lock for writing, if any */
+	struct k_thread *writer;
+
+#ifdef CONFIG_RWLOCK_PERCPU_READERS
+	/* Set while a writer holds or waits for the lock */
+	atomic_t write_pending;
+	struct z_rwlock_cpu cpu[CONFIG_MP_MAX_NUM_CPUS];
+#else
+	/** Number of threads holding the lock for reading */
+	uint32_t readers;
+#endif
+
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	struct k_rwlock_stats stats;
+#endif
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+	struct k_obj_core obj_core;
+#endif
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_RWLOCK_INITIALIZER(obj) \
+	{ \
+	.read_wait_q = Z_WAIT_Q_INIT(&(obj).read_wait_q), \
+	.write_wait_q = Z_WAIT_Q_INIT(&(obj).write_wait_q), \
+	.writer = NULL, \
+	}
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Statically define and initialize a reader-writer lock.
+ *
+ * The lock can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct k_rwlock <name>; @endcode
+ *
+ * @param name Name of the reader-writer lock.
+ */
+#define K_RWLOCK_DEFINE(name) \
+	STRUCT_SECTION_ITERABLE(k_rwlock, name) = \
+		Z_RWLOCK_INITIALIZER(name)
+
+/**
+ * @brief Initialize a reader-writer lock.
+ *
+ * This routine initializes a reader-writer lock object, prior to its first
+ * use. Upon completion, the lock is neither held for reading nor for
+ * writing.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Reader-writer lock object created
+ */
+__syscall int k_rwlock_init(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader-writer lock for reading.
+ *
+ * This routine takes @a rwlock for reading, together with any number of
+ * other readers. If the lock is held for writing, or a writer of at least
+ * the calling thread's priority waits for it, the calling thread waits
+ * until the lock is available or the timeout expires.
+ *
+ * A thread must not take the lock for reading again while a writer may be
+ * waiting for it, as that writer blocks the second read lock.
+ *
+ * @funcprops \isr_ok
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param timeout Waiting period to take the lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Lock taken for reading.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EDEADLK The calling thread holds the lock for writing.
+ */
+__syscall int k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a reader-writer lock held for reading.
+ *
+ * This routine releases a read lock taken with k_rwlock_read_lock(). When
+ * the last reader releases the lock, the highest priority waiting writer
+ * takes it.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Lock released.
+ * @retval -EINVAL The lock is not held for reading.
+ */
+__syscall int k_rwlock_read_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader-writer lock for writing.
+ *
+ * This routine takes @a rwlock for writing, excluding all other readers and
+ * writers. If the lock is held, the calling thread waits until it is
+ * released or the timeout expires. Readers that ask for the lock while a
+ * writer waits are held back unless they have a higher priority than that
+ * writer, so writers are not starved by a continuous flow of readers.
+ *
+ * Unlike mutexes, reader-writer locks are neither recursive nor subject to
+ * priority inheritance.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param timeout Waiting period to take the lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Lock taken for writing.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EDEADLK The calling thread already holds the lock for writing.
+ */
+__syscall int k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a reader-writer lock held for writing.
+ *
+ * This routine releases the write lock held by the calling thread. The
+ * lock then goes to the highest priority waiting writer, unless waiting
+ * readers have a higher priority, in which case those readers take it.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Lock released.
+ * @retval -EPERM The calling thread does not hold the lock for writing.
+ */
+__syscall int k_rwlock_write_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @}
+ */
+
 /**
  * @defgroup semaphore_apis Semaphore APIs
  * @ingroup kernel_apis
@@ -3635,6 +3954,49 @@ void k_work_queue_start(struct k_work_q *queue,
 			k_thread_stack_t *stack, size_t stack_size,
 			int prio, const struct k_work_queue_config *cfg);
 
+/** @brief Initialize a work queue serviced by a pool of threads.
+ *
+ * This works like k_work_queue_start(), except that @p num_workers threads
+ * take work items from the queue, so that up to that many items run at the
+ * same time. A work item still never runs concurrently with itself, and
+ * flushing and cancelling work behave as for a queue with a single thread.
+ *
+ * Items submitted from a worker thread are queued on that worker, and an
+ * idle worker takes over items queued on a busy one.
+ *
+ * Work items of a pool are not monitored with
+ * k_work_queue_config::work_timeout_ms, and k_work_queue_thread_get()
+ * returns the first worker thread. The function should not be re-invoked on
+ * a queue.
+ *
+ * @note @kconfig{CONFIG_WORKQUEUE_POOL} must be selected for this function
+ * to be available.
+ *
+ * @param queue pointer to the queue structure. It must be initialized
+ *        in zeroed/bss memory or with @ref k_work_queue_init before
+ *        use.
+ *
+ * @param workers array of @p num_workers worker structures.
+ *
+ * @param num_workers number of worker threads.
+ *
+ * @param stacks array of @p num_workers stacks defined with
+ *        K_KERNEL_STACK_ARRAY_DEFINE().
+ *
+ * @param stack_size size of each stack, as passed to
+ *        K_KERNEL_STACK_ARRAY_DEFINE().
+ *
+ * @param prio initial priority of the worker threads
+ *
+ * @param cfg optional additional configuration parameters.  Pass @c
+ * NULL if not required, to use the defaults documented in
+ * k_work_queue_config.
+ */
+void k_work_queue_start_pool(struct k_work_q *queue,
+			     struct k_work_q_worker *workers, size_t num_workers,
+			     k_thread_stack_t *stacks, size_t stack_size,
+			     int prio, const struct k_work_queue_config *cfg);
+
 /** @brief Run work queue using calling thread
  *
  * This will run the work queue forever unless stopped by @ref k_work_queue_stop.
@@ -4229,6 +4591,39 @@ struct k_work_queue_config {
 	 * an error will be logged if CONFIG_LOG is enabled.
 	 */
 	uint32_t work_timeout_ms;
+
+	/** Control whether the threads of a work queue pool are pinned to
+	 * CPUs.
+	 *
+	 * If true, and CONFIG_SCHED_CPU_MASK is enabled, the worker threads
+	 * started by k_work_queue_start_pool() are pinned to the CPUs in
+	 * turn. Ignored by other work queues.
+	 */
+	bool pin_workers;
+};
+
+/** @brief A thread servicing a work queue pool.
+ *
+ * See k_work_queue_start_pool().
+ */
+struct k_work_q_worker {
+	/* The worker thread. */
+	struct k_thread thread;
+
+	/* The queue the worker belongs to. */
+	struct k_work_q *queue;
+
+	/* All the following fields must be accessed only while the
+	 * work module spinlock is held.
+	 */
+
+	/* Items queued on this worker. The worker takes them from the
+	 * head, idle workers of the same queue may take them over.
+	 */
+	sys_slist_t deque;
+
+	/* The item being run by the worker, if any. */
+	struct k_work *current;
 };
 
 /** @brief A structure used to hold work until it can be processed. */
@@ -4262,6 +4657,15 @@ struct k_work_q {
 	struct k_work *work;
 	k_timeout_t work_timeout;
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
+
+#if defined(CONFIG_WORKQUEUE_POOL)
+	/* The threads of a pool, NULL if the queue has a single thread. */
+	struct k_work_q_worker *workers;
+
+	/* Number of workers, and number of them running an item. */
+	uint16_t num_workers;
+	uint16_t num_busy;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4656,6 +5060,14 @@ struct k_msgq {
 	char *write_ptr;
 	/** Number of used messages */
 	uint32_t used_msgs;
+	/** Slot reserved by k_msgq_alloc_put(), if any */
+	char *reserved_ptr;
+	/** Slot claimed by k_msgq_claim(), if any */
+	char *claimed_ptr;
+	/** Number of slots neither free nor holding a message */
+	uint32_t held_msgs;
+	/** Number of messages sent behind the reserved slot */
+	uint32_t pending_msgs;
 
 	Z_DECL_POLL_EVENT
 
@@ -4684,6 +5096,10 @@ struct k_msgq {
 	.read_ptr = q_buffer, \
 	.write_ptr = q_buffer, \
 	.used_msgs = 0, \
+	.reserved_ptr = NULL, \
+	.claimed_ptr = NULL, \
+	.held_msgs = 0, \
+	.pending_msgs = 0, \
 	Z_POLL_EVENT_OBJ_INIT(obj) \
 	.flags = 0, \
 	}
@@ -4793,6 +5209,10 @@ int k_msgq_cleanup(struct k_msgq *msgq);
  * pointer is not retained, so the message content will not be modified
  * by this function.
  *
+ * @note While a slot reserved with k_msgq_alloc_put() is not committed, the
+ * message is queued behind it and only becomes available to readers along
+ * with it.
+ *
  * @funcprops \isr_ok
  *
  * @param msgq Address of the message queue.
@@ -4862,6 +5282,100 @@ __syscall int k_msgq_peek(struct k_msgq *msgq, void *data);
  */
 __syscall int k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx);
 
+/**
+ * @brief Reserve a slot in a message queue for in-place writing.
+ *
+ * This routine reserves the next free slot of message queue @a msgq and
+ * returns its address in @a data, so the message can be written into the
+ * ring buffer directly instead of being copied by k_msgq_put(). The slot
+ * becomes visible to readers when it is passed to k_msgq_commit().
+ *
+ * Only one slot can be reserved at a time, further reservations wait until
+ * it is committed. k_msgq_put() can still send messages meanwhile, into the
+ * slots following the reserved one, but readers only see them once the
+ * reserved slot is committed, so that messages are received in order.
+ *
+ * @note A user mode thread must have write access to the ring buffer of
+ * @a msgq to reserve slots in it.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of a pointer set to the reserved slot.
+ * @param timeout Waiting period to reserve a slot, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Slot reserved.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_alloc_put(struct k_msgq *msgq, void **data, k_timeout_t timeout);
+
+/**
+ * @brief Commit a slot reserved with k_msgq_alloc_put().
+ *
+ * This routine appends the message written into the reserved slot to
+ * message queue @a msgq, waking up a waiting reader if there is one.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of the reserved slot.
+ *
+ * @retval 0 Message sent.
+ * @retval -EINVAL @a data is not the slot reserved in @a msgq.
+ */
+__syscall int k_msgq_commit(struct k_msgq *msgq, void *data);
+
+/**
+ * @brief Claim the first message of a message queue for in-place reading.
+ *
+ * This routine removes the first message from message queue @a msgq like
+ * k_msgq_get(), but instead of copying it out returns the address of its
+ * slot in @a data. The slot is not reused until it is released with
+ * k_msgq_finish().
+ *
+ * Only one message can be claimed at a time, further claims wait until it
+ * is finished. k_msgq_get() can still receive the following messages
+ * meanwhile, but the slots they free are only reused for new messages once
+ * the claimed message is finished.
+ *
+ * @note A user mode thread must have read access to the ring buffer of
+ * @a msgq to claim messages from it.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of a pointer set to the claimed message.
+ * @param timeout Waiting period to claim a message, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message claimed.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_claim(struct k_msgq *msgq, void **data, k_timeout_t timeout);
+
+/**
+ * @brief Release a message claimed with k_msgq_claim().
+ *
+ * This routine returns the slot of the claimed message to message queue
+ * @a msgq, waking up waiting writers if there are any.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of the claimed message.
+ *
+ * @retval 0 Message released.
+ * @retval -EINVAL @a data is not the message claimed from @a msgq.
+ */
+__syscall int k_msgq_finish(struct k_msgq *msgq, void *data);
+
 /**
  * @brief Purge a message queue.
  *
@@ -4869,6 +5383,9 @@ __syscall int k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx);
  * buffer. Any threads that are blocked waiting to send a message to the
  * message queue are unblocked and see an -ENOMSG error code.
  *
+ * A reserved slot or a claimed message is not affected, they still have
+ * to be committed or finished.
+ *
  * @param msgq Address of the message queue.
  */
 __syscall void k_msgq_purge(struct k_msgq *msgq);
@@ -4899,7 +5416,7 @@ __syscall void  k_msgq_get_attrs(struct k_msgq *msgq,
 
 static inline uint32_t z_impl_k_msgq_num_free_get(struct k_msgq *msgq)
 {
-	return msgq->max_msgs - msgq->used_msgs;
+	return msgq->max_msgs - msgq->used_msgs - msgq->held_msgs;
 }
 
 /**
@@ -5296,10 +5813,24 @@ __deprecated __syscall void k_pipe_buffer_flush(struct k_pipe *pipe);
 enum pipe_flags {
 	PIPE_FLAG_OPEN = BIT(0),
 	PIPE_FLAG_RESET = BIT(1),
+	PIPE_FLAG_WRITE_CANCELED = BIT(2),
+	PIPE_FLAG_READ_CANCELED = BIT(3),
+};
+
+/**
+ * @brief A buffer passed to k_pipe_writev() or k_pipe_readv().
+ */
+struct k_pipe_iovec {
+	/** Address of the buffer */
+	void *base;
+	/** Size of the buffer (in bytes) */
+	size_t len;
 };
 
 struct k_pipe {
 	size_t waiting;
+	size_t write_claimed;
+	size_t read_claimed;
 	struct ring_buf buf;
 	struct k_spinlock lock;
 	_wait_q_t data;
@@ -5323,6 +5854,8 @@ struct k_pipe {
 	.space = Z_WAIT_Q_INIT(&obj.space),			\
 	.flags = PIPE_FLAG_OPEN,				\
 	.waiting = 0,						\
+	.write_claimed = 0,					\
+	.read_claimed = 0,					\
 	Z_POLL_EVENT_OBJ_INIT(obj)				\
 }
 /**
@@ -5386,12 +5919,146 @@ __syscall int k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len,
 __syscall int k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len,
 			  k_timeout_t timeout);
 
+/**
+ * @brief Write data from several buffers to a pipe
+ *
+ * This routine works like k_pipe_write(), but writes the contents of the
+ * @a iovcnt buffers described by @a iov, one after the other.
+ *
+ * @param pipe Address of the pipe.
+ * @param iov Array of buffers to write.
+ * @param iovcnt Number of buffers in @a iov.
+ * @param timeout Waiting period to wait for the data to be written.
+ *
+ * @retval number of bytes written on success
+ * @retval -EAGAIN if no data could be written before the timeout expired
+ * @retval -ECANCELED if the write was interrupted by k_pipe_reset(..)
+ * @retval -EPIPE if the pipe was closed
+ * @retval -ENOMEM if a user mode caller's @a iov could not be copied
+ */
+__syscall int k_pipe_writev(struct k_pipe *pipe, const struct k_pipe_iovec *iov,
+			    size_t iovcnt, k_timeout_t timeout);
+
+/**
+ * @brief Read data from a pipe into several buffers
+ *
+ * This routine works like k_pipe_read(), but fills the @a iovcnt buffers
+ * described by @a iov, one after the other.
+ *
+ * @param pipe Address of the pipe.
+ * @param iov Array of buffers to fill.
+ * @param iovcnt Number of buffers in @a iov.
+ * @param timeout Waiting period to wait for the data to be read.
+ *
+ * @retval number of bytes read on success
+ * @retval -EAGAIN if no data could be read before the timeout expired
+ * @retval -ECANCELED if the read was interrupted by k_pipe_reset(..)
+ * @retval -EPIPE if the pipe was closed
+ * @retval -ENOMEM if a user mode caller's @a iov could not be copied
+ */
+__syscall int k_pipe_readv(struct k_pipe *pipe, const struct k_pipe_iovec *iov,
+			   size_t iovcnt, k_timeout_t timeout);
+
+/**
+ * @brief Claim space in a pipe for writing data in place
+ *
+ * This routine returns in @a data the address of up to @a len bytes of free
+ * space in the ring buffer of @a pipe, so the data can be written there
+ * directly instead of being copied by k_pipe_write(). The claimed space is
+ * contiguous, so it can be smaller than @a len when the ring buffer wraps.
+ * The data becomes readable when it is passed to k_pipe_write_commit().
+ *
+ * If the pipe is full, the routine will block until space is available or
+ * the timeout expires. Only one region can be claimed for writing at a time:
+ * until it is committed, other writers wait as if the pipe were full.
+ *
+ * @note A user mode thread must have write access to the ring buffer of
+ * @a pipe to claim space in it.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of a pointer set to the claimed space.
+ * @param len Requested size (in bytes).
+ * @param timeout Waiting period to wait for space in the pipe.
+ *
+ * @retval number of bytes claimed on success
+ * @retval -EAGAIN if no space could be claimed before the timeout expired
+ * @retval -ECANCELED if the claim was interrupted by k_pipe_reset(..)
+ * @retval -EPIPE if the pipe was closed
+ * @retval -ENOTSUP if the pipe has no ring buffer
+ */
+__syscall int k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+				 k_timeout_t timeout);
+
+/**
+ * @brief Commit data written in place to a pipe
+ *
+ * This routine makes the first @a len bytes of the space claimed with
+ * k_pipe_write_claim() readable and returns the rest to the pipe.
+ *
+ * @param pipe Address of the pipe.
+ * @param len Number of bytes written (in bytes).
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if no space is claimed or @a len exceeds it
+ * @retval -ECANCELED if the pipe was reset since the claim, the data is dropped
+ * @retval -EPIPE if the pipe was closed, the data is dropped
+ */
+__syscall int k_pipe_write_commit(struct k_pipe *pipe, size_t len);
+
+/**
+ * @brief Claim data in a pipe for reading it in place
+ *
+ * This routine returns in @a data the address of up to @a len bytes of data
+ * in the ring buffer of @a pipe, so the data can be processed there directly
+ * instead of being copied by k_pipe_read(). The claimed data is contiguous,
+ * so it can be less than @a len when the ring buffer wraps. Its space is
+ * reused once it is released with k_pipe_read_finish().
+ *
+ * If the pipe is empty, the routine will block until data is available or
+ * the timeout expires. Only one region can be claimed for reading at a time:
+ * until it is finished, other readers wait as if the pipe were empty.
+ *
+ * @note A user mode thread must have read access to the ring buffer of
+ * @a pipe to claim data in it.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of a pointer set to the claimed data.
+ * @param len Requested size (in bytes).
+ * @param timeout Waiting period to wait for data in the pipe.
+ *
+ * @retval number of bytes claimed on success
+ * @retval -EAGAIN if no data could be claimed before the timeout expired
+ * @retval -ECANCELED if the claim was interrupted by k_pipe_reset(..)
+ * @retval -EPIPE if the pipe was closed and is empty
+ * @retval -ENOTSUP if the pipe has no ring buffer
+ */
+__syscall int k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+				k_timeout_t timeout);
+
+/**
+ * @brief Release data read in place from a pipe
+ *
+ * This routine frees the first @a len bytes of the data claimed with
+ * k_pipe_read_claim(). The rest is left in the pipe to be read again.
+ *
+ * @param pipe Address of the pipe.
+ * @param len Number of bytes read (in bytes).
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if no data is claimed or @a len exceeds it
+ * @retval -ECANCELED if the pipe was reset since the claim, all of the data
+ *         is freed
+ */
+__syscall int k_pipe_read_finish(struct k_pipe *pipe, size_t len);
+
 /**
  * @brief Reset a pipe
  * This routine resets the pipe, discarding any unread data and unblocking any threads waiting to
  * write or read, causing the waiting threads to return with -ECANCELED. Calling k_pipe_read(..) or
  * k_pipe_write(..) when the pipe is resetting but not yet reset will return -ECANCELED.
  * The pipe is left open after a reset and can be used as normal.
+ * Regions claimed with k_pipe_write_claim(..) or k_pipe_read_claim(..) stay reserved until they
+ * are committed or finished, which then returns -ECANCELED.
  *
  * @param pipe Address of the pipe.
  */
@@ -5415,11 +6082,27 @@ __syscall void k_pipe_close(struct k_pipe *pipe);
 struct k_mem_slab_info {
 	uint32_t num_blocks;
 	size_t   block_size;
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	/* Updated outside of the slab lock by the per-CPU caches */
+	atomic_t num_used;
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_t max_used;
+#endif
+#else
 	uint32_t num_used;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	uint32_t max_used;
 #endif
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+};
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+struct z_mem_slab_cache {
+	struct k_spinlock lock;
+	uint8_t count;
+	char *blocks[CONFIG_MEM_SLAB_CPU_CACHE_DEPTH];
 };
+#endif
 
 struct k_mem_slab {
 	_wait_q_t wait_q;
@@ -5428,6 +6111,12 @@ struct k_mem_slab {
 	char *free_list;
 	struct k_mem_slab_info info;
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	/* Threads that may block in k_mem_slab_alloc() */
+	atomic_t waiters;
+	struct z_mem_slab_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
@@ -5635,7 +6324,11 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	return (uint32_t)atomic_get(&slab->info.num_used);
+#else
 	return slab->info.num_used;
+#endif
 }
 
 /**
@@ -5650,7 +6343,9 @@ static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
 {
-#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+#if defined(CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION) && defined(CONFIG_MEM_SLAB_CPU_CACHE)
+	return (uint32_t)atomic_get(&slab->info.max_used);
+#elif defined(CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION)
 	return slab->info.max_used;
 #else
 	ARG_UNUSED(slab);
@@ -5670,7 +6365,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -5713,6 +6408,10 @@ struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_SYS_HEAP_MAGAZINES
+	/* Allocators that may block, see k_heap_free() */
+	atomic_t waiters;
+#endif
 };
 
 /**
@@ -5844,7 +6543,12 @@ void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 /* Hand-calculated minimum heap sizes needed to return a successful
  * 1-byte allocation.  See details in lib/os/heap.[ch]
  */
+#ifdef CONFIG_SYS_HEAP_MAGAZINES
+/* The magazines pointer in struct z_heap takes one more chunk on 64-bit */
+#define Z_HEAP_MIN_SIZE ((sizeof(void *) > 4) ? 64 : 44)
+#else
 #define Z_HEAP_MIN_SIZE ((sizeof(void *) > 4) ? 56 : 44)
+#endif
 
 /**
  * @brief Define a static k_heap in the specified linker section
@@ -6205,6 +6909,26 @@ struct k_poll_event {
 	}, \
 	}
 
+/**
+ * @brief Poll Set
+ *
+ * A set of poll events that stay registered on their objects from one
+ * k_poll_set_wait() to the next.
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t signaled;
+
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t ready;
+
+	/** PRIVATE - DO NOT TOUCH */
+	_wait_q_t wait_q;
+};
+
 /**
  * @brief Initialize one struct k_poll_event instance
  *
@@ -6325,6 +7049,84 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+/**
+ * @brief Initialize a poll set.
+ *
+ * A poll set is the persistent counterpart of an event array passed to
+ * k_poll(): events are registered on their objects once, when added to
+ * the set, and a wait on the set only looks at the events whose objects
+ * signaled them. The cost of a wait thus depends on the number of ready
+ * events rather than on the number of events in the set.
+ *
+ * @param set The poll set to initialize.
+ */
+void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add a poll event to a poll set.
+ *
+ * The event is initialized as for k_poll() and stays owned by the set
+ * until removed with k_poll_set_remove(): it must not be modified,
+ * passed to k_poll() or added to another set in the meantime. An event
+ * whose condition is already met is reported by the next wait.
+ *
+ * @param set A poll set.
+ * @param event The event to add.
+ */
+void k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Add a poll event to a poll set, waiting for its next signal.
+ *
+ * Like k_poll_set_add(), except that the condition of the event is not
+ * checked: the event is only reported once its object signals it again,
+ * e.g. when more data is put in a FIFO. This gives edge-triggered
+ * notifications when the event is removed and armed again after each
+ * report.
+ *
+ * @param set A poll set.
+ * @param event The event to add.
+ */
+void k_poll_set_arm(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove a poll event from a poll set.
+ *
+ * @param set A poll set.
+ * @param event An event previously added to @a set.
+ *
+ * @retval 0 The event was removed.
+ * @retval -EINVAL The event is not in @a set.
+ */
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to be ready.
+ *
+ * Stores in @a events pointers to up to @a num_events events of @a set
+ * that are ready, and sets the state field of each of them. Events are
+ * level-triggered: an event is returned by every wait for as long as its
+ * condition is met, and goes back to waiting on its object once it is
+ * not. An event cancelled by its object, e.g. with k_queue_cancel_wait(),
+ * is returned once with K_POLL_STATE_CANCELLED set.
+ *
+ * Unlike with k_poll(), the state field of the events does not need to be
+ * reset by the caller. When @a events has room for all the events of the
+ * set, the events not returned are left in the K_POLL_STATE_NOT_READY
+ * state, so that the set can also be scanned as a k_poll() array would.
+ *
+ * @param set A poll set.
+ * @param events Array receiving the ready events.
+ * @param num_events Size of @a events, at least 1.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of events stored in @a events.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **events,
+		    int num_events, k_timeout_t timeout);
+
 /** @} */
 
 /**
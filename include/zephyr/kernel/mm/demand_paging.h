@@ -77,6 +77,25 @@ struct k_mem_paging_histogram_t {
 #endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
 };
 
+/**
+ * Compressed RAM backing store statistics.
+ */
+struct k_mem_paging_backing_store_compressed_stats_t {
+#if defined(CONFIG_DEMAND_PAGING_STATS) || defined(__DOXYGEN__)
+	/** Number of data pages currently stored */
+	unsigned long	pages;
+
+	/** Number of stored data pages filled with a single repeated word */
+	unsigned long	same_filled;
+
+	/** Number of stored data pages which did not compress */
+	unsigned long	incompressible;
+
+	/** Number of pool bytes holding the stored data pages */
+	size_t		stored_bytes;
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -450,6 +469,20 @@ void k_mem_paging_backing_store_page_finalize(struct k_mem_page_frame *pf,
  */
 void k_mem_paging_backing_store_init(void);
 
+/**
+ * Get the compressed RAM backing store statistics
+ *
+ * This populates the statistics struct being passed in as argument.
+ * The compression ratio is the number of stored pages times the page
+ * size, divided by the number of stored bytes.
+ *
+ * Only available with CONFIG_BACKING_STORE_RAM_COMPRESSED.
+ *
+ * @param[in,out] stats Statistics struct to be filled.
+ */
+void k_mem_paging_backing_store_compressed_stats_get(
+	struct k_mem_paging_backing_store_compressed_stats_t *stats);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -115,9 +115,8 @@ struct _priq_rb {
 /* Traditional/textbook "multi-queue" structure.  Separate lists for a
  * small number (max 32 here) of fixed priorities.  This corresponds
  * to the original Zephyr scheduler.  RAM requirements are
- * comparatively high, but performance is very fast.  Won't work with
- * features like deadline scheduling which need large priority spaces
- * to represent their requirements.
+ * comparatively high, but performance is very fast.  With deadline
+ * scheduling, each list is kept sorted by deadline.
  */
 struct _priq_mq {
 	sys_dlist_t queues[K_NUM_THREAD_PRIO];
@@ -125,6 +124,14 @@ struct _priq_mq {
 #ifndef CONFIG_SMP
 	unsigned int cached_queue_index;
 #endif
+#ifdef CONFIG_SCHED_CPU_MASK
+	/* Number of queued threads of each priority allowed to run on
+	 * each CPU, and per CPU the bitmap of priorities where that is
+	 * non-zero.
+	 */
+	uint16_t cpu_count[K_NUM_THREAD_PRIO][CONFIG_MP_MAX_NUM_CPUS];
+	unsigned long cpu_bitmask[CONFIG_MP_MAX_NUM_CPUS][PRIQ_BITMAP_SIZE];
+#endif /* CONFIG_SCHED_CPU_MASK */
 };
 
 struct _ready_q {
@@ -300,7 +307,10 @@ struct _timeout {
 	sys_dnode_t node;
 	_timeout_func_t fn;
 #ifdef CONFIG_TIMEOUT_64BIT
-	/* Can't use k_ticks_t for header dependency reasons */
+	/* Can't use k_ticks_t for header dependency reasons.  Holds the
+	 * absolute expiry tick with CONFIG_TIMEOUT_QUEUE_WHEEL, the delta to
+	 * the previous timeout in the queue otherwise.
+	 */
 	int64_t dticks;
 #else
 	int32_t dticks;
@@ -401,6 +401,10 @@ __net_socket struct net_context {
 #if defined(CONFIG_NET_CONTEXT_TIMESTAMPING)
 		/** Enable RX, TX or both timestamps of packets send through sockets. */
 		uint8_t timestamping;
+#endif
+#if defined(CONFIG_NET_CONTEXT_UDP_SEGMENT)
+		/** Size of the datagrams UDP sends are split in, 0 if they are not */
+		uint16_t udp_segment;
 #endif
 	} options;
 
@@ -1399,6 +1403,7 @@ enum net_context_option {
 	NET_OPT_LOCAL_PORT_RANGE  = 21, /**< Clamp local port range */
 	NET_OPT_IPV6_MCAST_LOOP	  = 22, /**< IPV6 multicast loop */
 	NET_OPT_IPV4_MCAST_LOOP	  = 23, /**< IPV4 multicast loop */
+	NET_OPT_UDP_SEGMENT       = 24, /**< UDP segmentation offload */
 };
 
 /**
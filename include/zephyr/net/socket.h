@@ -77,6 +77,8 @@ extern "C" {
 #define ZSOCK_MSG_DONTWAIT 0x40
 /** zsock_recv: block until the full amount of data can be returned */
 #define ZSOCK_MSG_WAITALL 0x100
+/** zsock_recvmmsg: only block until the first message has been received */
+#define ZSOCK_MSG_WAITFORONE 0x10000
 /** @} */
 
 /**
@@ -511,6 +513,32 @@ static inline ssize_t zsock_send(int sock, const void *buf, size_t len,
 __syscall ssize_t zsock_sendmsg(int sock, const struct msghdr *msg,
 				int flags);
 
+/**
+ * @brief Send several messages on a socket
+ *
+ * @details
+ * Sends the messages of @a msgvec in order, as zsock_sendmsg() would, and
+ * sets the @c msg_len of each message sent to its number of bytes. The
+ * socket is looked up and locked once for the whole batch, so this is
+ * cheaper than sending the messages one by one, especially from user mode.
+ *
+ * Sending stops at the first message failing. Its error is only reported
+ * when it is the first message of the batch, the number of messages sent is
+ * returned otherwise.
+ *
+ * This function is also exposed as `sendmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @param sock Socket descriptor
+ * @param msgvec Messages to send
+ * @param vlen Number of messages in @a msgvec
+ * @param flags Flags of zsock_sendmsg(), applied to every message
+ *
+ * @return Number of messages sent, or -1 with errno set on error
+ */
+__syscall int zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
 /**
  * @brief Receive data from an arbitrary network address
  *
@@ -537,6 +565,40 @@ __syscall ssize_t zsock_recvfrom(int sock, void *buf, size_t max_len,
  */
 __syscall ssize_t zsock_recvmsg(int sock, struct msghdr *msg, int flags);
 
+/**
+ * @brief Receive several messages from a socket
+ *
+ * @details
+ * Receives messages into @a msgvec in order, as zsock_recvmsg() would, and
+ * sets the @c msg_len of each message received to its number of bytes. The
+ * socket is looked up and locked once for the whole batch, so this is
+ * cheaper than receiving the messages one by one, especially from user mode.
+ *
+ * With ZSOCK_MSG_WAITFORONE in @a flags, only the first message is waited
+ * for and the batch ends once no more data is queued. When @a timeout is
+ * not NULL, the batch also ends after the first message received once it
+ * has elapsed. Like on Linux, this does not bound the wait for a message.
+ *
+ * Receiving stops at the first message failing. Its error is only reported
+ * when it is the first message of the batch, the number of messages
+ * received is returned otherwise.
+ *
+ * This function is also exposed as `recvmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @param sock Socket descriptor
+ * @param msgvec Buffers for the messages to receive
+ * @param vlen Number of messages in @a msgvec
+ * @param flags Flags of zsock_recvmsg(), applied to every message, and
+ *        ZSOCK_MSG_WAITFORONE
+ * @param timeout Time after which the batch ends, or NULL
+ *
+ * @return Number of messages received, or -1 with errno set on error
+ */
+__syscall int zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags,
+			     struct timespec *timeout);
+
 /**
  * @brief Receive data from a connected peer
  *
@@ -553,6 +615,72 @@ static inline ssize_t zsock_recv(int sock, void *buf, size_t max_len,
 	return zsock_recvfrom(sock, buf, max_len, flags, NULL, NULL);
 }
 
+/** @cond INTERNAL_HIDDEN */
+struct net_pkt;
+struct net_context;
+/** @endcond */
+
+/**
+ * @brief Data of a socket lent by zsock_recvmsg_zc()
+ *
+ * Keeps the network buffers of the data lent alive until it is given back
+ * with zsock_recvmsg_zc_release().
+ */
+struct zsock_rx_loan {
+	/** @cond INTERNAL_HIDDEN */
+	struct net_pkt *pkt;
+	struct net_context *ctx;
+	size_t len;
+	/** @endcond */
+};
+
+/**
+ * @brief Receive a message from a socket without copying its data
+ *
+ * @details
+ * Like zsock_recvmsg(), but instead of copying the received data into the
+ * buffers of @a msg, points the @c msg_iov entries at the network buffers
+ * holding it, one entry per buffer fragment, and sets @c msg_iovlen to the
+ * number of entries used. The data is read-only and stays valid until
+ * @a loan is given back with zsock_recvmsg_zc_release(), even if the socket
+ * is closed in the meantime. Until then, the network buffers are not
+ * available to the stack, and for stream sockets the receive window does
+ * not reopen, so loans should be given back promptly.
+ *
+ * For datagram sockets, the whole datagram is lent and ZSOCK_MSG_TRUNC is
+ * set in @c msg_flags if @c msg_iovlen is too small to describe it, the
+ * rest of it being discarded on release. For stream sockets, at most the
+ * data of one received segment is lent, the rest of it being left queued.
+ *
+ * Only ZSOCK_MSG_DONTWAIT is supported in @a flags, and no control
+ * messages are returned. This is only supported by the native IP sockets,
+ * and only from supervisor threads, as the network buffers are not
+ * accessible from user mode.
+ *
+ * @param sock Socket descriptor
+ * @param msg Message header, its @c msg_iov entries are written
+ * @param flags ZSOCK_MSG_DONTWAIT or 0
+ * @param loan Loan to give back once done with the data
+ *
+ * @return Number of bytes lent, 0 on end of stream, or -1 with errno set
+ *         on error, in which case there is nothing to give back
+ */
+ssize_t zsock_recvmsg_zc(int sock, struct msghdr *msg, int flags,
+			 struct zsock_rx_loan *loan);
+
+/**
+ * @brief Give back data lent by zsock_recvmsg_zc()
+ *
+ * Frees the network buffers of the data, and for stream sockets reopens the
+ * receive window by the amount of data lent. Giving back an empty loan does
+ * nothing.
+ *
+ * @param loan Loan filled by zsock_recvmsg_zc()
+ *
+ * @return 0 on success, -1 with errno set on error
+ */
+int zsock_recvmsg_zc_release(struct zsock_rx_loan *loan);
+
 /**
  * @brief Control blocking/non-blocking mode of a socket
  *
@@ -959,6 +1087,22 @@ struct ifreq {
 #define TCP_KEEPINTVL 3
 /** Number of keepalives before dropping connection */
 #define TCP_KEEPCNT 4
+/** Congestion control algorithm of the connection, as a name string such as
+ *  "reno", "cubic" or "bbr" of up to 15 characters.
+ */
+#define TCP_CONGESTION 5
+
+/** @} */
+
+/**
+ * @name UDP level options (IPPROTO_UDP)
+ * @{
+ */
+/* Socket options for IPPROTO_UDP level */
+/** Split the data of each send call in datagrams of this many bytes, the
+ *  last one being shorter if needed. An int, 0 disables the segmentation.
+ */
+#define UDP_SEGMENT 103
 
 /** @} */
 
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_PROFILING_SAMPLER_H_
+#define ZEPHYR_INCLUDE_PROFILING_SAMPLER_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sampling profiler
+ * @defgroup profiling_sampler Sampling profiler
+ * @ingroup os_services
+ * @{
+ */
+
+/**
+ * @brief Start sampling.
+ *
+ * The running thread and its call stack are sampled from the system timer
+ * interrupt at @p frequency Hz. Samples are buffered and written to the
+ * tracing backend from the system workqueue, one text line per sample:
+ *
+ * @code{.unparsed}
+ * sample <thread> <pc> <return address>...
+ * @endcode
+ *
+ * All values are hexadecimal, the innermost frame coming first. Samples
+ * whose call stack is deeper than @kconfig{CONFIG_PROFILING_SAMPLER_STACK_DEPTH}
+ * keep their innermost frames and end with @c " ...". With
+ * @kconfig{CONFIG_THREAD_NAME} and @kconfig{CONFIG_THREAD_MONITOR}, they are
+ * preceded by a @c "thread <thread> <name>" line for each thread, and a
+ * @c "dropped <count>" line reports samples which did not fit in the buffer.
+ *
+ * @param frequency Sampling frequency in Hz.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p frequency is 0.
+ * @retval -EALREADY if sampling is already running.
+ */
+int profiling_sampler_start(uint32_t frequency);
+
+/**
+ * @brief Stop sampling.
+ *
+ * Samples taken so far are written to the tracing backend.
+ *
+ * @retval 0 on success.
+ * @retval -EALREADY if sampling is not running.
+ */
+int profiling_sampler_stop(void);
+
+/**
+ * @brief Write buffered samples to the tracing backend.
+ *
+ * Must not be called from an ISR.
+ */
+void profiling_sampler_flush(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_PROFILING_SAMPLER_H_ */
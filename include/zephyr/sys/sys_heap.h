@@ -16,6 +16,8 @@
 extern "C" {
 #endif
 
+struct k_spinlock;
+
 /* Simple, fast heap implementation.
  *
  * A more or less conventional segregated fit allocator with
@@ -218,6 +220,56 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
  */
 size_t sys_heap_usable_size(struct sys_heap *heap, void *mem);
 
+/** @brief Attach per-CPU magazine caches to a sys_heap
+ *
+ * Carves the bookkeeping for CONFIG_SYS_HEAP_MAGAZINES out of the
+ * heap itself.  Afterwards sys_heap_magazine_alloc() and
+ * sys_heap_magazine_free() may serve small blocks without holding
+ * @a lock, which must otherwise serialize all accesses to the heap
+ * (including the ones made by the magazine layer when refilling or
+ * flushing a magazine).  Heaps too small to spare the space are left
+ * without caches.
+ *
+ * @param heap Heap to attach the caches to
+ * @param lock Lock serializing all other accesses to @a heap
+ * @return 0 on success, -ENOMEM if the caches could not be set up
+ */
+int sys_heap_magazines_init(struct sys_heap *heap, struct k_spinlock *lock);
+
+/** @brief Allocate a small block from the current CPU's magazine
+ *
+ * Fast path for sys_heap_alloc() for sizes covered by the magazine
+ * size classes.  May be called without holding the heap lock.
+ *
+ * @param heap Heap with caches set up by sys_heap_magazines_init()
+ * @param bytes Number of bytes requested
+ * @return Pointer to memory the caller can now use, or NULL if the
+ *         request must go through the heap itself
+ */
+void *sys_heap_magazine_alloc(struct sys_heap *heap, size_t bytes);
+
+/** @brief Return a small block to the current CPU's magazine
+ *
+ * Fast path for sys_heap_free().  May be called without holding the
+ * heap lock.
+ *
+ * @param heap Heap with caches set up by sys_heap_magazines_init()
+ * @param mem A pointer previously returned from this heap
+ * @return true if the block was taken, false if it must be freed
+ *         with sys_heap_free()
+ */
+bool sys_heap_magazine_free(struct sys_heap *heap, void *mem);
+
+/** @brief Return all cached blocks to a sys_heap
+ *
+ * Must be called with the heap lock held, typically when an
+ * allocation failed.
+ *
+ * @param heap Heap with caches set up by sys_heap_magazines_init()
+ * @return true if any block was returned to the heap
+ */
+bool sys_heap_magazines_drain(struct sys_heap *heap);
+
 /** @brief Validate heap integrity
  *
  * Validates the internal integrity of a sys_heap.  Intended for unit
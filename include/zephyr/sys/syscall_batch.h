@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H
+#define ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H
+
+#include <errno.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup usermode_apis
+ * @{
+ */
+
+/**
+ * @brief System call of a batch
+ *
+ * The arguments are the marshalled ones the generated system call wrappers
+ * pass to arch_syscall_invoke6(): integers and pointers take one slot,
+ * while 64-bit values, including @ref k_timeout_t with
+ * @kconfig{CONFIG_TIMEOUT_64BIT}, take two slots on 32-bit targets, low
+ * word first. System calls with more than six such arguments take the
+ * remaining ones from an array pointed to by the sixth slot, and those
+ * returning a 64-bit value on 32-bit targets write it to the location
+ * pointed to by the slot after their last argument.
+ */
+struct k_syscall_batch_entry {
+	/** System call ID, K_SYSCALL_* from zephyr/syscall_list.h */
+	uintptr_t id;
+	/** Marshalled arguments of the system call */
+	uintptr_t args[6];
+	/** Return value of the system call, written once it has run */
+	uintptr_t ret;
+};
+
+/** @cond INTERNAL_HIDDEN */
+#define Z_SYSCALL_BATCH_ARG(arg) ((uintptr_t)(arg))
+/** @endcond */
+
+/**
+ * @brief Initializer of a system call of a batch
+ *
+ * Arguments are cast to uintptr_t, so those which are neither integers
+ * nor pointers must be marshalled by the caller, see
+ * @ref k_syscall_batch_entry.
+ *
+ * @param _id System call ID, e.g. K_SYSCALL_K_SEM_GIVE
+ * @param ... Arguments of the system call
+ */
+#define K_SYSCALL_BATCH_ENTRY(_id, ...) \
+	{ \
+		.id = (_id), \
+		.args = { COND_CODE_1(IS_EMPTY(__VA_ARGS__), (), \
+			(FOR_EACH(Z_SYSCALL_BATCH_ARG, (,), __VA_ARGS__))) }, \
+	}
+
+#ifdef CONFIG_SYSCALL_BATCH
+
+/**
+ * @brief Run several system calls with a single privilege transition
+ *
+ * Each system call of @a entries is verified and run in order, as if it
+ * was invoked on its own, and its return value is written to the @a ret
+ * field of its entry. This amortizes the system call entry and exit cost
+ * for user threads making many kernel calls in a row.
+ *
+ * Like when invoking them on their own, a system call failing verification
+ * causes a kernel oops, after the system calls before it in the batch
+ * have run. Nested batches are not allowed.
+ *
+ * Supervisor threads call the kernel directly, so there is nothing to
+ * batch for them and this fails.
+ *
+ * @param entries System calls to run, in user memory writable by the caller
+ * @param count Number of system calls in @a entries
+ *
+ * @retval 0 All system calls have run
+ * @retval -ENOTSUP Called from supervisor mode
+ */
+__syscall int k_syscall_batch(struct k_syscall_batch_entry *entries,
+			      size_t count);
+
+#else
+/* LCOV_EXCL_START */
+/**
+ * @internal
+ */
+static inline int z_impl_k_syscall_batch(struct k_syscall_batch_entry *entries,
+					 size_t count)
+{
+	ARG_UNUSED(entries);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+}
+/* LCOV_EXCL_STOP */
+#endif /* CONFIG_SYSCALL_BATCH */
+
+/** @} */
+
+#include <zephyr/syscalls/syscall_batch.h>
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H */
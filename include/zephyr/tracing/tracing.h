@@ -1045,6 +1045,28 @@
  */
 #define sys_port_trace_k_queue_get_exit(queue, timeout, ret)
 
+/**
+ * @brief Trace Queue get batch attempt enter
+ * @param queue Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_queue_get_batch_enter(queue, timeout)
+
+/**
+ * @brief Trace Queue get batch attempt blocking
+ * @param queue Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_queue_get_batch_blocking(queue, timeout)
+
+/**
+ * @brief Trace Queue get batch attempt outcome
+ * @param queue Queue object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_queue_get_batch_exit(queue, timeout, ret)
+
 /**
  * @brief Trace Queue remove enter
  * @param queue Queue object
@@ -1192,6 +1214,21 @@
  */
 #define sys_port_trace_k_fifo_get_exit(fifo, timeout, ret)
 
+/**
+ * @brief Trace FIFO Queue get batch entry
+ * @param fifo FIFO object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_fifo_get_batch_enter(fifo, timeout)
+
+/**
+ * @brief Trace FIFO Queue get batch exit
+ * @param fifo FIFO object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_fifo_get_batch_exit(fifo, timeout, ret)
+
 /**
  * @brief Trace FIFO Queue peek head entry
  * @param fifo FIFO object
@@ -1282,6 +1319,21 @@
  */
 #define sys_port_trace_k_lifo_get_exit(lifo, timeout, ret)
 
+/**
+ * @brief Trace LIFO Queue get batch entry
+ * @param lifo LIFO object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_lifo_get_batch_enter(lifo, timeout)
+
+/**
+ * @brief Trace LIFO Queue get batch exit
+ * @param lifo LIFO object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_lifo_get_batch_exit(lifo, timeout, ret)
+
 /** @} */ /* end of subsys_tracing_apis_lifo */
 
 /**
@@ -1454,6 +1506,64 @@
  */
 #define sys_port_trace_k_msgq_purge(msgq)
 
+/**
+ * @brief Trace Message Queue alloc put attempt entry
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_alloc_put_enter(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue alloc put attempt blocking
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_alloc_put_blocking(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue alloc put attempt outcome
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_msgq_alloc_put_exit(msgq, timeout, ret)
+
+/**
+ * @brief Trace Message Queue commit
+ * @param msgq Message Queue object
+ * @param ret Return value
+ */
+#define sys_port_trace_k_msgq_commit(msgq, ret)
+
+/**
+ * @brief Trace Message Queue claim attempt entry
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_claim_enter(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue claim attempt blocking
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_claim_blocking(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue claim attempt outcome
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_msgq_claim_exit(msgq, timeout, ret)
+
+/**
+ * @brief Trace Message Queue finish
+ * @param msgq Message Queue object
+ * @param ret Return value
+ */
+#define sys_port_trace_k_msgq_finish(msgq, ret)
+
 /** @} */ /* end of subsys_tracing_apis_msgq */
 
 /**
@@ -1633,6 +1743,84 @@
  */
 #define sys_port_trace_k_pipe_read_exit(pipe, ret)
 
+/**
+ * @brief Trace Pipe vectored write attempt entry
+ * @param pipe Pipe object
+ * @param iov Buffers to write from
+ * @param iovcnt Number of buffers
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_pipe_writev_enter(pipe, iov, iovcnt, timeout)
+
+/**
+ * @brief Trace Pipe vectored write attempt outcome
+ * @param pipe Pipe object
+ * @param ret Return value
+ */
+#define sys_port_trace_k_pipe_writev_exit(pipe, ret)
+
+/**
+ * @brief Trace Pipe vectored read attempt entry
+ * @param pipe Pipe object
+ * @param iov Buffers to read into
+ * @param iovcnt Number of buffers
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_pipe_readv_enter(pipe, iov, iovcnt, timeout)
+
+/**
+ * @brief Trace Pipe vectored read attempt outcome
+ * @param pipe Pipe object
+ * @param ret Return value
+ */
+#define sys_port_trace_k_pipe_readv_exit(pipe, ret)
+
+/**
+ * @brief Trace Pipe write claim attempt entry
+ * @param pipe Pipe object
+ * @param len Length wanted
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_pipe_write_claim_enter(pipe, len, timeout)
+
+/**
+ * @brief Trace Pipe write claim attempt outcome
+ * @param pipe Pipe object
+ * @param ret Return value
+ */
+#define sys_port_trace_k_pipe_write_claim_exit(pipe, ret)
+
+/**
+ * @brief Trace Pipe write commit
+ * @param pipe Pipe object
+ * @param len Length committed
+ * @param ret Return value
+ */
+#define sys_port_trace_k_pipe_write_commit(pipe, len, ret)
+
+/**
+ * @brief Trace Pipe read claim attempt entry
+ * @param pipe Pipe object
+ * @param len Length wanted
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_pipe_read_claim_enter(pipe, len, timeout)
+
+/**
+ * @brief Trace Pipe read claim attempt outcome
+ * @param pipe Pipe object
+ * @param ret Return value
+ */
+#define sys_port_trace_k_pipe_read_claim_exit(pipe, ret)
+
+/**
+ * @brief Trace Pipe read finish
+ * @param pipe Pipe object
+ * @param len Length released
+ * @param ret Return value
+ */
+#define sys_port_trace_k_pipe_read_finish(pipe, len, ret)
+
 /**
  * @brief Trace Pipe cleanup entry
  * @param pipe Pipe object
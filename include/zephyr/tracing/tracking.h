@@ -75,6 +75,8 @@ extern struct k_event *_track_list_k_event;
 	sys_track_k_queue_init(queue)
 #define sys_port_track_k_pipe_init(pipe, buffer, buffer_size) \
 	sys_track_k_pipe_init(pipe, buffer, buffer_size)
+#define sys_port_track_k_pipe_write_commit(pipe, len, ret)
+#define sys_port_track_k_pipe_read_finish(pipe, len, ret)
 #define sys_port_track_k_condvar_init(condvar, ret)
 #define sys_port_track_k_stack_init(stack) \
 	sys_track_k_stack_init(stack)
@@ -84,6 +86,8 @@ extern struct k_event *_track_list_k_event;
 	sys_track_k_sem_init(sem)
 #define sys_port_track_k_msgq_purge(msgq)
 #define sys_port_track_k_msgq_peek(msgq, ret)
+#define sys_port_track_k_msgq_commit(msgq, ret)
+#define sys_port_track_k_msgq_finish(msgq, ret)
 #define sys_port_track_k_msgq_init(msgq) \
 	sys_track_k_msgq_init(msgq)
 #define sys_port_track_k_mbox_init(mbox) \
@@ -133,6 +137,8 @@ void sys_track_socket_init(int sock, int family, int type, int proto);
 #define sys_port_track_k_queue_cancel_wait(queue)
 #define sys_port_track_k_queue_init(queue)
 #define sys_port_track_k_pipe_init(pipe, buffer, buffer_size)
+#define sys_port_track_k_pipe_write_commit(pipe, len, ret)
+#define sys_port_track_k_pipe_read_finish(pipe, len, ret)
 #define sys_port_track_k_condvar_init(condvar, ret)
 #define sys_port_track_k_stack_init(stack)
 #define sys_port_track_k_thread_name_set(thread, ret)
@@ -140,6 +146,8 @@ void sys_track_socket_init(int sock, int family, int type, int proto);
 #define sys_port_track_k_sem_init(sem, ret)
 #define sys_port_track_k_msgq_purge(msgq)
 #define sys_port_track_k_msgq_peek(msgq, ret)
+#define sys_port_track_k_msgq_commit(msgq, ret)
+#define sys_port_track_k_msgq_finish(msgq, ret)
 #define sys_port_track_k_msgq_init(msgq)
 #define sys_port_track_k_mbox_init(mbox)
 #define sys_port_track_k_mem_slab_init(slab, rc)
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+#define ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ZVFS_EPOLLIN      ZVFS_POLLIN
+#define ZVFS_EPOLLPRI     ZVFS_POLLPRI
+#define ZVFS_EPOLLOUT     ZVFS_POLLOUT
+#define ZVFS_EPOLLERR     ZVFS_POLLERR
+#define ZVFS_EPOLLHUP     ZVFS_POLLHUP
+#define ZVFS_EPOLLONESHOT BIT(30)
+#define ZVFS_EPOLLET      BIT(31)
+
+#define ZVFS_EPOLL_CTL_ADD 1
+#define ZVFS_EPOLL_CTL_DEL 2
+#define ZVFS_EPOLL_CTL_MOD 3
+
+#define ZVFS_EPOLL_CLOEXEC 0x80000
+
+union zvfs_epoll_data {
+	void *ptr;
+	int fd;
+	uint32_t u32;
+	uint64_t u64;
+};
+
+struct zvfs_epoll_event {
+	/** Bitwise-ORed ZVFS_EPOLLxxx values */
+	uint32_t events;
+	/** User data, returned as is by @ref zvfs_epoll_wait */
+	union zvfs_epoll_data data;
+};
+
+/**
+ * @brief Create a ZVFS epoll instance
+ *
+ * The returned file descriptor refers to a set of file descriptors
+ * registered with @ref zvfs_epoll_ctl. Registrations stay in place from
+ * one @ref zvfs_epoll_wait to the next, so that the cost of a wait
+ * depends on the number of ready file descriptors rather than on the
+ * number of registered ones.
+ *
+ * Any file descriptor supporting poll can be registered, e.g. sockets
+ * and eventfds.
+ *
+ * @param flags 0 or ZVFS_EPOLL_CLOEXEC, which has no effect
+ *
+ * @return New ZVFS epoll file descriptor on success, -1 on error
+ */
+int zvfs_epoll_create1(int flags);
+
+/**
+ * @brief Add, modify or remove a file descriptor of a ZVFS epoll instance
+ *
+ * By default, a file descriptor is reported by every wait for as long as
+ * it is ready (level-triggered). With ZVFS_EPOLLET, it is reported again
+ * only when it signals new readiness, e.g. when more data is received
+ * (edge-triggered). With ZVFS_EPOLLONESHOT, it is reported once, and then
+ * disabled until modified with ZVFS_EPOLL_CTL_MOD.
+ *
+ * A file descriptor is removed from all epoll instances when it is closed.
+ *
+ * @param epfd ZVFS epoll file descriptor
+ * @param op ZVFS_EPOLL_CTL_ADD, ZVFS_EPOLL_CTL_MOD or ZVFS_EPOLL_CTL_DEL
+ * @param fd File descriptor to add, modify or remove
+ * @param event Events to wait for and user data, ignored for
+ *        ZVFS_EPOLL_CTL_DEL
+ *
+ * @return 0 on success, -1 on error
+ */
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event);
+
+/**
+ * @brief Wait for file descriptors of a ZVFS epoll instance to be ready
+ *
+ * @param epfd ZVFS epoll file descriptor
+ * @param events Array receiving the ready file descriptors
+ * @param maxevents Size of @a events
+ * @param timeout Timeout in milliseconds, or -1 to wait forever
+ *
+ * @return Number of ready file descriptors stored in @a events, 0 on
+ *         timeout, -1 on error
+ */
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout);
+
+/**
+ * @internal
+ * @brief Remove a file descriptor being closed from all epoll instances
+ */
+void zvfs_epoll_fd_close(int fd);
+
+/**
+ * @internal
+ * @brief Check whether zvfs_close() started closing a file descriptor
+ *
+ * The caller holds the lock of the file descriptor.
+ */
+bool zvfs_epoll_fd_closing(int fd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_ */
@@ -18,6 +18,11 @@
  * Threads waiting on an event object have the option of either waking once
  * any or all of the events it desires have been posted to the event object.
  *
+ * With CONFIG_EVENTS_WAIT_Q_PER_BIT, threads waiting for a single event are
+ * pended on a wait queue of their own for that event, so that posting only
+ * processes the threads waiting on the posted events, plus the threads
+ * waiting for several events which remain on the main wait queue.
+ *
  * @brief Kernel event object
  */
 
@@ -30,6 +35,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 /* private kernel APIs */
 #include <wait_q.h>
 #include <ksched.h>
@@ -42,7 +48,9 @@
 
 struct event_walk_data {
 	struct k_thread  *head;
+	_wait_q_t *head_wait_q;
 	uint32_t events;
+	bool wake_one;
 };
 
 #ifdef CONFIG_OBJ_CORE_EVENT
@@ -60,6 +68,12 @@ void z_impl_k_event_init(struct k_event *event)
 
 	z_waitq_init(&event->wait_q);
 
+#ifdef CONFIG_EVENTS_WAIT_Q_PER_BIT
+	for (size_t i = 0; i < ARRAY_SIZE(event->bit_wait_q); i++) {
+		z_waitq_init(&event->bit_wait_q[i]);
+	}
+#endif
+
 	k_object_init(event);
 
 #ifdef CONFIG_OBJ_CORE_EVENT
@@ -100,6 +114,19 @@ static bool are_wait_conditions_met(uint32_t desired, uint32_t current,
 	return match != 0;
 }
 
+static _wait_q_t *event_wait_q(struct k_event *event, uint32_t events)
+{
+#ifdef CONFIG_EVENTS_WAIT_Q_PER_BIT
+	if (is_power_of_two(events)) {
+		return &event->bit_wait_q[u32_count_trailing_zeros(events)];
+	}
+#else
+	ARG_UNUSED(events);
+#endif
+
+	return &event->wait_q;
+}
+
 static int event_walk_op(struct k_thread *thread, void *data)
 {
 	unsigned int      wait_condition;
@@ -107,46 +134,97 @@ static int event_walk_op(struct k_thread *thread, void *data)
 
 	wait_condition = thread->event_options & K_EVENT_WAIT_MASK;
 
-	if (are_wait_conditions_met(thread->events, event_data->events,
-				    wait_condition)) {
+	if (!are_wait_conditions_met(thread->events, event_data->events,
+				     wait_condition)) {
+		return 0;
+	}
 
+	if (event_data->wake_one) {
 		/*
-		 * Events create a list of threads to wake up. We do
-		 * not want z_thread_timeout to wake these threads; they
-		 * will be woken up by k_event_post_internal once they
-		 * have been processed.
+		 * Wait queues are sorted by priority, so this is the best
+		 * candidate of this wait queue. Keep it if it beats the
+		 * candidates of the wait queues already walked, it is made
+		 * to unpend once all of them have been.
 		 */
-		thread->no_wake_on_timeout = true;
+		if ((event_data->head == NULL) ||
+		    (z_sched_prio_cmp(thread, event_data->head) > 0)) {
+			event_data->head = thread;
+			event_data->head_wait_q = thread->base.pended_on;
+		}
 
-		/*
-		 * The wait conditions have been satisfied. Add this
-		 * thread to the list of threads to unpend.
-		 */
-		thread->next_event_link = event_data->head;
-		event_data->head = thread;
-		z_abort_timeout(&thread->base.timeout);
+		return 1;
 	}
 
+	/*
+	 * Events create a list of threads to wake up. We do
+	 * not want z_thread_timeout to wake these threads; they
+	 * will be woken up by k_event_post_internal once they
+	 * have been processed.
+	 */
+	thread->no_wake_on_timeout = true;
+
+	/*
+	 * The wait conditions have been satisfied. Add this
+	 * thread to the list of threads to unpend.
+	 */
+	thread->next_event_link = event_data->head;
+	event_data->head = thread;
+	z_abort_timeout(&thread->base.timeout);
+
 	return 0;
 }
 
+static int event_claim_op(struct k_thread *thread, void *data)
+{
+	struct event_walk_data *event_data = data;
+
+	if (thread != event_data->head) {
+		return 0;
+	}
+
+	/* Same as event_walk_op(), for the single thread to wake up */
+	thread->no_wake_on_timeout = true;
+	thread->next_event_link = NULL;
+	z_abort_timeout(&thread->base.timeout);
+
+	return 1;
+}
+
+static void event_walk(struct k_event *event, uint32_t posted,
+		       struct event_walk_data *data)
+{
+	data->head = NULL;
+
+#ifdef CONFIG_EVENTS_WAIT_Q_PER_BIT
+	for (uint32_t bits = posted; bits != 0U; bits &= bits - 1U) {
+		z_sched_waitq_walk(&event->bit_wait_q[u32_count_trailing_zeros(bits)],
+				   event_walk_op, data);
+	}
+#endif
+
+	if (posted != 0U) {
+		z_sched_waitq_walk(&event->wait_q, event_walk_op, data);
+	}
+}
+
 static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
-				  uint32_t events_mask)
+				  uint32_t events_mask, uint32_t options)
 {
 	k_spinlock_key_t  key;
 	struct k_thread  *thread;
 	struct event_walk_data data;
 	uint32_t previous_events;
+	uint32_t posted;
 
-	data.head = NULL;
+	data.wake_one = (options & K_EVENT_WAKE_ONE) != 0U;
 	key = k_spin_lock(&event->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_event, post, event, events,
 					events_mask);
 
 	previous_events = event->events & events_mask;
-	events = (event->events & ~events_mask) |
-		 (events & events_mask);
+	posted = events & events_mask;
+	events = (event->events & ~events_mask) | posted;
 	event->events = events;
 	data.events = events;
 	/*
@@ -157,9 +235,22 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	 * 1. Walk the waitq and create a linked list of threads to unpend.
 	 * 2. Unpend each of the threads in the linked list
 	 * 3. Ready each of the threads in the linked list
+	 *
+	 * The events a thread waits for are all checked when it pends, so
+	 * only the events posted now can meet its wait conditions.
 	 */
 
-	z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
+	event_walk(event, posted, &data);
+
+	/*
+	 * When waking a single thread, the best candidate is only known once
+	 * all wait queues have been walked. Claim it if it has not timed out
+	 * in the meantime, otherwise look for another one.
+	 */
+	while (data.wake_one && (data.head != NULL) &&
+	       (z_sched_waitq_walk(data.head_wait_q, event_claim_op, &data) == 0)) {
+		event_walk(event, posted, &data);
+	}
 
 	if (data.head != NULL) {
 		thread = data.head;
@@ -183,7 +274,7 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 
 uint32_t z_impl_k_event_post(struct k_event *event, uint32_t events)
 {
-	return k_event_post_internal(event, events, events);
+	return k_event_post_internal(event, events, events, 0);
 }
 
 #ifdef CONFIG_USERSPACE
@@ -195,9 +286,26 @@ uint32_t z_vrfy_k_event_post(struct k_event *event, uint32_t events)
 #include <zephyr/syscalls/k_event_post_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+uint32_t z_impl_k_event_post_options(struct k_event *event, uint32_t events,
+				     uint32_t options)
+{
+	return k_event_post_internal(event, events, events, options);
+}
+
+#ifdef CONFIG_USERSPACE
+uint32_t z_vrfy_k_event_post_options(struct k_event *event, uint32_t events,
+				     uint32_t options)
+{
+	K_OOPS(K_SYSCALL_OBJ(event, K_OBJ_EVENT));
+	K_OOPS(K_SYSCALL_VERIFY((options & ~K_EVENT_WAKE_ONE) == 0U));
+	return z_impl_k_event_post_options(event, events, options);
+}
+#include <zephyr/syscalls/k_event_post_options_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 uint32_t z_impl_k_event_set(struct k_event *event, uint32_t events)
 {
-	return k_event_post_internal(event, events, ~0);
+	return k_event_post_internal(event, events, ~0, 0);
 }
 
 #ifdef CONFIG_USERSPACE
@@ -212,7 +320,7 @@ uint32_t z_vrfy_k_event_set(struct k_event *event, uint32_t events)
 uint32_t z_impl_k_event_set_masked(struct k_event *event, uint32_t events,
 			       uint32_t events_mask)
 {
-	return k_event_post_internal(event, events, events_mask);
+	return k_event_post_internal(event, events, events_mask, 0);
 }
 
 #ifdef CONFIG_USERSPACE
@@ -227,7 +335,7 @@ uint32_t z_vrfy_k_event_set_masked(struct k_event *event, uint32_t events,
 
 uint32_t z_impl_k_event_clear(struct k_event *event, uint32_t events)
 {
-	return k_event_post_internal(event, 0, events);
+	return k_event_post_internal(event, 0, events, 0);
 }
 
 #ifdef CONFIG_USERSPACE
@@ -293,7 +401,8 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_event, wait, event, events,
 					   options, timeout);
 
-	if (z_pend_curr(&event->lock, key, &event->wait_q, timeout) == 0) {
+	if (z_pend_curr(&event->lock, key, event_wait_q(event, events),
+			timeout) == 0) {
 		/* Retrieve the set of events that woke the thread */
 		rv = thread->events;
 	}
@@ -34,7 +34,11 @@
 #define _priq_run_add		z_priq_mq_add
 #define _priq_run_remove	z_priq_mq_remove
 #define _priq_run_yield         z_priq_mq_yield
-#define _priq_run_best		z_priq_mq_best
+# if defined(CONFIG_SCHED_CPU_MASK)
+#  define _priq_run_best	z_priq_mq_mask_best
+# else
+#  define _priq_run_best	z_priq_mq_best
+# endif /* CONFIG_SCHED_CPU_MASK */
 #endif
 
 /* Scalable Wait Queue */
@@ -264,13 +268,13 @@ static ALWAYS_INLINE struct prio_info get_prio_info(int8_t old_prio)
 	return ret;
 }
 
-static ALWAYS_INLINE unsigned int z_priq_mq_best_queue_index(struct _priq_mq *pq)
+static ALWAYS_INLINE unsigned int z_priq_mq_bitmap_first(const unsigned long *bitmask)
 {
 	unsigned int i = 0;
 
 	do {
-		if (likely(pq->bitmask[i])) {
-			return i * NBITS + TRAILING_ZEROS(pq->bitmask[i]);
+		if (likely(bitmask[i])) {
+			return i * NBITS + TRAILING_ZEROS(bitmask[i]);
 		}
 		i++;
 	} while (i < PRIQ_BITMAP_SIZE);
@@ -278,6 +282,11 @@ static ALWAYS_INLINE unsigned int z_priq_mq_best_queue_index(struct _priq_mq *pq
 	return K_NUM_THREAD_PRIO - 1;
 }
 
+static ALWAYS_INLINE unsigned int z_priq_mq_best_queue_index(struct _priq_mq *pq)
+{
+	return z_priq_mq_bitmap_first(pq->bitmask);
+}
+
 static ALWAYS_INLINE void z_priq_mq_init(struct _priq_mq *q)
 {
 	for (size_t i = 0; i < ARRAY_SIZE(q->queues); i++) {
@@ -289,13 +298,49 @@ static ALWAYS_INLINE void z_priq_mq_init(struct _priq_mq *q)
 #endif
 }
 
+#ifdef CONFIG_SCHED_CPU_MASK
+static ALWAYS_INLINE void z_priq_mq_cpu_mask_add(struct _priq_mq *pq,
+						 struct k_thread *thread,
+						 struct prio_info pos)
+{
+	for (unsigned int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		if ((thread->base.cpu_mask & BIT(cpu)) != 0) {
+			pq->cpu_count[pos.offset_prio][cpu]++;
+			pq->cpu_bitmask[cpu][pos.idx] |= BIT(pos.bit);
+		}
+	}
+}
+
+static ALWAYS_INLINE void z_priq_mq_cpu_mask_remove(struct _priq_mq *pq,
+						    struct k_thread *thread,
+						    struct prio_info pos)
+{
+	for (unsigned int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		if (((thread->base.cpu_mask & BIT(cpu)) != 0) &&
+		    (--pq->cpu_count[pos.offset_prio][cpu] == 0U)) {
+			pq->cpu_bitmask[cpu][pos.idx] &= ~BIT(pos.bit);
+		}
+	}
+}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
 static ALWAYS_INLINE void z_priq_mq_add(struct _priq_mq *pq,
 					struct k_thread *thread)
 {
 	struct prio_info pos = get_prio_info(thread->base.prio);
 
+#ifdef CONFIG_SCHED_DEADLINE
+	/* Keep each level sorted by deadline, so that its head stays
+	 * the best choice and _priq_run_best remains O(1).
+	 */
+	z_priq_simple_add(&pq->queues[pos.offset_prio], thread);
+#else
 	sys_dlist_append(&pq->queues[pos.offset_prio], &thread->base.qnode_dlist);
+#endif /* CONFIG_SCHED_DEADLINE */
 	pq->bitmask[pos.idx] |= BIT(pos.bit);
+#ifdef CONFIG_SCHED_CPU_MASK
+	z_priq_mq_cpu_mask_add(pq, thread, pos);
+#endif /* CONFIG_SCHED_CPU_MASK */
 
 #ifndef CONFIG_SMP
 	if (pos.offset_prio < pq->cached_queue_index) {
@@ -310,6 +355,9 @@ static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq,
 	struct prio_info pos = get_prio_info(thread->base.prio);
 
 	sys_dlist_dequeue(&thread->base.qnode_dlist);
+#ifdef CONFIG_SCHED_CPU_MASK
+	z_priq_mq_cpu_mask_remove(pq, thread, pos);
+#endif /* CONFIG_SCHED_CPU_MASK */
 	if (unlikely(sys_dlist_is_empty(&pq->queues[pos.offset_prio]))) {
 		pq->bitmask[pos.idx] &= ~BIT(pos.bit);
 #ifndef CONFIG_SMP
@@ -323,9 +371,13 @@ static ALWAYS_INLINE void z_priq_mq_yield(struct _priq_mq *pq)
 #ifndef CONFIG_SMP
 	struct prio_info pos = get_prio_info(_current->base.prio);
 
+#ifdef CONFIG_SCHED_DEADLINE
+	z_priq_simple_yield(&pq->queues[pos.offset_prio]);
+#else
 	sys_dlist_dequeue(&_current->base.qnode_dlist);
 	sys_dlist_append(&pq->queues[pos.offset_prio],
 			 &_current->base.qnode_dlist);
+#endif /* CONFIG_SCHED_DEADLINE */
 #endif
 }
 
@@ -346,4 +398,24 @@ static ALWAYS_INLINE struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 	return NULL;
 }
 
+#ifdef CONFIG_SCHED_CPU_MASK
+static ALWAYS_INLINE struct k_thread *z_priq_mq_mask_best(struct _priq_mq *pq)
+{
+	/* The per-CPU bitmap yields the best level holding a thread that
+	 * may run here in constant time, only threads of that level not
+	 * allowed on this CPU need to be skipped.
+	 */
+	unsigned int index = z_priq_mq_bitmap_first(pq->cpu_bitmask[_current_cpu->id]);
+	struct k_thread *thread;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&pq->queues[index], thread, base.qnode_dlist) {
+		if ((thread->base.cpu_mask & BIT(_current_cpu->id)) != 0) {
+			return thread;
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
 #endif /* ZEPHYR_KERNEL_INCLUDE_PRIORITY_Q_H_ */
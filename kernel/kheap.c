@@ -28,6 +28,10 @@ void k_heap_init(struct k_heap *heap, void *mem, size_t bytes)
 	z_waitq_init(&heap->wait_q);
 	heap->lock = (struct k_spinlock) {};
 	sys_heap_init(&heap->heap, mem, bytes);
+#ifdef CONFIG_SYS_HEAP_MAGAZINES
+	atomic_set(&heap->waiters, 0);
+	(void)sys_heap_magazines_init(&heap->heap, &heap->lock);
+#endif
 
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, heap);
 }
@@ -74,6 +78,40 @@ SYS_INIT_NAMED(statics_init_pre, statics_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_
 SYS_INIT_NAMED(statics_init_post, statics_init, POST_KERNEL, 0);
 #endif /* CONFIG_DEMAND_PAGING && !CONFIG_LINKER_GENERIC_SECTIONS_PRESENT_AT_BOOT */
 
+#ifdef CONFIG_SYS_HEAP_MAGAZINES
+/* Blocks parked in the per-CPU magazines are invisible to the heap.
+ * While some allocator may wait for memory, k_heap_free() must not
+ * leave them there or the waiter could miss its wakeup.  The count is
+ * raised before the waiter's last drain of the magazines, so a free
+ * racing with it either gets drained or sees the waiter.
+ */
+static inline void heap_waiters_inc(struct k_heap *heap, bool may_wait)
+{
+	if (may_wait) {
+		atomic_inc(&heap->waiters);
+	}
+}
+
+static inline void heap_waiters_dec(struct k_heap *heap, bool may_wait)
+{
+	if (may_wait) {
+		atomic_dec(&heap->waiters);
+	}
+}
+#else
+static inline void heap_waiters_inc(struct k_heap *heap, bool may_wait)
+{
+	ARG_UNUSED(heap);
+	ARG_UNUSED(may_wait);
+}
+
+static inline void heap_waiters_dec(struct k_heap *heap, bool may_wait)
+{
+	ARG_UNUSED(heap);
+	ARG_UNUSED(may_wait);
+}
+#endif
+
 typedef void * (sys_heap_allocator_t)(struct sys_heap *heap, size_t align, size_t bytes);
 
 static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes,
@@ -83,15 +121,33 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	void *ret = NULL;
 
+#ifdef CONFIG_SYS_HEAP_MAGAZINES
+	if (align <= sizeof(void *)) {
+		ret = sys_heap_magazine_alloc(&heap->heap, bytes);
+		if (ret != NULL) {
+			return ret;
+		}
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
 	bool blocked_alloc = false;
+	bool may_wait = IS_ENABLED(CONFIG_MULTITHREADING) && !K_TIMEOUT_EQ(timeout, K_NO_WAIT);
+
+	heap_waiters_inc(heap, may_wait);
 
 	while (ret == NULL) {
 		ret = sys_heap_allocator(&heap->heap, align, bytes);
 
+#ifdef CONFIG_SYS_HEAP_MAGAZINES
+		if ((ret == NULL) && sys_heap_magazines_drain(&heap->heap)) {
+			ret = sys_heap_allocator(&heap->heap, align, bytes);
+		}
+#endif
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -112,6 +168,8 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 		key = k_spin_lock(&heap->lock);
 	}
 
+	heap_waiters_dec(heap, may_wait);
+
 	k_spin_unlock(&heap->lock, key);
 	return ret;
 }
@@ -184,9 +242,19 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
+	bool may_wait = IS_ENABLED(CONFIG_MULTITHREADING) && !K_TIMEOUT_EQ(timeout, K_NO_WAIT);
+
+	heap_waiters_inc(heap, may_wait);
+
 	while (ret == NULL) {
 		ret = sys_heap_realloc(&heap->heap, ptr, bytes);
 
+#ifdef CONFIG_SYS_HEAP_MAGAZINES
+		if ((ret == NULL) && sys_heap_magazines_drain(&heap->heap)) {
+			ret = sys_heap_realloc(&heap->heap, ptr, bytes);
+		}
+#endif
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -197,6 +265,8 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 		key = k_spin_lock(&heap->lock);
 	}
 
+	heap_waiters_dec(heap, may_wait);
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, realloc, heap, ptr, bytes, timeout, ret);
 
 	k_spin_unlock(&heap->lock, key);
@@ -205,11 +275,26 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 void k_heap_free(struct k_heap *heap, void *mem)
 {
-	k_spinlock_key_t key = k_spin_lock(&heap->lock);
+	k_spinlock_key_t key;
+
+#ifdef CONFIG_SYS_HEAP_MAGAZINES
+	if (sys_heap_magazine_free(&heap->heap, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+
+		if (atomic_get(&heap->waiters) == 0) {
+			return;
+		}
 
-	sys_heap_free(&heap->heap, mem);
+		key = k_spin_lock(&heap->lock);
+		(void)sys_heap_magazines_drain(&heap->heap);
+	} else
+#endif
+	{
+		key = k_spin_lock(&heap->lock);
+		sys_heap_free(&heap->heap, mem);
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+	}
 
-	SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
 	if (IS_ENABLED(CONFIG_MULTITHREADING) && (z_unpend_all(&heap->wait_q) != 0)) {
 		z_reschedule(&heap->lock, key);
 	} else {
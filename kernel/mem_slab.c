@@ -18,6 +18,50 @@
 #include <ksched.h>
 #include <wait_q.h>
 
+static inline void count_alloc(struct k_mem_slab *slab)
+{
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	atomic_val_t used = atomic_inc(&slab->info.num_used) + 1;
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_val_t max_used = atomic_get(&slab->info.max_used);
+
+	while ((used > max_used) &&
+	       !atomic_cas(&slab->info.max_used, max_used, used)) {
+		max_used = atomic_get(&slab->info.max_used);
+	}
+#else
+	ARG_UNUSED(used);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+#else
+	slab->info.num_used++;
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	slab->info.max_used = MAX(slab->info.num_used,
+				  slab->info.max_used);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+}
+
+static inline void count_free(struct k_mem_slab *slab)
+{
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	(void)atomic_dec(&slab->info.num_used);
+#else
+	slab->info.num_used--;
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+}
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+static inline void reset_max_used(struct k_mem_slab *slab)
+{
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	atomic_set(&slab->info.max_used, atomic_get(&slab->info.num_used));
+#else
+	slab->info.max_used = slab->info.num_used;
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+}
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
 static struct k_obj_type obj_type_mem_slab;
 
@@ -48,11 +92,10 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
-	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
-			  slab->info.block_size;
-	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
+	ptr->free_bytes = k_mem_slab_num_free_get(slab) * slab->info.block_size;
+	ptr->allocated_bytes = k_mem_slab_num_used_get(slab) * slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-	ptr->max_allocated_bytes = slab->info.max_used * slab->info.block_size;
+	ptr->max_allocated_bytes = k_mem_slab_max_used_get(slab) * slab->info.block_size;
 #else
 	ptr->max_allocated_bytes = 0;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
@@ -72,7 +115,7 @@ static int k_mem_slab_stats_reset(struct k_obj_core *obj_core)
 	key = k_spin_lock(&slab->lock);
 
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-	slab->info.max_used = slab->info.num_used;
+	reset_max_used(slab);
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
 	k_spin_unlock(&slab->lock, key);
@@ -184,6 +227,11 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->info.max_used = 0U;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	atomic_set(&slab->waiters, 0);
+	(void)memset(slab->cache, 0, sizeof(slab->cache));
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	rc = create_free_list(slab);
 	if (rc < 0) {
 		goto out;
@@ -219,28 +267,235 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 	       ((offset % slab->info.block_size) == 0);
 }
 
-int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+/* Takes a block off the shared free list, slab lock held */
+static char *take_block_locked(struct k_mem_slab *slab)
+{
+	char *mem = slab->free_list;
+
+	slab->free_list = *(char **)mem;
+	__ASSERT((slab->free_list == NULL) || slab_ptr_is_good(slab, slab->free_list),
+		 "slab corruption detected");
+
+	return mem;
+}
+
+/* Returns a free block to the slab, slab lock held.  Hands it over
+ * directly to the first waiting thread, if any; returns true in that
+ * case, and the caller must reschedule.
+ */
+static bool give_block_locked(struct k_mem_slab *slab, char *mem)
+{
+	if (unlikely(slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
+		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+
+		if (unlikely(pending_thread != NULL)) {
+			count_alloc(slab);
+			z_thread_return_value_set_with_data(pending_thread, 0, mem);
+			z_ready_thread(pending_thread);
+			return true;
+		}
+	}
+
+	*(char **)mem = slab->free_list;
+	slab->free_list = mem;
+
+	return false;
+}
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+/*
+ * Per-CPU caches of free blocks.
+ *
+ * Each CPU owns a small stack of free blocks per slab, protected by a
+ * lock of its own that is only ever contended by a drain.  Blocks are
+ * moved between a cache and the shared free list in batches of
+ * CACHE_BATCH.  Cached blocks count as free in the (atomic) usage
+ * counters.
+ *
+ * Lock ordering is slab lock, then cache lock; a cache lock is never
+ * held while taking the slab lock.
+ *
+ * A thread about to wait for a block raises slab->waiters before it
+ * drains the caches.  A free racing with it therefore either lands
+ * in a cache before the drain, or sees the waiter afterwards and
+ * drains the caches itself.
+ */
+#define CACHE_DEPTH CONFIG_MEM_SLAB_CPU_CACHE_DEPTH
+#define CACHE_BATCH MAX(CACHE_DEPTH / 2, 1)
+
+static inline struct z_mem_slab_cache *local_cache(struct k_mem_slab *slab)
+{
+	/* The thread may then move to another CPU and use the cache of
+	 * the CPU it left.  That cannot corrupt the cache: its blocks and
+	 * count are only touched with its spinlock held, so with interrupts
+	 * locked and other CPUs kept out, wherever the thread runs.
+	 */
+#ifdef CONFIG_SMP
+	return &slab->cache[arch_curr_cpu()->id];
+#else
+	return &slab->cache[0];
+#endif /* CONFIG_SMP */
+}
+
+/* Returns all cached blocks to the slab, slab lock held */
+static bool drain_caches_locked(struct k_mem_slab *slab)
+{
+	bool resched = false;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct z_mem_slab_cache *cache = &slab->cache[i];
+		k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+		while (cache->count > 0U) {
+			resched |= give_block_locked(slab, cache->blocks[--cache->count]);
+		}
+
+		k_spin_unlock(&cache->lock, key);
+	}
+
+	return resched;
+}
+
+static void give_batch(struct k_mem_slab *slab, char **batch, int n, bool drain)
 {
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	bool resched = false;
+
+	for (int i = 0; i < n; i++) {
+		resched |= give_block_locked(slab, batch[i]);
+	}
+
+	if (drain) {
+		resched |= drain_caches_locked(slab);
+	}
+
+	if (resched) {
+		z_reschedule(&slab->lock, key);
+	} else {
+		k_spin_unlock(&slab->lock, key);
+	}
+}
+
+static char *cache_alloc(struct k_mem_slab *slab)
+{
+	struct z_mem_slab_cache *cache = local_cache(slab);
+	char *batch[CACHE_BATCH];
+	char *mem = NULL;
+	k_spinlock_key_t key;
+	int n = 0;
+
+	key = k_spin_lock(&cache->lock);
+	if (cache->count > 0U) {
+		mem = cache->blocks[--cache->count];
+	}
+	k_spin_unlock(&cache->lock, key);
+
+	if (mem == NULL) {
+		key = k_spin_lock(&slab->lock);
+		while ((n < CACHE_BATCH) && (slab->free_list != NULL)) {
+			batch[n++] = take_block_locked(slab);
+		}
+		k_spin_unlock(&slab->lock, key);
+
+		if (n == 0) {
+			return NULL;
+		}
+		mem = batch[--n];
+
+		key = k_spin_lock(&cache->lock);
+		while ((n > 0) && (cache->count < CACHE_DEPTH)) {
+			cache->blocks[cache->count++] = batch[--n];
+		}
+		k_spin_unlock(&cache->lock, key);
+
+		/* Someone else refilled the cache meanwhile */
+		if (n > 0) {
+			give_batch(slab, batch, n, false);
+		}
+	}
+
+	count_alloc(slab);
+
+	return mem;
+}
+
+static bool cache_free(struct k_mem_slab *slab, char *mem)
+{
+	struct z_mem_slab_cache *cache;
+	char *batch[CACHE_BATCH];
+	k_spinlock_key_t key;
+	int n = 0;
+
+	/* Hand it over directly instead */
+	if (atomic_get(&slab->waiters) != 0) {
+		return false;
+	}
+
+	cache = local_cache(slab);
+	key = k_spin_lock(&cache->lock);
+	if (cache->count == CACHE_DEPTH) {
+		n = CACHE_BATCH;
+		cache->count -= n;
+		memcpy(batch, &cache->blocks[cache->count], n * sizeof(char *));
+	}
+	cache->blocks[cache->count++] = mem;
+	k_spin_unlock(&cache->lock, key);
+
+	count_free(slab);
+
+	if ((n > 0) || (atomic_get(&slab->waiters) != 0)) {
+		give_batch(slab, batch, n, atomic_get(&slab->waiters) != 0);
+	}
+
+	return true;
+}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+{
 	int result;
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	*mem = cache_alloc(slab);
+	if (*mem != NULL) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+
+		return 0;
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	bool may_wait = !K_TIMEOUT_EQ(timeout, K_NO_WAIT);
+	bool resched = false;
+
+	if (slab->free_list == NULL) {
+		/* Reclaim the blocks cached by other CPUs; earlier
+		 * waiters get served first.
+		 */
+		if (may_wait) {
+			atomic_inc(&slab->waiters);
+		}
+		resched = drain_caches_locked(slab);
+		if (may_wait && (slab->free_list != NULL)) {
+			atomic_dec(&slab->waiters);
+			may_wait = false;
+		}
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	if (slab->free_list != NULL) {
 		/* take a free block */
-		*mem = slab->free_list;
-		slab->free_list = *(char **)(slab->free_list);
-		slab->info.num_used++;
-		__ASSERT((slab->free_list == NULL &&
-			  slab->info.num_used == slab->info.num_blocks) ||
-			 slab_ptr_is_good(slab, slab->free_list),
+		*mem = take_block_locked(slab);
+		count_alloc(slab);
+		__ASSERT((slab->free_list != NULL) || IS_ENABLED(CONFIG_MEM_SLAB_CPU_CACHE) ||
+			 (k_mem_slab_num_used_get(slab) == slab->info.num_blocks),
 			 "slab corruption detected");
 
-#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-		slab->info.max_used = MAX(slab->info.num_used,
-					  slab->info.max_used);
-#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
-
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
 		   !IS_ENABLED(CONFIG_MULTITHREADING)) {
@@ -256,6 +511,10 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 			*mem = _current->base.swap_data;
 		}
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+		atomic_dec(&slab->waiters);
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 		return result;
@@ -263,6 +522,13 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (resched) {
+		z_reschedule(&slab->lock, key);
+		return result;
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	k_spin_unlock(&slab->lock, key);
 
 	return result;
@@ -276,24 +542,26 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 		return;
 	}
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (cache_free(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+		return;
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
-	if (unlikely(slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
-		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
 
-		if (unlikely(pending_thread != NULL)) {
-			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+	count_free(slab);
+	if (give_block_locked(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
-			z_thread_return_value_set_with_data(pending_thread, 0, mem);
-			z_ready_thread(pending_thread);
-			z_reschedule(&slab->lock, key);
-			return;
-		}
+		z_reschedule(&slab->lock, key);
+		return;
 	}
-	*(char **) mem = slab->free_list;
-	slab->free_list = (char *) mem;
-	slab->info.num_used--;
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
@@ -308,11 +576,10 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
-	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
-			    slab->info.block_size;
+	stats->allocated_bytes = k_mem_slab_num_used_get(slab) * slab->info.block_size;
+	stats->free_bytes = k_mem_slab_num_free_get(slab) * slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-	stats->max_allocated_bytes = slab->info.max_used *
+	stats->max_allocated_bytes = k_mem_slab_max_used_get(slab) *
 				     slab->info.block_size;
 #else
 	stats->max_allocated_bytes = 0;
@@ -332,7 +599,7 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab)
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	slab->info.max_used = slab->info.num_used;
+	reset_max_used(slab);
 
 	k_spin_unlock(&slab->lock, key);
 
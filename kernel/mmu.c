@@ -1610,7 +1610,12 @@ static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
-static bool do_page_fault(void *addr, bool pin)
+/*
+ * Page in the data page at addr, pinning it if requested. When reading
+ * ahead, this is not accounted as a page fault, and only a page that must
+ * be read from the backing store is paged in; false is returned otherwise.
+ */
+static bool do_page_fault(void *addr, bool pin, bool read_ahead)
 {
 	struct k_mem_page_frame *pf;
 	k_spinlock_key_t key;
@@ -1684,6 +1689,12 @@ static bool do_page_fault(void *addr, bool pin)
 	}
 	result = true;
 
+	if (status == ARCH_PAGE_LOCATION_PAGED_IN && read_ahead) {
+		/* Nothing to read ahead, and already pinned pages stay so */
+		result = false;
+		goto out;
+	}
+
 	if (status == ARCH_PAGE_LOCATION_PAGED_IN) {
 		if (pin) {
 			/* It's a physical memory address */
@@ -1708,9 +1719,28 @@ static bool do_page_fault(void *addr, bool pin)
 	__ASSERT(status == ARCH_PAGE_LOCATION_PAGED_OUT,
 		 "unexpected status value %d", status);
 
-	paging_stats_faults_inc(faulting_thread, key.key);
+	if (read_ahead) {
+#ifdef CONFIG_DEMAND_MAPPING
+		/* Not worth a page frame until actually accessed */
+		if (page_in_location == ARCH_UNPAGED_ANON_ZERO ||
+		    page_in_location == ARCH_UNPAGED_ANON_UNINIT) {
+			result = false;
+			goto out;
+		}
+#endif /* CONFIG_DEMAND_MAPPING */
+	} else {
+		paging_stats_faults_inc(faulting_thread, key.key);
+	}
 
 	pf = free_page_frame_list_get();
+	if (pf == NULL && read_ahead) {
+		/*
+		 * The read-ahead budget was taken before the lock was dropped,
+		 * the frames it counted on may have been used since then.
+		 */
+		result = false;
+		goto out;
+	}
 	if (pf == NULL) {
 		/* Need to evict a page frame */
 		pf = do_eviction_select(&dirty);
@@ -1768,24 +1798,40 @@ static void do_page_in(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, false);
+	ret = do_page_fault(addr, false, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
 
+/* Page expected to fault next if memory is accessed sequentially */
+static uintptr_t read_ahead_next;
+
+static void read_ahead_next_set(uintptr_t next)
+{
+	k_spinlock_key_t key = k_spin_lock(&z_mm_lock);
+
+	read_ahead_next = next;
+	k_spin_unlock(&z_mm_lock, key);
+}
+
 void k_mem_page_in(void *addr, size_t size)
 {
 	__ASSERT(!IS_ENABLED(CONFIG_DEMAND_PAGING_ALLOW_IRQ) || !k_is_in_isr(),
 		 "%s may not be called in ISRs if CONFIG_DEMAND_PAGING_ALLOW_IRQ is enabled",
 		 __func__);
 	virt_region_foreach(addr, size, do_page_in);
+
+	if (CONFIG_DEMAND_PAGING_READ_AHEAD > 0) {
+		/* A fault right after the region continues its sequence */
+		read_ahead_next_set((uintptr_t)addr + size);
+	}
 }
 
 static void do_mem_pin(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, true);
+	ret = do_page_fault(addr, true, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1798,9 +1844,74 @@ void k_mem_pin(void *addr, size_t size)
 	virt_region_foreach(addr, size, do_mem_pin);
 }
 
+static void do_mem_unpin(void *addr);
+
+/*
+ * Number of pages that may be read ahead: half of the page frames that are
+ * free beyond the reserve, so that reading ahead never evicts a page and
+ * stops as memory gets short.
+ */
+static size_t read_ahead_budget_locked(void)
+{
+	size_t free = z_free_page_count;
+
+	if (free <= CONFIG_DEMAND_PAGING_PAGE_FRAMES_RESERVE) {
+		return 0;
+	}
+
+	return (free - CONFIG_DEMAND_PAGING_PAGE_FRAMES_RESERVE) / 2;
+}
+
+/*
+ * Also page in the pages following a faulting page if it is the one
+ * expected after the previous fault.
+ */
+static bool do_page_fault_read_ahead(void *addr)
+{
+	uintptr_t page = ROUND_DOWN((uintptr_t)addr, CONFIG_MMU_PAGE_SIZE);
+	uintptr_t next = page + CONFIG_MMU_PAGE_SIZE;
+	k_spinlock_key_t key;
+	size_t count = 0;
+	size_t i;
+	bool ret;
+
+	key = k_spin_lock(&z_mm_lock);
+	if (page == read_ahead_next) {
+		count = MIN(CONFIG_DEMAND_PAGING_READ_AHEAD, read_ahead_budget_locked());
+	}
+	read_ahead_next = next + count * CONFIG_MMU_PAGE_SIZE;
+	k_spin_unlock(&z_mm_lock, key);
+
+	/*
+	 * The pages read ahead are paged in first, so that they cannot evict
+	 * the faulting page, and stay pinned until it is in, so that they
+	 * cannot evict each other. Stop at the first page which is not paged
+	 * out or not mapped, or at the end of the address space.
+	 */
+	for (i = 0; i < count; i++) {
+		uintptr_t ra_page = next + i * CONFIG_MMU_PAGE_SIZE;
+
+		if (ra_page < page || !do_page_fault((void *)ra_page, true, true)) {
+			break;
+		}
+	}
+
+	ret = do_page_fault(addr, false, false);
+
+	while (i-- > 0) {
+		do_mem_unpin((void *)(next + i * CONFIG_MMU_PAGE_SIZE));
+	}
+
+	return ret;
+}
+
 bool k_mem_page_fault(void *addr)
 {
-	return do_page_fault(addr, false);
+	if (CONFIG_DEMAND_PAGING_READ_AHEAD > 0) {
+		return do_page_fault_read_ahead(addr);
+	}
+
+	return do_page_fault(addr, false, false);
 }
 
 static void do_mem_unpin(void *addr)
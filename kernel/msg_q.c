@@ -40,6 +40,174 @@ static inline bool handle_poll_events(struct k_msgq *msgq)
 #endif /* CONFIG_POLL */
 }
 
+/* Readers and writers can be pending on the wait queue at the same time
+ * (e.g. writers waiting for a reserved slot to be committed while readers
+ * wait for a message), so each pending thread points its swap_data at one
+ * of these.
+ */
+struct msgq_waiter {
+	/* Message to send or buffer to receive into, NULL for threads
+	 * waiting to reserve or claim a slot
+	 */
+	void *data;
+	/* Where to store the reserved or claimed slot */
+	void **slot;
+	bool sender;
+};
+
+static inline void next_slot(struct k_msgq *msgq, char **ptr)
+{
+	*ptr += msgq->msg_size;
+	if (*ptr == msgq->buffer_end) {
+		*ptr = msgq->buffer_start;
+	}
+}
+
+static inline bool can_send(struct k_msgq *msgq)
+{
+	return msgq->used_msgs + msgq->held_msgs < msgq->max_msgs;
+}
+
+static inline bool can_reserve(struct k_msgq *msgq)
+{
+	return (msgq->reserved_ptr == NULL) && can_send(msgq);
+}
+
+static void enqueue(struct k_msgq *msgq, const void *data)
+{
+	__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+			msgq->write_ptr < msgq->buffer_end);
+	(void)memcpy(msgq->write_ptr, data, msgq->msg_size);
+	next_slot(msgq, &msgq->write_ptr);
+
+	/* A message behind the reserved slot can only be read once that
+	 * is committed.
+	 */
+	if (msgq->reserved_ptr != NULL) {
+		msgq->held_msgs++;
+		msgq->pending_msgs++;
+	} else {
+		msgq->used_msgs++;
+	}
+}
+
+static void dequeue(struct k_msgq *msgq, void *data)
+{
+	(void)memcpy(data, msgq->read_ptr, msgq->msg_size);
+	next_slot(msgq, &msgq->read_ptr);
+	msgq->used_msgs--;
+
+	/* The slot lies behind the claimed one and only becomes
+	 * reachable for writers once that is finished.
+	 */
+	if (msgq->claimed_ptr != NULL) {
+		msgq->held_msgs++;
+	}
+}
+
+static void *reserve(struct k_msgq *msgq)
+{
+	msgq->reserved_ptr = msgq->write_ptr;
+	next_slot(msgq, &msgq->write_ptr);
+	msgq->held_msgs++;
+
+	return msgq->reserved_ptr;
+}
+
+static void *claim(struct k_msgq *msgq)
+{
+	msgq->claimed_ptr = msgq->read_ptr;
+	next_slot(msgq, &msgq->read_ptr);
+	msgq->used_msgs--;
+	msgq->held_msgs++;
+
+	return msgq->claimed_ptr;
+}
+
+/* Unpends the first thread that waits to send (or to receive) and could
+ * do so right now.
+ */
+static struct k_thread *unpend_waiter(struct k_msgq *msgq, bool sender)
+{
+	struct k_thread *thread;
+	struct k_thread *found = NULL;
+
+	LOCK_SCHED_SPINLOCK {
+		_WAIT_Q_FOR_EACH(&msgq->wait_q, thread) {
+			struct msgq_waiter *waiter = thread->base.swap_data;
+
+			if ((waiter->sender != sender) ||
+			    ((waiter->data == NULL) && !sender &&
+			     (msgq->claimed_ptr != NULL)) ||
+			    ((waiter->data == NULL) && sender &&
+			     (msgq->reserved_ptr != NULL))) {
+				continue;
+			}
+
+			unpend_thread_no_timeout(thread);
+			z_abort_thread_timeout(thread);
+			found = thread;
+			break;
+		}
+	}
+
+	return found;
+}
+
+static void serve_waiter(struct k_thread *thread, int result)
+{
+	arch_thread_return_value_set(thread, result);
+	z_ready_thread(thread);
+}
+
+/* Hands messages to pending readers and free slots to pending writers
+ * for as long as the queue state allows, returns true if any thread was
+ * woken up.
+ */
+static bool wake_waiters(struct k_msgq *msgq)
+{
+	struct k_thread *thread;
+	struct msgq_waiter *waiter;
+	bool woken = false;
+	bool progress;
+
+	do {
+		progress = false;
+
+		if (msgq->used_msgs > 0U) {
+			thread = unpend_waiter(msgq, false);
+			if (thread != NULL) {
+				waiter = thread->base.swap_data;
+				if (waiter->data != NULL) {
+					dequeue(msgq, waiter->data);
+				} else {
+					*waiter->slot = claim(msgq);
+				}
+				serve_waiter(thread, 0);
+				progress = true;
+			}
+		}
+
+		if (can_send(msgq)) {
+			thread = unpend_waiter(msgq, true);
+			if (thread != NULL) {
+				waiter = thread->base.swap_data;
+				if (waiter->data != NULL) {
+					enqueue(msgq, waiter->data);
+				} else {
+					*waiter->slot = reserve(msgq);
+				}
+				serve_waiter(thread, 0);
+				progress = true;
+			}
+		}
+
+		woken = woken || progress;
+	} while (progress);
+
+	return woken;
+}
+
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs)
 {
@@ -50,6 +218,10 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	msgq->read_ptr = buffer;
 	msgq->write_ptr = buffer;
 	msgq->used_msgs = 0;
+	msgq->reserved_ptr = NULL;
+	msgq->claimed_ptr = NULL;
+	msgq->held_msgs = 0;
+	msgq->pending_msgs = 0;
 	msgq->flags = 0;
 	z_waitq_init(&msgq->wait_q);
 	msgq->lock = (struct k_spinlock) {};
@@ -138,27 +310,34 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
 
-	if (msgq->used_msgs < msgq->max_msgs) {
-		/* message queue isn't full */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	if (can_send(msgq)) {
+		/* message queue isn't full, readers only get the message
+		 * directly when no reserved slot comes before it
+		 */
+		pending_thread = (msgq->reserved_ptr == NULL) ?
+				 unpend_waiter(msgq, false) : NULL;
 		if (unlikely(pending_thread != NULL)) {
+			struct msgq_waiter *waiter = pending_thread->base.swap_data;
+
+			__ASSERT_NO_MSG(msgq->used_msgs == 0U);
 			resched = true;
 
-			/* give message to waiting thread */
-			(void)memcpy(pending_thread->base.swap_data, data, msgq->msg_size);
+			if (waiter->data != NULL) {
+				/* give message to waiting thread */
+				(void)memcpy(waiter->data, data, msgq->msg_size);
+			} else {
+				/* hand over the slot of the message */
+				enqueue(msgq, data);
+				*waiter->slot = claim(msgq);
+			}
 			/* wake up waiting thread */
-			arch_thread_return_value_set(pending_thread, 0);
-			z_ready_thread(pending_thread);
+			serve_waiter(pending_thread, 0);
+		} else if (msgq->reserved_ptr != NULL) {
+			/* queue message behind the reserved slot */
+			enqueue(msgq, data);
 		} else {
 			/* put message in queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, (char *)data, msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
+			enqueue(msgq, data);
 			resched = handle_poll_events(msgq);
 		}
 		result = 0;
@@ -166,10 +345,15 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 		/* don't wait for message space to become available */
 		result = -ENOMSG;
 	} else {
+		struct msgq_waiter waiter = {
+			.data = (void *)data,
+			.sender = true,
+		};
+
 		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put, msgq, timeout);
 
 		/* wait for put message success, failure, or timeout */
-		_current->base.swap_data = (void *) data;
+		_current->base.swap_data = &waiter;
 
 		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
@@ -222,7 +406,6 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
 	k_spinlock_key_t key;
-	struct k_thread *pending_thread;
 	int result;
 	bool resched = false;
 
@@ -232,43 +415,27 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 
 	if (msgq->used_msgs > 0U) {
 		/* take first available message from queue */
-		(void)memcpy((char *)data, msgq->read_ptr, msgq->msg_size);
-		msgq->read_ptr += msgq->msg_size;
-		if (msgq->read_ptr == msgq->buffer_end) {
-			msgq->read_ptr = msgq->buffer_start;
-		}
-		msgq->used_msgs--;
+		dequeue(msgq, data);
 
-		/* handle first thread waiting to write (if any) */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
-		if (unlikely(pending_thread != NULL)) {
+		/* handle threads waiting to write (if any) */
+		resched = wake_waiters(msgq);
+		if (unlikely(resched)) {
 			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
-
-			/* add thread's message to queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, (char *)pending_thread->base.swap_data,
-			       msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
-
-			/* wake up waiting thread */
-			arch_thread_return_value_set(pending_thread, 0);
-			z_ready_thread(pending_thread);
-			resched = true;
 		}
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 		/* don't wait for a message to become available */
 		result = -ENOMSG;
 	} else {
+		struct msgq_waiter waiter = {
+			.data = data,
+			.sender = false,
+		};
+
 		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
 
 		/* wait for get message success or timeout */
-		_current->base.swap_data = data;
+		_current->base.swap_data = &waiter;
 
 		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
@@ -378,6 +545,201 @@ static inline int z_vrfy_k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_
 #include <zephyr/syscalls/k_msgq_peek_at_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_k_msgq_alloc_put(struct k_msgq *msgq, void **data, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, alloc_put, msgq, timeout);
+
+	if (can_reserve(msgq)) {
+		*data = reserve(msgq);
+		result = 0;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		struct msgq_waiter waiter = {
+			.slot = data,
+			.sender = true,
+		};
+
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, alloc_put, msgq, timeout);
+
+		_current->base.swap_data = &waiter;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, alloc_put, msgq, timeout, result);
+		return result;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, alloc_put, msgq, timeout, result);
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_alloc_put(struct k_msgq *msgq, void **data,
+					  k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(msgq->buffer_start,
+				      msgq->buffer_end - msgq->buffer_start));
+	/* Checked first, a slot reserved for a faulting caller would
+	 * never be committed.
+	 */
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(data, sizeof(*data)));
+
+	return z_impl_k_msgq_alloc_put(msgq, data, timeout);
+}
+#include <zephyr/syscalls/k_msgq_alloc_put_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_msgq_commit(struct k_msgq *msgq, void *data)
+{
+	k_spinlock_key_t key;
+	bool resched;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if ((data == NULL) || (data != msgq->reserved_ptr)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_msgq, commit, msgq, -EINVAL);
+		k_spin_unlock(&msgq->lock, key);
+
+		return -EINVAL;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC(k_msgq, commit, msgq, 0);
+
+	/* The messages sent behind the slot become readable along with it */
+	msgq->reserved_ptr = NULL;
+	msgq->held_msgs -= 1U + msgq->pending_msgs;
+	msgq->used_msgs += 1U + msgq->pending_msgs;
+	msgq->pending_msgs = 0;
+
+	resched = handle_poll_events(msgq);
+	resched = wake_waiters(msgq) || resched;
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_commit(struct k_msgq *msgq, void *data)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+
+	return z_impl_k_msgq_commit(msgq, data);
+}
+#include <zephyr/syscalls/k_msgq_commit_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_msgq_claim(struct k_msgq *msgq, void **data, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, claim, msgq, timeout);
+
+	if ((msgq->used_msgs > 0U) && (msgq->claimed_ptr == NULL)) {
+		*data = claim(msgq);
+		result = 0;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		struct msgq_waiter waiter = {
+			.slot = data,
+			.sender = false,
+		};
+
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, claim, msgq, timeout);
+
+		_current->base.swap_data = &waiter;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, claim, msgq, timeout, result);
+		return result;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, claim, msgq, timeout, result);
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_claim(struct k_msgq *msgq, void **data,
+				      k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_READ(msgq->buffer_start,
+				     msgq->buffer_end - msgq->buffer_start));
+	/* Checked first, a slot claimed for a faulting caller would
+	 * never be finished.
+	 */
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(data, sizeof(*data)));
+
+	return z_impl_k_msgq_claim(msgq, data, timeout);
+}
+#include <zephyr/syscalls/k_msgq_claim_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_msgq_finish(struct k_msgq *msgq, void *data)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if ((data == NULL) || (data != msgq->claimed_ptr)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_msgq, finish, msgq, -EINVAL);
+		k_spin_unlock(&msgq->lock, key);
+
+		return -EINVAL;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC(k_msgq, finish, msgq, 0);
+
+	/* Releases the claimed slot along with all slots read or purged
+	 * behind it meanwhile, only a reservation and the messages sent
+	 * behind it can still be held.
+	 */
+	msgq->claimed_ptr = NULL;
+	msgq->held_msgs = (msgq->reserved_ptr != NULL) ? 1U + msgq->pending_msgs : 0U;
+
+	if (wake_waiters(msgq)) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_finish(struct k_msgq *msgq, void *data)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+
+	return z_impl_k_msgq_finish(msgq, data);
+}
+#include <zephyr/syscalls/k_msgq_finish_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 void z_impl_k_msgq_purge(struct k_msgq *msgq)
 {
 	k_spinlock_key_t key;
@@ -397,8 +759,24 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 		resched = true;
 	}
 
+	/* Purged messages behind a claimed slot can only be reused once
+	 * that is finished, a reserved slot is kept and becomes the
+	 * first message once committed. The messages sent behind it are
+	 * dropped by moving the write pointer back next to it.
+	 */
+	if (msgq->claimed_ptr != NULL) {
+		msgq->held_msgs += msgq->used_msgs;
+	}
 	msgq->used_msgs = 0;
-	msgq->read_ptr = msgq->write_ptr;
+	if (msgq->reserved_ptr != NULL) {
+		msgq->held_msgs -= msgq->pending_msgs;
+		msgq->pending_msgs = 0;
+		msgq->write_ptr = msgq->reserved_ptr;
+		next_slot(msgq, &msgq->write_ptr);
+		msgq->read_ptr = msgq->reserved_ptr;
+	} else {
+		msgq->read_ptr = msgq->write_ptr;
+	}
 
 	if (resched) {
 		z_reschedule(&msgq->lock, key);
@@ -102,11 +102,57 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+static bool thread_is_running(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (*(struct k_thread *volatile *)&_kernel.cpus[i].current == thread) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * Spins with the global lock released for as long as the owner of the
+ * mutex keeps running on another CPU without releasing it, but no longer
+ * than CONFIG_MUTEX_ADAPTIVE_SPIN_US. The owner's priority is not raised
+ * meanwhile, this only happens if the caller ends up pending on the mutex.
+ * Returns with the lock taken again.
+ */
+static k_spinlock_key_t spin_on_owner(struct k_mutex *mutex, k_spinlock_key_t key)
+{
+	struct k_thread *owner = mutex->owner;
+	uint32_t limit = k_us_to_cyc_ceil32(CONFIG_MUTEX_ADAPTIVE_SPIN_US);
+	uint32_t start = k_cycle_get_32();
+
+	k_spin_unlock(&lock, key);
+
+	while ((*(struct k_thread *volatile *)&mutex->owner == owner) &&
+	       thread_is_running(owner) &&
+	       ((k_cycle_get_32() - start) < limit)) {
+		unsigned int k = arch_irq_lock();
+
+		arch_spin_relax(); /* Requires interrupts be masked */
+		arch_irq_unlock(k);
+	}
+
+	return k_spin_lock(&lock);
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
 	k_spinlock_key_t key;
 	bool resched = false;
+	k_timeout_t pend_timeout = timeout;
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	k_timepoint_t end;
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
 
 	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
 
@@ -142,6 +188,39 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		return -EBUSY;
 	}
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	end = sys_timepoint_calc(timeout);
+	key = spin_on_owner(mutex, key);
+
+	/* A released mutex with waiters is handed over to the first of
+	 * them, so an unlocked one can be taken without jumping the queue.
+	 */
+	if (mutex->lock_count == 0U) {
+		mutex->owner_orig_prio = _current->base.prio;
+		mutex->lock_count = 1U;
+		mutex->owner = _current;
+
+		LOG_DBG("%p took mutex %p after spinning, orig prio: %d",
+			_current, mutex, mutex->owner_orig_prio);
+
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
+
+		return 0;
+	}
+
+	/* The time spent spinning counts towards the timeout */
+	pend_timeout = sys_timepoint_timeout(end);
+	if (K_TIMEOUT_EQ(pend_timeout, K_NO_WAIT)) {
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, -EAGAIN);
+
+		return -EAGAIN;
+	}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
 
 	new_prio = new_prio_for_inheritance(_current->base.prio,
@@ -153,7 +232,7 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		resched = adjust_owner_prio(mutex, new_prio);
 	}
 
-	int got_mutex = z_pend_curr(&lock, key, &mutex->wait_q, timeout);
+	int got_mutex = z_pend_curr(&lock, key, &mutex->wait_q, pend_timeout);
 
 	LOG_DBG("on mutex %p got_mutex value: %d", mutex, got_mutex);
 
@@ -6,6 +6,7 @@
 #include <zephyr/init.h>
 #include <zephyr/kernel.h>
 #include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/math_extras.h>
 #include <ksched.h>
 #include <kthread.h>
 #include <wait_q.h>
@@ -69,6 +70,8 @@ void z_impl_k_pipe_init(struct k_pipe *pipe, uint8_t *buffer, size_t buffer_size
 	ring_buf_init(&pipe->buf, buffer_size, buffer);
 	pipe->flags = PIPE_FLAG_OPEN;
 	pipe->waiting = 0;
+	pipe->write_claimed = 0;
+	pipe->read_claimed = 0;
 
 	pipe->lock = (struct k_spinlock){};
 	z_waitq_init(&pipe->data);
@@ -84,18 +87,112 @@ void z_impl_k_pipe_init(struct k_pipe *pipe, uint8_t *buffer, size_t buffer_size
 	SYS_PORT_TRACING_OBJ_INIT(k_pipe, pipe, buffer, buffer_size);
 }
 
+/*
+ * Buffers a reader or writer transfers data to or from, and how much of
+ * them has been transferred so far.
+ *
+ * A reader waiting for data to be claimed with k_pipe_read_claim() has
+ * no buffers: writers wake it up and leave the data in the ring buffer.
+ */
 struct pipe_buf_spec {
-	uint8_t * const data;
-	const size_t len;
+	const struct k_pipe_iovec *iov;
+	size_t iovcnt;
+	size_t idx;
+	size_t off;
+	size_t len;
 	size_t used;
 };
 
-static size_t copy_to_pending_readers(struct k_pipe *pipe, bool *need_resched,
-				      const uint8_t *data, size_t len)
+static void spec_init(struct pipe_buf_spec *spec, const struct k_pipe_iovec *iov,
+		      size_t iovcnt)
+{
+	*spec = (struct pipe_buf_spec){ .iov = iov, .iovcnt = iovcnt };
+
+	for (size_t i = 0; i < iovcnt; i++) {
+		spec->len += iov[i].len;
+	}
+}
+
+/* Get the next contiguous part of the buffers not transferred yet. */
+static size_t spec_chunk(struct pipe_buf_spec *spec, uint8_t **ptr)
+{
+	while ((spec->idx < spec->iovcnt) && (spec->off == spec->iov[spec->idx].len)) {
+		spec->idx++;
+		spec->off = 0;
+	}
+
+	if (spec->idx == spec->iovcnt) {
+		return 0;
+	}
+
+	*ptr = (uint8_t *)spec->iov[spec->idx].base + spec->off;
+
+	return spec->iov[spec->idx].len - spec->off;
+}
+
+static inline void spec_advance(struct pipe_buf_spec *spec, size_t len)
+{
+	spec->off += len;
+	spec->used += len;
+}
+
+static size_t spec_copy(struct pipe_buf_spec *dst, struct pipe_buf_spec *src)
+{
+	uint8_t *to, *from;
+	size_t copied = 0;
+
+	for (;;) {
+		size_t to_len = spec_chunk(dst, &to);
+		size_t from_len = spec_chunk(src, &from);
+		size_t len = MIN(to_len, from_len);
+
+		if (len == 0) {
+			break;
+		}
+
+		memcpy(to, from, len);
+		spec_advance(dst, len);
+		spec_advance(src, len);
+		copied += len;
+	}
+
+	return copied;
+}
+
+static void spec_put(struct ring_buf *buf, struct pipe_buf_spec *src)
+{
+	uint8_t *from;
+	size_t len, put;
+
+	while ((len = spec_chunk(src, &from)) != 0) {
+		put = ring_buf_put(buf, from, len);
+		spec_advance(src, put);
+		if (put < len) {
+			break;
+		}
+	}
+}
+
+static void spec_get(struct ring_buf *buf, struct pipe_buf_spec *dst)
+{
+	uint8_t *to;
+	size_t len, got;
+
+	while ((len = spec_chunk(dst, &to)) != 0) {
+		got = ring_buf_get(buf, to, len);
+		spec_advance(dst, got);
+		if (got < len) {
+			break;
+		}
+	}
+}
+
+static void copy_to_pending_readers(struct k_pipe *pipe, bool *need_resched,
+				    struct pipe_buf_spec *src)
 {
 	struct k_thread *reader = NULL;
 	struct pipe_buf_spec *reader_buf;
-	size_t copy_size, written = 0;
+	bool claiming = false;
 
 	/*
 	 * Attempt a direct data copy to waiting readers if any.
@@ -113,12 +210,8 @@ static size_t copy_to_pending_readers(struct k_pipe *pipe, bool *need_resched,
 			}
 
 			reader_buf = reader->base.swap_data;
-			copy_size = MIN(len - written,
-					reader_buf->len - reader_buf->used);
-			memcpy(&reader_buf->data[reader_buf->used],
-			       &data[written], copy_size);
-			written += copy_size;
-			reader_buf->used += copy_size;
+			claiming = (reader_buf->len == 0);
+			(void)spec_copy(reader_buf, src);
 
 			if (reader_buf->used < reader_buf->len) {
 				/* This reader wants more: don't unpend. */
@@ -126,8 +219,9 @@ static size_t copy_to_pending_readers(struct k_pipe *pipe, bool *need_resched,
 			} else {
 				/*
 				 * This reader has received all the data
-				 * it was waiting for: wake it up with
-				 * the scheduler lock still held.
+				 * it was waiting for, or claims it from the
+				 * ring buffer: wake it up with the scheduler
+				 * lock still held.
 				 */
 				unpend_thread_no_timeout(reader);
 				z_abort_thread_timeout(reader);
@@ -139,21 +233,16 @@ static size_t copy_to_pending_readers(struct k_pipe *pipe, bool *need_resched,
 			z_ready_thread(reader);
 			*need_resched = true;
 		}
-	} while (reader != NULL && written < len);
-
-	return written;
+	} while (reader != NULL && !claiming && src->used < src->len);
 }
 
-int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_timeout_t timeout)
+static int pipe_write(struct k_pipe *pipe, struct pipe_buf_spec *src, k_timeout_t timeout)
 {
 	int rc;
-	size_t written = 0;
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 	bool need_resched = false;
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, write, pipe, data, len, timeout);
-
 	if (unlikely(pipe_resetting(pipe))) {
 		rc = -ECANCELED;
 		goto exit;
@@ -165,50 +254,56 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 			break;
 		}
 
-		if (pipe_empty(pipe)) {
-			if (IS_ENABLED(CONFIG_KERNEL_COHERENCE)) {
-				/*
-				 * Systems that enabled this option don't have
-				 * their stacks in coherent memory. Given our
-				 * pipe_buf_spec is stored on the stack, and
-				 * readers may also have their destination
-				 * buffer on their stack too, it is not worth
-				 * supporting direct-to-readers copy with them.
-				 * Simply wake up all pending readers instead.
-				 */
-				need_resched = z_sched_wake_all(&pipe->data, 0, NULL);
-			} else if (pipe->waiting != 0) {
-				written += copy_to_pending_readers(pipe, &need_resched,
-								   &data[written],
-								   len - written);
-				if (written >= len) {
-					rc = written;
-					break;
+		/* A region claimed by k_pipe_write_claim() goes first */
+		if (likely(pipe->write_claimed == 0) || (src->len == 0)) {
+			if (pipe_empty(pipe)) {
+				if (IS_ENABLED(CONFIG_KERNEL_COHERENCE)) {
+					/*
+					 * Systems that enabled this option don't have
+					 * their stacks in coherent memory. Given our
+					 * pipe_buf_spec is stored on the stack, and
+					 * readers may also have their destination
+					 * buffer on their stack too, it is not worth
+					 * supporting direct-to-readers copy with them.
+					 * Simply wake up all pending readers instead.
+					 */
+					need_resched = z_sched_wake_all(&pipe->data, 0, NULL);
+				} else if ((pipe->waiting != 0) && (pipe->read_claimed == 0)) {
+					/*
+					 * While a region is claimed for reading, the
+					 * part of it that is not finished goes back
+					 * to the ring buffer ahead of this data, so
+					 * readers must not get it directly.
+					 */
+					copy_to_pending_readers(pipe, &need_resched, src);
+					if (src->used >= src->len) {
+						rc = src->used;
+						break;
+					}
 				}
 			}
-		}
 
 #ifdef CONFIG_POLL
-		need_resched |= z_handle_obj_poll_events(&pipe->poll_events,
-							 K_POLL_STATE_PIPE_DATA_AVAILABLE);
+			need_resched |= z_handle_obj_poll_events(&pipe->poll_events,
+								 K_POLL_STATE_PIPE_DATA_AVAILABLE);
 #endif /* CONFIG_POLL */
 
-		written += ring_buf_put(&pipe->buf, &data[written], len - written);
-		if (likely(written == len)) {
-			rc = written;
-			break;
+			spec_put(&pipe->buf, src);
+			if (likely(src->used == src->len)) {
+				rc = src->used;
+				break;
+			}
 		}
 
 		rc = wait_for(&pipe->space, pipe, &key, end, &need_resched);
 		if (rc != 0) {
 			if (rc == -EAGAIN) {
-				rc = written ? written : -EAGAIN;
+				rc = src->used ? src->used : -EAGAIN;
 			}
 			break;
 		}
 	}
 exit:
-	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, write, pipe, rc);
 	if (need_resched) {
 		z_reschedule(&pipe->lock, key);
 	} else {
@@ -217,16 +312,13 @@ exit:
 	return rc;
 }
 
-int z_impl_k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len, k_timeout_t timeout)
+static int pipe_read(struct k_pipe *pipe, struct pipe_buf_spec *dst, k_timeout_t timeout)
 {
-	struct pipe_buf_spec buf = { data, len, 0 };
 	int rc;
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 	bool need_resched = false;
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, read, pipe, data, len, timeout);
-
 	if (unlikely(pipe_resetting(pipe))) {
 		rc = -ECANCELED;
 		goto exit;
@@ -238,43 +330,349 @@ int z_impl_k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len, k_timeout
 			need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
 		}
 
-		buf.used += ring_buf_get(&pipe->buf, &data[buf.used], len - buf.used);
-		if (likely(buf.used == len)) {
-			rc = buf.used;
-			break;
+		/* A region claimed by k_pipe_read_claim() goes first */
+		if (likely(pipe->read_claimed == 0) || (dst->len == 0)) {
+			spec_get(&pipe->buf, dst);
+			if (likely(dst->used == dst->len)) {
+				rc = dst->used;
+				break;
+			}
 		}
 
-		if (unlikely(pipe_closed(pipe))) {
-			rc = buf.used ? buf.used : -EPIPE;
+		if (unlikely(pipe_closed(pipe)) &&
+		    ((pipe->read_claimed == 0) || pipe_empty(pipe))) {
+			rc = dst->used ? dst->used : -EPIPE;
 			break;
 		}
 
 		/* provide our "direct copy" info to potential writers */
-		_current->base.swap_data = &buf;
+		_current->base.swap_data = dst;
 
 		rc = wait_for(&pipe->data, pipe, &key, end, &need_resched);
 		if (rc != 0) {
 			if (rc == -EAGAIN) {
-				rc = buf.used ? buf.used : -EAGAIN;
+				rc = dst->used ? dst->used : -EAGAIN;
 			}
 			break;
 		}
 	}
 exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
+int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_timeout_t timeout)
+{
+	const struct k_pipe_iovec iov = { .base = (void *)data, .len = len };
+	struct pipe_buf_spec src;
+	int rc;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, write, pipe, data, len, timeout);
+
+	spec_init(&src, &iov, 1);
+	rc = pipe_write(pipe, &src, timeout);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, write, pipe, rc);
+
+	return rc;
+}
+
+int z_impl_k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len, k_timeout_t timeout)
+{
+	const struct k_pipe_iovec iov = { .base = data, .len = len };
+	struct pipe_buf_spec dst;
+	int rc;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, read, pipe, data, len, timeout);
+
+	spec_init(&dst, &iov, 1);
+	rc = pipe_read(pipe, &dst, timeout);
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, read, pipe, rc);
+
+	return rc;
+}
+
+int z_impl_k_pipe_writev(struct k_pipe *pipe, const struct k_pipe_iovec *iov, size_t iovcnt,
+			 k_timeout_t timeout)
+{
+	struct pipe_buf_spec src;
+	int rc;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, writev, pipe, iov, iovcnt, timeout);
+
+	spec_init(&src, iov, iovcnt);
+	rc = pipe_write(pipe, &src, timeout);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, writev, pipe, rc);
+
+	return rc;
+}
+
+int z_impl_k_pipe_readv(struct k_pipe *pipe, const struct k_pipe_iovec *iov, size_t iovcnt,
+			k_timeout_t timeout)
+{
+	struct pipe_buf_spec dst;
+	int rc;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, readv, pipe, iov, iovcnt, timeout);
+
+	spec_init(&dst, iov, iovcnt);
+	rc = pipe_read(pipe, &dst, timeout);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, readv, pipe, rc);
+
+	return rc;
+}
+
+int z_impl_k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+			      k_timeout_t timeout)
+{
+	int rc;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	bool need_resched = false;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, write_claim, pipe, len, timeout);
+
+	key = k_spin_lock(&pipe->lock);
+
+	if (unlikely(pipe->buf.size == 0U)) {
+		rc = -ENOTSUP;
+		goto exit;
+	}
+
+	if (unlikely(len == 0)) {
+		rc = 0;
+		goto exit;
+	}
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	for (;;) {
+		if (unlikely(pipe_closed(pipe))) {
+			rc = -EPIPE;
+			break;
+		}
+
+		if ((pipe->write_claimed == 0) && !pipe_full(pipe)) {
+			pipe->write_claimed = ring_buf_put_claim(&pipe->buf, data,
+								 MIN(len, UINT32_MAX));
+			rc = pipe->write_claimed;
+			break;
+		}
+
+		rc = wait_for(&pipe->space, pipe, &key, end, &need_resched);
+		if (rc != 0) {
+			break;
+		}
+	}
+exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, write_claim, pipe, rc);
+
+	return rc;
+}
+
+int z_impl_k_pipe_write_commit(struct k_pipe *pipe, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched;
+	int rc = 0;
+
+	if ((pipe->write_claimed == 0) ||
+	    ((len > pipe->write_claimed) &&
+	     ((pipe->flags & PIPE_FLAG_WRITE_CANCELED) == 0))) {
+		k_spin_unlock(&pipe->lock, key);
+		SYS_PORT_TRACING_OBJ_FUNC(k_pipe, write_commit, pipe, len, -EINVAL);
+		return -EINVAL;
+	}
+
+	if (unlikely((pipe->flags & PIPE_FLAG_WRITE_CANCELED) != 0)) {
+		/* The pipe was reset since the claim: drop the data */
+		pipe->flags &= ~PIPE_FLAG_WRITE_CANCELED;
+		len = 0;
+		rc = -ECANCELED;
+	} else if (unlikely(pipe_closed(pipe))) {
+		len = 0;
+		rc = -EPIPE;
+	}
+
+	(void)ring_buf_put_finish(&pipe->buf, len);
+	pipe->write_claimed = 0;
+
+	/* Writers held back by the claim may go ahead */
+	need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
+
+	if (len > 0) {
+		need_resched |= z_sched_wake_all(&pipe->data, 0, NULL);
+#ifdef CONFIG_POLL
+		need_resched |= z_handle_obj_poll_events(&pipe->poll_events,
+							 K_POLL_STATE_PIPE_DATA_AVAILABLE);
+#endif /* CONFIG_POLL */
+	}
+
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC(k_pipe, write_commit, pipe, len, rc);
+
+	return rc;
+}
+
+int z_impl_k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+			     k_timeout_t timeout)
+{
+	struct pipe_buf_spec claim = { 0 };
+	int rc;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	bool need_resched = false;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, read_claim, pipe, len, timeout);
+
+	key = k_spin_lock(&pipe->lock);
+
+	if (unlikely(pipe->buf.size == 0U)) {
+		rc = -ENOTSUP;
+		goto exit;
+	}
+
+	if (unlikely(len == 0)) {
+		rc = 0;
+		goto exit;
+	}
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	for (;;) {
+		if ((pipe->read_claimed == 0) && !pipe_empty(pipe)) {
+			pipe->read_claimed = ring_buf_get_claim(&pipe->buf, data,
+								MIN(len, UINT32_MAX));
+			rc = pipe->read_claimed;
+			break;
+		}
+
+		if (unlikely(pipe_closed(pipe)) && pipe_empty(pipe)) {
+			rc = -EPIPE;
+			break;
+		}
+
+		/* writers wake us up without copying anything */
+		_current->base.swap_data = &claim;
+
+		rc = wait_for(&pipe->data, pipe, &key, end, &need_resched);
+		if (rc != 0) {
+			break;
+		}
+	}
+exit:
 	if (need_resched) {
 		z_reschedule(&pipe->lock, key);
 	} else {
 		k_spin_unlock(&pipe->lock, key);
 	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, read_claim, pipe, rc);
+
 	return rc;
 }
 
+int z_impl_k_pipe_read_finish(struct k_pipe *pipe, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+	int rc = 0;
+
+	if ((pipe->read_claimed == 0) ||
+	    ((len > pipe->read_claimed) &&
+	     ((pipe->flags & PIPE_FLAG_READ_CANCELED) == 0))) {
+		k_spin_unlock(&pipe->lock, key);
+		SYS_PORT_TRACING_OBJ_FUNC(k_pipe, read_finish, pipe, len, -EINVAL);
+		return -EINVAL;
+	}
+
+	if (unlikely((pipe->flags & PIPE_FLAG_READ_CANCELED) != 0)) {
+		/* The claim covers all data discarded by the reset */
+		pipe->flags &= ~PIPE_FLAG_READ_CANCELED;
+		len = pipe->read_claimed;
+		rc = -ECANCELED;
+	}
+
+	(void)ring_buf_get_finish(&pipe->buf, len);
+	pipe->read_claimed = 0;
+
+	if (len > 0) {
+		need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
+	}
+
+	/* Readers held back by the claim may go ahead */
+	if (!pipe_empty(pipe) || pipe_closed(pipe)) {
+		need_resched |= z_sched_wake_all(&pipe->data, 0, NULL);
+	}
+
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC(k_pipe, read_finish, pipe, len, rc);
+
+	return rc;
+}
+
+/*
+ * Discard the data in the pipe. Claimed regions stay reserved until they
+ * are committed or finished, which then fails with -ECANCELED.
+ */
+static void pipe_discard_locked(struct k_pipe *pipe)
+{
+	uint8_t *unused;
+
+	if (likely((pipe->write_claimed == 0) && (pipe->read_claimed == 0))) {
+		ring_buf_reset(&pipe->buf);
+		return;
+	}
+
+	if (pipe->write_claimed != 0) {
+		pipe->flags |= PIPE_FLAG_WRITE_CANCELED;
+	}
+
+	if (pipe->read_claimed != 0) {
+		pipe->flags |= PIPE_FLAG_READ_CANCELED;
+		while (!pipe_empty(pipe)) {
+			pipe->read_claimed += ring_buf_get_claim(&pipe->buf, &unused,
+								 UINT32_MAX);
+		}
+	} else {
+		(void)ring_buf_get(&pipe->buf, NULL, UINT32_MAX);
+	}
+}
+
 void z_impl_k_pipe_reset(struct k_pipe *pipe)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, reset, pipe);
 	K_SPINLOCK(&pipe->lock) {
-		ring_buf_reset(&pipe->buf);
+		pipe_discard_locked(pipe);
 		if (likely(pipe->waiting != 0)) {
 			pipe->flags |= PIPE_FLAG_RESET;
 			z_sched_wake_all(&pipe->data, 0, NULL);
@@ -288,7 +686,7 @@ void z_impl_k_pipe_close(struct k_pipe *pipe)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, close, pipe);
 	K_SPINLOCK(&pipe->lock) {
-		pipe->flags = 0;
+		pipe->flags &= ~(PIPE_FLAG_OPEN | PIPE_FLAG_RESET);
 		z_sched_wake_all(&pipe->data, 0, NULL);
 		z_sched_wake_all(&pipe->space, 0, NULL);
 	}
@@ -323,6 +721,112 @@ int z_vrfy_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 }
 #include <zephyr/syscalls/k_pipe_write_mrsh.c>
 
+static int pipe_iov_from_user(struct k_pipe_iovec **copy, const struct k_pipe_iovec *iov,
+			      size_t iovcnt, bool write)
+{
+	size_t size;
+	int ret;
+
+	*copy = NULL;
+	if (iovcnt == 0) {
+		return 0;
+	}
+
+	K_OOPS(K_SYSCALL_VERIFY_MSG(!size_mul_overflow(iovcnt, sizeof(*iov), &size),
+				    "iovcnt %zu too large", iovcnt));
+
+	*copy = z_thread_malloc(size);
+	if (*copy == NULL) {
+		return -ENOMEM;
+	}
+
+	ret = k_usermode_from_copy(*copy, iov, size);
+	for (size_t i = 0; (i < iovcnt) && (ret == 0); i++) {
+		ret = K_SYSCALL_MEMORY((*copy)[i].base, (*copy)[i].len, write);
+	}
+
+	if (ret != 0) {
+		k_free(*copy);
+		K_OOPS(ret);
+	}
+
+	return 0;
+}
+
+int z_vrfy_k_pipe_writev(struct k_pipe *pipe, const struct k_pipe_iovec *iov, size_t iovcnt,
+			 k_timeout_t timeout)
+{
+	struct k_pipe_iovec *copy;
+	int rc;
+
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+
+	rc = pipe_iov_from_user(&copy, iov, iovcnt, false);
+	if (rc == 0) {
+		rc = z_impl_k_pipe_writev(pipe, copy, iovcnt, timeout);
+		k_free(copy);
+	}
+
+	return rc;
+}
+#include <zephyr/syscalls/k_pipe_writev_mrsh.c>
+
+int z_vrfy_k_pipe_readv(struct k_pipe *pipe, const struct k_pipe_iovec *iov, size_t iovcnt,
+			k_timeout_t timeout)
+{
+	struct k_pipe_iovec *copy;
+	int rc;
+
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+
+	rc = pipe_iov_from_user(&copy, iov, iovcnt, true);
+	if (rc == 0) {
+		rc = z_impl_k_pipe_readv(pipe, copy, iovcnt, timeout);
+		k_free(copy);
+	}
+
+	return rc;
+}
+#include <zephyr/syscalls/k_pipe_readv_mrsh.c>
+
+int z_vrfy_k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+			      k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(pipe->buf.buffer, pipe->buf.size));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(data, sizeof(*data)));
+
+	return z_impl_k_pipe_write_claim(pipe, data, len, timeout);
+}
+#include <zephyr/syscalls/k_pipe_write_claim_mrsh.c>
+
+int z_vrfy_k_pipe_write_commit(struct k_pipe *pipe, size_t len)
+{
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+
+	return z_impl_k_pipe_write_commit(pipe, len);
+}
+#include <zephyr/syscalls/k_pipe_write_commit_mrsh.c>
+
+int z_vrfy_k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+			     k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+	K_OOPS(K_SYSCALL_MEMORY_READ(pipe->buf.buffer, pipe->buf.size));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(data, sizeof(*data)));
+
+	return z_impl_k_pipe_read_claim(pipe, data, len, timeout);
+}
+#include <zephyr/syscalls/k_pipe_read_claim_mrsh.c>
+
+int z_vrfy_k_pipe_read_finish(struct k_pipe *pipe, size_t len)
+{
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+
+	return z_impl_k_pipe_read_finish(pipe, len);
+}
+#include <zephyr/syscalls/k_pipe_read_finish_mrsh.c>
+
 void z_vrfy_k_pipe_reset(struct k_pipe *pipe)
 {
 	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
@@ -35,10 +35,11 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+static int signal_poll_set(struct k_poll_event *event, uint32_t state);
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -112,6 +113,23 @@ static struct k_thread *poller_thread(struct z_poller *p)
 	return p ? CONTAINER_OF(p, struct k_thread, poller) : NULL;
 }
 
+/* Poll sets have no thread of their own: they are signaled after all the
+ * threads polling the same object.
+ */
+static inline bool poller_goes_before(struct z_poller *poller,
+				      struct z_poller *other)
+{
+	if (poller->mode == MODE_SET) {
+		return false;
+	}
+
+	if (other->mode == MODE_SET) {
+		return true;
+	}
+
+	return z_sched_prio_cmp(poller_thread(poller), poller_thread(other)) > 0;
+}
+
 static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 			     struct z_poller *poller)
 {
@@ -119,15 +137,13 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
 	if ((pending == NULL) ||
-		(z_sched_prio_cmp(poller_thread(pending->poller),
-							   poller_thread(poller)) > 0)) {
+	    !poller_goes_before(poller, pending->poller)) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if (poller_goes_before(poller, pending->poller)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -441,6 +457,11 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 	int retcode = 0;
 
 	if (poller != NULL) {
+		if (poller->mode == MODE_SET) {
+			/* Set events stay registered with their set */
+			return signal_poll_set(event, state);
+		}
+
 		if (poller->mode == MODE_POLL) {
 			retcode = signal_poller(event, state);
 		} else if (poller->mode == MODE_TRIGGERED) {
@@ -812,3 +833,176 @@ int k_work_poll_cancel(struct k_work_poll *work)
 
 	return retval;
 }
+
+/* must be called with interrupts locked */
+static int signal_poll_set(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set =
+		CONTAINER_OF(event->poller, struct k_poll_set, poller);
+
+	/*
+	 * The event has just been taken off its object: queue it for the
+	 * next wait on the set, which checks whether it is still ready.
+	 */
+	event->state = state;
+	sys_dlist_append(&set->signaled, &event->_node);
+	(void)z_sched_wake(&set->wait_q, 0, NULL);
+
+	return 0;
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	set->poller.is_polling = true;
+	set->poller.mode = MODE_SET;
+	sys_dlist_init(&set->signaled);
+	sys_dlist_init(&set->ready);
+	z_waitq_init(&set->wait_q);
+}
+
+void k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint32_t state;
+
+	__ASSERT(event->mode == K_POLL_MODE_NOTIFY_ONLY,
+		 "only NOTIFY_ONLY mode is supported\n");
+
+	/* Types that register nothing, like K_POLL_TYPE_IGNORE, never link
+	 * the node, k_poll_set_remove() must still find it unlinked.
+	 */
+	sys_dnode_init(&event->_node);
+	event->poller = &set->poller;
+	if (is_condition_met(event, &state)) {
+		(void)signal_poll_set(event, state);
+	} else {
+		event->state = K_POLL_STATE_NOT_READY;
+		register_event(event, &set->poller);
+	}
+
+	z_reschedule(&lock, key);
+}
+
+void k_poll_set_arm(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	__ASSERT(event->mode == K_POLL_MODE_NOTIFY_ONLY,
+		 "only NOTIFY_ONLY mode is supported\n");
+
+	sys_dnode_init(&event->_node);
+	event->state = K_POLL_STATE_NOT_READY;
+	register_event(event, &set->poller);
+
+	k_spin_unlock(&lock, key);
+}
+
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (event->poller != &set->poller) {
+		k_spin_unlock(&lock, key);
+
+		return -EINVAL;
+	}
+
+	/* Off its object, or off one of the set's lists */
+	event->poller = NULL;
+	if (sys_dnode_is_linked(&event->_node)) {
+		sys_dlist_remove(&event->_node);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+/* must be called with interrupts locked */
+static int poll_set_collect(struct k_poll_set *set,
+			    struct k_poll_event **events, int num_events)
+{
+	struct k_poll_event *event;
+	sys_dlist_t reported;
+	sys_dnode_t *node;
+	int count = 0;
+
+	/*
+	 * Events handed back by the previous wait are on the ready list
+	 * and are checked again, after the ones signaled since then: an
+	 * event stays ready for as long as its condition is met, and goes
+	 * back to its object once it is not.
+	 */
+	sys_dlist_init(&reported);
+	while ((node = sys_dlist_get(&set->ready)) != NULL) {
+		sys_dlist_append(&reported, node);
+	}
+
+	while (count < num_events) {
+		bool cancelled = false;
+		uint32_t state = 0;
+		bool met;
+
+		node = sys_dlist_get(&set->signaled);
+		if (node != NULL) {
+			event = CONTAINER_OF(node, struct k_poll_event, _node);
+			cancelled = (event->state & K_POLL_STATE_CANCELLED) != 0U;
+		} else {
+			node = sys_dlist_get(&reported);
+			if (node == NULL) {
+				break;
+			}
+			event = CONTAINER_OF(node, struct k_poll_event, _node);
+		}
+
+		met = is_condition_met(event, &state);
+		if (met || cancelled) {
+			event->state = state |
+				(cancelled ? K_POLL_STATE_CANCELLED : 0U);
+			sys_dlist_append(&set->ready, node);
+			events[count++] = event;
+		} else {
+			event->state = K_POLL_STATE_NOT_READY;
+			register_event(event, &set->poller);
+		}
+	}
+
+	/* Whatever did not fit in the events array waits for the next call */
+	while ((node = sys_dlist_get(&reported)) != NULL) {
+		sys_dlist_append(&set->ready, node);
+	}
+
+	return count;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **events,
+		    int num_events, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+	__ASSERT(events != NULL, "NULL events\n");
+	__ASSERT(num_events > 0, "no room for events\n");
+
+	key = k_spin_lock(&lock);
+	for (;;) {
+		ret = poll_set_collect(set, events, num_events);
+		if (ret > 0) {
+			break;
+		}
+
+		timeout = sys_timepoint_timeout(end);
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			ret = -EAGAIN;
+			break;
+		}
+
+		(void)z_pend_curr(&lock, key, &set->wait_q, timeout);
+		key = k_spin_lock(&lock);
+	}
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
@@ -369,6 +369,73 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 	return (ret != 0) ? NULL : _current->base.swap_data;
 }
 
+static size_t queue_get_batch_locked(struct k_queue *queue, void **out, size_t max)
+{
+	size_t count = 0;
+
+	while ((count < max) && !sys_sflist_is_empty(&queue->data_q)) {
+		sys_sfnode_t *node = sys_sflist_get_not_empty(&queue->data_q);
+
+		out[count] = z_queue_node_peek(node, true);
+		count++;
+	}
+
+	return count;
+}
+
+size_t z_impl_k_queue_get_batch(struct k_queue *queue, void **out, size_t max,
+				k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	size_t count;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, get_batch, queue, timeout);
+
+	if (unlikely(max == 0U)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get_batch, queue, timeout, 0);
+
+		return 0;
+	}
+
+	key = k_spin_lock(&queue->lock);
+
+	count = queue_get_batch_locked(queue, out, max);
+	if (likely(count != 0U) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&queue->lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get_batch, queue, timeout, count);
+
+		return count;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_queue, get_batch, queue, timeout);
+
+	int ret = z_pend_curr(&queue->lock, key, &queue->wait_q, timeout);
+
+	/* A cancelled wait is woken up without a data item */
+	if ((ret != 0) || (_current->base.swap_data == NULL)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get_batch, queue, timeout, 0);
+
+		return 0;
+	}
+
+	out[0] = _current->base.swap_data;
+	count = 1;
+
+	/* The waker handed over a single data item, pick up whatever was
+	 * added to the queue while this thread was waking up.
+	 */
+	if (max > 1U) {
+		key = k_spin_lock(&queue->lock);
+		count += queue_get_batch_locked(queue, &out[1], max - 1U);
+		k_spin_unlock(&queue->lock, key);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get_batch, queue, timeout, count);
+
+	return count;
+}
+
 bool k_queue_remove(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, remove, queue);
@@ -428,6 +495,15 @@ static inline void *z_vrfy_k_queue_get(struct k_queue *queue,
 }
 #include <zephyr/syscalls/k_queue_get_mrsh.c>
 
+static inline size_t z_vrfy_k_queue_get_batch(struct k_queue *queue, void **out,
+					      size_t max, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(queue, K_OBJ_QUEUE));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(out, max, sizeof(void *)));
+	return z_impl_k_queue_get_batch(queue, out, max, timeout);
+}
+#include <zephyr/syscalls/k_queue_get_batch_mrsh.c>
+
 static inline int z_vrfy_k_queue_is_empty(struct k_queue *queue)
 {
 	K_OOPS(K_SYSCALL_OBJ(queue, K_OBJ_QUEUE));
@@ -0,0 +1,586 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file @brief reader-writer lock kernel services
+ *
+ * Readers and writers wait on separate priority ordered wait queues. A
+ * reader is only admitted while no writer holds the lock and no waiting
+ * writer has at least its priority, which keeps a steady flow of readers
+ * from starving writers without letting a writer hold up more important
+ * readers. When the lock becomes free it goes to the best waiting writer,
+ * or to all waiting readers that are more important than that writer.
+ *
+ * With CONFIG_RWLOCK_PERCPU_READERS readers are counted per CPU. Taking
+ * or releasing the lock for reading then only touches the local CPU's
+ * counter, as long as write_pending shows that no writer holds or waits
+ * for the lock. A writer raises write_pending before it sums up the
+ * counters, and a reader increments its counter before it checks
+ * write_pending, so one of them always sees the other. Readers that lose
+ * this race back off and take the slow path under the lock. A reader
+ * released on a CPU whose counter is already zero took the lock on
+ * another CPU, or never took it; the lock is then taken to find out which.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/iterable_sections.h>
+#include <ksched.h>
+#include <wait_q.h>
+#include <errno.h>
+#include <string.h>
+#include <zephyr/init.h>
+#include <zephyr/internal/syscall_handler.h>
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+static struct k_obj_type obj_type_rwlock;
+#endif /* CONFIG_OBJ_CORE_RWLOCK */
+
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+#define STATS_INC(rwlock, field) ((rwlock)->stats.field++)
+#else
+#define STATS_INC(rwlock, field) do { } while (false)
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+
+#ifdef CONFIG_RWLOCK_PERCPU_READERS
+static bool readers_active(struct k_rwlock *rwlock)
+{
+	atomic_val_t readers = 0;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		readers += atomic_get(&rwlock->cpu[i].readers);
+	}
+
+	return readers != 0;
+}
+
+/* Lock held */
+static void add_reader(struct k_rwlock *rwlock)
+{
+	struct z_rwlock_cpu *cpu = &rwlock->cpu[_current_cpu->id];
+
+	atomic_inc(&cpu->readers);
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	cpu->read_locks++;
+#endif
+}
+
+/* Lock held */
+static void update_write_pending(struct k_rwlock *rwlock)
+{
+	atomic_set(&rwlock->write_pending,
+		   (rwlock->writer != NULL) ||
+		   (z_waitq_head(&rwlock->write_wait_q) != NULL));
+}
+#else
+static inline bool readers_active(struct k_rwlock *rwlock)
+{
+	return rwlock->readers != 0U;
+}
+
+static inline void add_reader(struct k_rwlock *rwlock)
+{
+	rwlock->readers++;
+	STATS_INC(rwlock, read_locks);
+}
+
+static inline void update_write_pending(struct k_rwlock *rwlock)
+{
+	ARG_UNUSED(rwlock);
+}
+#endif /* CONFIG_RWLOCK_PERCPU_READERS */
+
+static inline void wake(struct k_thread *thread)
+{
+	arch_thread_return_value_set(thread, 0);
+	z_ready_thread(thread);
+}
+
+/* Lock held. Returns whether a reader of the current thread's priority
+ * may take the lock now.
+ */
+static bool read_admissible(struct k_rwlock *rwlock)
+{
+	struct k_thread *writer = z_waitq_head(&rwlock->write_wait_q);
+
+	return (rwlock->writer == NULL) &&
+	       ((writer == NULL) ||
+		z_is_prio_higher(_current->base.prio, writer->base.prio));
+}
+
+/* Lock held, the lock not held for writing. Hands the lock over to the
+ * waiting threads entitled to it, returns true if any was woken up.
+ */
+static bool wake_waiters(struct k_rwlock *rwlock)
+{
+	struct k_thread *writer = z_waitq_head(&rwlock->write_wait_q);
+	struct k_thread *reader = z_waitq_head(&rwlock->read_wait_q);
+	bool woken = false;
+
+	if ((writer != NULL) &&
+	    ((reader == NULL) ||
+	     !z_is_prio_higher(reader->base.prio, writer->base.prio))) {
+		/* The writer goes first, once the readers are done */
+		if (!readers_active(rwlock)) {
+			writer = z_unpend_first_thread(&rwlock->write_wait_q);
+			rwlock->writer = writer;
+			STATS_INC(rwlock, write_locks);
+			wake(writer);
+			woken = true;
+		}
+	} else {
+		/* Readers more important than any waiting writer */
+		while ((reader != NULL) &&
+		       ((writer == NULL) ||
+			z_is_prio_higher(reader->base.prio, writer->base.prio))) {
+			reader = z_unpend_first_thread(&rwlock->read_wait_q);
+			add_reader(rwlock);
+			wake(reader);
+			woken = true;
+			reader = z_waitq_head(&rwlock->read_wait_q);
+		}
+	}
+
+	update_write_pending(rwlock);
+
+	return woken;
+}
+
+int z_impl_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	rwlock->lock = (struct k_spinlock) {};
+	z_waitq_init(&rwlock->read_wait_q);
+	z_waitq_init(&rwlock->write_wait_q);
+	rwlock->writer = NULL;
+
+#ifdef CONFIG_RWLOCK_PERCPU_READERS
+	atomic_clear(&rwlock->write_pending);
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		rwlock->cpu[i] = (struct z_rwlock_cpu) {};
+	}
+#else
+	rwlock->readers = 0U;
+#endif /* CONFIG_RWLOCK_PERCPU_READERS */
+
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	rwlock->stats = (struct k_rwlock_stats) {};
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+
+	k_object_init(rwlock);
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+	k_obj_core_init_and_link(K_OBJ_CORE(rwlock), &obj_type_rwlock);
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	k_obj_core_stats_register(K_OBJ_CORE(rwlock), &rwlock->stats,
+				  sizeof(struct k_rwlock_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+#endif /* CONFIG_OBJ_CORE_RWLOCK */
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ_INIT(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_init(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_init_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#ifdef CONFIG_RWLOCK_PERCPU_READERS
+/* Hands the lock over to a waiting writer once the readers are done */
+static void read_release(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key;
+
+	if (atomic_get(&rwlock->write_pending) == 0) {
+		return;
+	}
+
+	key = k_spin_lock(&rwlock->lock);
+
+	if ((rwlock->writer == NULL) && wake_waiters(rwlock)) {
+		z_reschedule(&rwlock->lock, key);
+	} else {
+		k_spin_unlock(&rwlock->lock, key);
+	}
+}
+
+static bool read_lock_fast(struct k_rwlock *rwlock)
+{
+	unsigned int key = arch_irq_lock();
+	struct z_rwlock_cpu *cpu = &rwlock->cpu[_current_cpu->id];
+	bool taken;
+
+	atomic_inc(&cpu->readers);
+	taken = (atomic_get(&rwlock->write_pending) == 0);
+	if (taken) {
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+		cpu->read_locks++;
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+	} else {
+		/* Back off on the same counter */
+		atomic_dec(&cpu->readers);
+	}
+
+	arch_irq_unlock(key);
+
+	if (!taken) {
+		/* A writer may have counted this reader and gone to sleep */
+		read_release(rwlock);
+	}
+
+	return taken;
+}
+
+/* Takes one reader off @a readers unless it holds none */
+static bool take_reader(atomic_t *readers)
+{
+	atomic_val_t old;
+
+	do {
+		old = atomic_get(readers);
+		if (old <= 0) {
+			return false;
+		}
+	} while (!atomic_cas(readers, old, old - 1));
+
+	return true;
+}
+
+/* Lock held. Takes the reader off whichever CPU counted it, returns
+ * false if no CPU counts any reader.
+ */
+static bool take_reader_any_cpu(struct k_rwlock *rwlock)
+{
+	bool taken = false;
+
+	/* With new readers held off the fast path, the counters can only
+	 * go down while they are scanned, so a reader this thread holds
+	 * cannot be missed.
+	 */
+	atomic_set(&rwlock->write_pending, 1);
+
+	for (unsigned int i = 0; (i < CONFIG_MP_MAX_NUM_CPUS) && !taken; i++) {
+		taken = take_reader(&rwlock->cpu[i].readers);
+	}
+
+	update_write_pending(rwlock);
+
+	return taken;
+}
+
+static int read_unlock_fast(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key;
+	bool taken;
+
+	/* read_lock_fast() increments the counter of the CPU it reads the
+	 * id of with interrupts locked, so it cannot move in between. Here
+	 * a reader may have moved since then, or move right after reading
+	 * the id, and take itself off another CPU's counter than the one
+	 * it incremented. That is fine: a counter only says how many
+	 * readers took the lock on that CPU, not which ones, and the
+	 * writers only look at the sum, which still drops by one. If the
+	 * counter of this CPU is zero, the slow path takes the reader off
+	 * any CPU that counts one.
+	 */
+	if (likely(take_reader(&rwlock->cpu[arch_curr_cpu()->id].readers))) {
+		read_release(rwlock);
+
+		return 0;
+	}
+
+	/* Taken on another CPU, or not taken at all */
+	key = k_spin_lock(&rwlock->lock);
+
+	taken = take_reader_any_cpu(rwlock);
+
+	if (taken && (rwlock->writer == NULL) && wake_waiters(rwlock)) {
+		z_reschedule(&rwlock->lock, key);
+	} else {
+		k_spin_unlock(&rwlock->lock, key);
+	}
+
+	return taken ? 0 : -EINVAL;
+}
+#endif /* CONFIG_RWLOCK_PERCPU_READERS */
+
+int z_impl_k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+#ifdef CONFIG_RWLOCK_PERCPU_READERS
+	if (likely(read_lock_fast(rwlock))) {
+		return 0;
+	}
+#endif /* CONFIG_RWLOCK_PERCPU_READERS */
+
+	key = k_spin_lock(&rwlock->lock);
+
+	if (unlikely(rwlock->writer == _current)) {
+		k_spin_unlock(&rwlock->lock, key);
+
+		return -EDEADLK;
+	}
+
+	if (likely(read_admissible(rwlock))) {
+		add_reader(rwlock);
+		k_spin_unlock(&rwlock->lock, key);
+
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&rwlock->lock, key);
+
+		return -EBUSY;
+	}
+
+	STATS_INC(rwlock, read_waits);
+
+	/* The thread releasing the lock counts this one in as a reader */
+	return z_pend_curr(&rwlock->lock, key, &rwlock->read_wait_q, timeout);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_read_lock(struct k_rwlock *rwlock,
+					    k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_read_lock(rwlock, timeout);
+}
+#include <zephyr/syscalls/k_rwlock_read_lock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_read_unlock(struct k_rwlock *rwlock)
+{
+#ifdef CONFIG_RWLOCK_PERCPU_READERS
+	return read_unlock_fast(rwlock);
+#else
+	k_spinlock_key_t key = k_spin_lock(&rwlock->lock);
+
+	if (unlikely(rwlock->readers == 0U)) {
+		k_spin_unlock(&rwlock->lock, key);
+
+		return -EINVAL;
+	}
+
+	rwlock->readers--;
+
+	if ((rwlock->readers == 0U) && wake_waiters(rwlock)) {
+		z_reschedule(&rwlock->lock, key);
+	} else {
+		k_spin_unlock(&rwlock->lock, key);
+	}
+
+	return 0;
+#endif /* CONFIG_RWLOCK_PERCPU_READERS */
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_read_unlock(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_read_unlock(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_read_unlock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	bool resched = false;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be written inside ISRs");
+
+	key = k_spin_lock(&rwlock->lock);
+
+	if (unlikely(rwlock->writer == _current)) {
+		k_spin_unlock(&rwlock->lock, key);
+
+		return -EDEADLK;
+	}
+
+#ifdef CONFIG_RWLOCK_PERCPU_READERS
+	/* Keep new readers off the fast path before counting them */
+	atomic_set(&rwlock->write_pending, 1);
+#endif /* CONFIG_RWLOCK_PERCPU_READERS */
+
+	if (likely((rwlock->writer == NULL) && !readers_active(rwlock))) {
+		rwlock->writer = _current;
+		STATS_INC(rwlock, write_locks);
+		k_spin_unlock(&rwlock->lock, key);
+
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		update_write_pending(rwlock);
+		k_spin_unlock(&rwlock->lock, key);
+
+		return -EBUSY;
+	}
+
+	STATS_INC(rwlock, write_waits);
+
+	ret = z_pend_curr(&rwlock->lock, key, &rwlock->write_wait_q, timeout);
+	if (ret == 0) {
+		/* The thread releasing the lock made this one the writer */
+		return 0;
+	}
+
+	/* Readers held back by this writer may go ahead now */
+	key = k_spin_lock(&rwlock->lock);
+
+	if (rwlock->writer == NULL) {
+		resched = wake_waiters(rwlock);
+	}
+
+	if (resched) {
+		z_reschedule(&rwlock->lock, key);
+	} else {
+		k_spin_unlock(&rwlock->lock, key);
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_write_lock(struct k_rwlock *rwlock,
+					     k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_write_lock(rwlock, timeout);
+}
+#include <zephyr/syscalls/k_rwlock_write_lock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_write_unlock(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key = k_spin_lock(&rwlock->lock);
+
+	if (unlikely(rwlock->writer != _current)) {
+		k_spin_unlock(&rwlock->lock, key);
+
+		return -EPERM;
+	}
+
+	rwlock->writer = NULL;
+
+	if (wake_waiters(rwlock)) {
+		z_reschedule(&rwlock->lock, key);
+	} else {
+		k_spin_unlock(&rwlock->lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_write_unlock(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_write_unlock(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_write_unlock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+static int k_rwlock_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_rwlock *rwlock = CONTAINER_OF(obj_core, struct k_rwlock, obj_core);
+	k_spinlock_key_t key = k_spin_lock(&rwlock->lock);
+
+	memcpy(stats, &rwlock->stats, sizeof(rwlock->stats));
+
+	k_spin_unlock(&rwlock->lock, key);
+
+	return 0;
+}
+
+static int k_rwlock_stats_query(struct k_obj_core *obj_core, void *stats)
+{
+	int ret = k_rwlock_stats_raw(obj_core, stats);
+
+#ifdef CONFIG_RWLOCK_PERCPU_READERS
+	/* Readers that took the fast path are only counted per CPU */
+	struct k_rwlock *rwlock = CONTAINER_OF(obj_core, struct k_rwlock, obj_core);
+	struct k_rwlock_stats *ptr = stats;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		ptr->read_locks += rwlock->cpu[i].read_locks;
+	}
+#endif /* CONFIG_RWLOCK_PERCPU_READERS */
+
+	return ret;
+}
+
+static int k_rwlock_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_rwlock *rwlock = CONTAINER_OF(obj_core, struct k_rwlock, obj_core);
+	k_spinlock_key_t key = k_spin_lock(&rwlock->lock);
+
+	rwlock->stats = (struct k_rwlock_stats) {};
+#ifdef CONFIG_RWLOCK_PERCPU_READERS
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		rwlock->cpu[i].read_locks = 0U;
+	}
+#endif /* CONFIG_RWLOCK_PERCPU_READERS */
+
+	k_spin_unlock(&rwlock->lock, key);
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc rwlock_stats_desc = {
+	.raw_size = sizeof(struct k_rwlock_stats),
+	.query_size = sizeof(struct k_rwlock_stats),
+	.raw   = k_rwlock_stats_raw,
+	.query = k_rwlock_stats_query,
+	.reset = k_rwlock_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+
+static int init_rwlock_obj_core_list(void)
+{
+	/* Initialize rwlock object type */
+
+	z_obj_type_init(&obj_type_rwlock, K_OBJ_TYPE_RWLOCK_ID,
+			offsetof(struct k_rwlock, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	k_obj_type_stats_init(&obj_type_rwlock, &rwlock_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+
+	/* Initialize and link statically defined rwlocks */
+
+	STRUCT_SECTION_FOREACH(k_rwlock, rwlock) {
+		k_obj_core_init_and_link(K_OBJ_CORE(rwlock), &obj_type_rwlock);
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+		k_obj_core_stats_register(K_OBJ_CORE(rwlock), &rwlock->stats,
+					  sizeof(struct k_rwlock_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+	}
+
+	return 0;
+}
+
+SYS_INIT(init_rwlock_obj_core_list, PRE_KERNEL_1,
+	 CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+#endif /* CONFIG_OBJ_CORE_RWLOCK */
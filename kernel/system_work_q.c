@@ -14,8 +14,15 @@
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
 
+#if CONFIG_SYSTEM_WORKQUEUE_NUM_WORKERS > 1
+static K_KERNEL_STACK_ARRAY_DEFINE(sys_work_q_stacks,
+				   CONFIG_SYSTEM_WORKQUEUE_NUM_WORKERS,
+				   CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
+static struct k_work_q_worker sys_work_q_workers[CONFIG_SYSTEM_WORKQUEUE_NUM_WORKERS];
+#else
 static K_KERNEL_STACK_DEFINE(sys_work_q_stack,
 			     CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
+#endif
 
 struct k_work_q k_sys_work_q;
 
@@ -26,12 +33,22 @@ static int k_sys_work_q_init(void)
 		.no_yield = IS_ENABLED(CONFIG_SYSTEM_WORKQUEUE_NO_YIELD),
 		.essential = true,
 		.work_timeout_ms = CONFIG_SYSTEM_WORKQUEUE_WORK_TIMEOUT_MS,
+		.pin_workers = IS_ENABLED(CONFIG_SYSTEM_WORKQUEUE_PIN_WORKERS),
 	};
 
+#if CONFIG_SYSTEM_WORKQUEUE_NUM_WORKERS > 1
+	k_work_queue_start_pool(&k_sys_work_q,
+				sys_work_q_workers,
+				ARRAY_SIZE(sys_work_q_workers),
+				(k_thread_stack_t *)sys_work_q_stacks,
+				CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE,
+				CONFIG_SYSTEM_WORKQUEUE_PRIORITY, &cfg);
+#else
 	k_work_queue_start(&k_sys_work_q,
 			    sys_work_q_stack,
 			    K_KERNEL_STACK_SIZEOF(sys_work_q_stack),
 			    CONFIG_SYSTEM_WORKQUEUE_PRIORITY, &cfg);
+#endif
 	return 0;
 }
 
@@ -11,10 +11,13 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/math_extras.h>
 
 static uint64_t curr_tick;
 
+#ifndef CONFIG_TIMEOUT_QUEUE_WHEEL
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 /*
  * The timeout code shall take no locks other than its own (timeout_lock), nor
@@ -40,6 +43,263 @@ static inline unsigned int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+
+/*
+ * Hierarchical timing wheel.
+ *
+ * An armed timeout stores its absolute expiry tick in dticks.  It sits at
+ * the level given by the most significant group of WHEEL_BITS bits in
+ * which its expiry differs from curr_tick, in the slot indexed by the
+ * expiry's bits of that group.  Hence every timeout at level N expires
+ * before any timeout at level N + 1, a level 0 slot only ever holds
+ * timeouts of a single expiry tick, and the timeouts in a slot of a
+ * higher level only need to be redistributed ("cascaded") over the lower
+ * levels once curr_tick enters the range covered by that slot.  Timeouts
+ * beyond the range of the top level wait in a sorted overflow list.
+ *
+ * A slot is only valid while its bit is set in wheel_map[], so the wheel
+ * needs no initialization.  Timeouts with the same expiry fire in the
+ * order they were added, as in the list implementation: a timeout that is
+ * cascaded down was always added before any timeout of the same expiry
+ * already found at the destination level, so it goes in front of those.
+ */
+#define WHEEL_BITS	5
+#define WHEEL_SLOTS	BIT(WHEEL_BITS)
+#define WHEEL_LEVELS	CONFIG_TIMEOUT_QUEUE_WHEEL_LEVELS
+#define WHEEL_EMPTY	UINT64_MAX
+
+static sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static uint32_t wheel_map[WHEEL_LEVELS];
+static sys_dlist_t wheel_overflow = SYS_DLIST_STATIC_INIT(&wheel_overflow);
+
+/* Earliest expiry tick of all armed timeouts, or WHEEL_EMPTY */
+static uint64_t wheel_next = WHEEL_EMPTY;
+
+static int wheel_level(uint64_t expiry)
+{
+	uint64_t diff = expiry ^ curr_tick;
+
+	return (diff == 0U) ? 0 : (63 - u64_count_leading_zeros(diff)) / WHEEL_BITS;
+}
+
+static inline unsigned int wheel_index(uint64_t expiry, int level)
+{
+	return (expiry >> (level * WHEEL_BITS)) & (WHEEL_SLOTS - 1U);
+}
+
+static void wheel_place(struct _timeout *to, bool front)
+{
+	uint64_t expiry = to->dticks;
+	int level = wheel_level(expiry);
+
+	if (level >= WHEEL_LEVELS) {
+		struct _timeout *t;
+
+		SYS_DLIST_FOR_EACH_CONTAINER(&wheel_overflow, t, node) {
+			if ((uint64_t)t->dticks > expiry) {
+				sys_dlist_insert(&t->node, &to->node);
+				return;
+			}
+		}
+		sys_dlist_append(&wheel_overflow, &to->node);
+		return;
+	}
+
+	unsigned int idx = wheel_index(expiry, level);
+	sys_dlist_t *slot = &wheel[level][idx];
+
+	if ((wheel_map[level] & BIT(idx)) == 0U) {
+		sys_dlist_init(slot);
+		wheel_map[level] |= BIT(idx);
+	}
+
+	if (front) {
+		sys_dlist_prepend(slot, &to->node);
+	} else {
+		sys_dlist_append(slot, &to->node);
+	}
+}
+
+static void wheel_unlink(struct _timeout *to)
+{
+	int level = wheel_level(to->dticks);
+
+	sys_dlist_remove(&to->node);
+
+	if (level < WHEEL_LEVELS) {
+		unsigned int idx = wheel_index(to->dticks, level);
+
+		if (sys_dlist_is_empty(&wheel[level][idx])) {
+			wheel_map[level] &= ~BIT(idx);
+		}
+	}
+}
+
+static uint64_t wheel_earliest(void)
+{
+	struct _timeout *t;
+
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		if (wheel_map[level] == 0U) {
+			continue;
+		}
+
+		unsigned int idx = find_lsb_set(wheel_map[level]) - 1U;
+		uint64_t ret = WHEEL_EMPTY;
+
+		if (level == 0) {
+			/* Level 0 slots map to exactly one tick */
+			return (curr_tick & ~(uint64_t)(WHEEL_SLOTS - 1U)) | idx;
+		}
+
+		SYS_DLIST_FOR_EACH_CONTAINER(&wheel[level][idx], t, node) {
+			ret = MIN(ret, (uint64_t)t->dticks);
+		}
+		return ret;
+	}
+
+	t = SYS_DLIST_PEEK_HEAD_CONTAINER(&wheel_overflow, t, node);
+
+	return (t == NULL) ? WHEEL_EMPTY : (uint64_t)t->dticks;
+}
+
+/* Moves curr_tick forward to @p tick, which must not be past wheel_next,
+ * cascading the slots whose range it enters.
+ */
+static void wheel_advance(uint64_t tick)
+{
+	struct _timeout *t;
+	sys_dnode_t *n;
+
+	curr_tick = tick;
+
+	/* Bottom-up, so that timeouts cascaded from a higher level (which
+	 * are the older ones) end up in front of those cascaded from below.
+	 */
+	for (int level = 1; level < WHEEL_LEVELS; level++) {
+		unsigned int idx = wheel_index(tick, level);
+		sys_dlist_t *slot = &wheel[level][idx];
+
+		if ((wheel_map[level] & BIT(idx)) == 0U) {
+			continue;
+		}
+
+		/* Tail first to keep the slot's order at the destination */
+		while ((n = sys_dlist_peek_tail(slot)) != NULL) {
+			sys_dlist_remove(n);
+			wheel_place(CONTAINER_OF(n, struct _timeout, node), true);
+		}
+		wheel_map[level] &= ~BIT(idx);
+	}
+
+	while ((t = SYS_DLIST_PEEK_HEAD_CONTAINER(&wheel_overflow, t, node)) != NULL) {
+		if (wheel_level(t->dticks) >= WHEEL_LEVELS) {
+			break;
+		}
+		sys_dlist_remove(&t->node);
+		wheel_place(t, false);
+	}
+}
+
+/* Returns true if @p to became the first timeout to expire */
+static bool insert_timeout(struct _timeout *to)
+{
+	to->dticks += curr_tick;
+	wheel_place(to, false);
+
+	if ((uint64_t)to->dticks < wheel_next) {
+		wheel_next = to->dticks;
+		return true;
+	}
+
+	return false;
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	wheel_unlink(t);
+	if ((uint64_t)t->dticks == wheel_next) {
+		wheel_next = wheel_earliest();
+	}
+}
+
+static bool is_first(const struct _timeout *t)
+{
+	return (uint64_t)t->dticks == wheel_next;
+}
+
+static int64_t first_dticks(void)
+{
+	return (wheel_next == WHEEL_EMPTY) ? INT64_MAX : (int64_t)(wheel_next - curr_tick);
+}
+
+/* Advances time by @p dt to the first expiry and dequeues that timeout */
+static struct _timeout *expire_first(int64_t dt)
+{
+	wheel_advance(curr_tick + dt);
+
+	sys_dlist_t *slot = &wheel[0][wheel_index(curr_tick, 0)];
+	struct _timeout *t = SYS_DLIST_PEEK_HEAD_CONTAINER(slot, t, node);
+
+	remove_timeout(t);
+	t->dticks = 0;
+
+	return t;
+}
+
+/* Advances time by @p ticks, which must not reach past the first expiry */
+static void advance(int32_t ticks)
+{
+	wheel_advance(curr_tick + ticks);
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	return timeout->dticks - curr_tick;
+}
+
+#ifdef CONFIG_ZTEST
+/* Moves all timeouts along with curr_tick, preserving their remaining time */
+static void wheel_rebase(uint64_t tick)
+{
+	sys_dlist_t all = SYS_DLIST_STATIC_INIT(&all);
+	uint64_t shift = tick - curr_tick;
+	struct _timeout *t;
+	sys_dnode_t *n;
+
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		while (wheel_map[level] != 0U) {
+			unsigned int idx = find_lsb_set(wheel_map[level]) - 1U;
+
+			sys_dlist_t *slot = &wheel[level][idx];
+
+			while ((n = sys_dlist_get(slot)) != NULL) {
+				sys_dlist_append(&all, n);
+			}
+			wheel_map[level] &= ~BIT(idx);
+		}
+	}
+	while ((n = sys_dlist_get(&wheel_overflow)) != NULL) {
+		sys_dlist_append(&all, n);
+	}
+
+	curr_tick = tick;
+	if (wheel_next != WHEEL_EMPTY) {
+		wheel_next += shift;
+	}
+
+	while ((n = sys_dlist_get(&all)) != NULL) {
+		t = CONTAINER_OF(n, struct _timeout, node);
+		t->dticks += shift;
+		wheel_place(t, false);
+	}
+}
+#endif /* CONFIG_ZTEST */
+
+#else
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -54,6 +314,27 @@ static struct _timeout *next(struct _timeout *t)
 	return (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
+/* Returns true if @p to became the first timeout to expire */
+static bool insert_timeout(struct _timeout *to)
+{
+	struct _timeout *t;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&timeout_list, &to->node);
+	}
+
+	return to == first();
+}
+
 static void remove_timeout(struct _timeout *t)
 {
 	if (next(t) != NULL) {
@@ -63,6 +344,59 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+static bool is_first(const struct _timeout *t)
+{
+	return t == first();
+}
+
+static int64_t first_dticks(void)
+{
+	struct _timeout *t = first();
+
+	return (t == NULL) ? INT64_MAX : t->dticks;
+}
+
+/* Advances time by @p dt to the first expiry and dequeues that timeout */
+static struct _timeout *expire_first(int64_t dt)
+{
+	struct _timeout *t = first();
+
+	curr_tick += dt;
+	t->dticks = 0;
+	remove_timeout(t);
+
+	return t;
+}
+
+/* Advances time by @p ticks, which must not reach past the first expiry */
+static void advance(int32_t ticks)
+{
+	struct _timeout *t = first();
+
+	if (t != NULL) {
+		t->dticks -= ticks;
+	}
+
+	curr_tick += ticks;
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -86,14 +420,13 @@ static int32_t elapsed(void)
 
 static int32_t next_timeout(int32_t ticks_elapsed)
 {
-	struct _timeout *to = first();
+	int64_t dticks = first_dticks() - ticks_elapsed;
 	int32_t ret;
 
-	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	if (dticks > (int64_t)INT_MAX) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, dticks);
 	}
 
 	return ret;
@@ -115,7 +448,6 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
 		int32_t ticks_elapsed;
 		bool has_elapsed = false;
 
@@ -131,20 +463,7 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 			ticks = timeout.ticks;
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
-
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
-
-		if (to == first() && announce_remaining == 0) {
+		if (insert_timeout(to) && announce_remaining == 0) {
 			if (!has_elapsed) {
 				/* In case of absolute timeout that is first to expire
 				 * elapsed need to be read from the system clock.
@@ -164,12 +483,12 @@ int z_abort_timeout(struct _timeout *to)
 
 	K_SPINLOCK(&timeout_lock) {
 		if (sys_dnode_is_linked(&to->node)) {
-			bool is_first = (to == first());
+			bool was_first = is_first(to);
 
 			remove_timeout(to);
 			to->dticks = TIMEOUT_DTICKS_ABORTED;
 			ret = 0;
-			if (is_first) {
+			if (was_first) {
 				sys_clock_set_timeout(next_timeout(elapsed()), false);
 			}
 		}
@@ -178,21 +497,6 @@ int z_abort_timeout(struct _timeout *to)
 	return ret;
 }
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
-{
-	k_ticks_t ticks = 0;
-
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
-	}
-
-	return ticks;
-}
-
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
@@ -248,16 +552,10 @@ void sys_clock_announce(int32_t ticks)
 
 	announce_remaining = ticks;
 
-	struct _timeout *t;
-
-	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
-	     t = first()) {
-		int dt = t->dticks;
-
-		curr_tick += dt;
-		t->dticks = 0;
-		remove_timeout(t);
+	for (int64_t dt = first_dticks();
+	     dt <= announce_remaining;
+	     dt = first_dticks()) {
+		struct _timeout *t = expire_first(dt);
 
 		k_spin_unlock(&timeout_lock, key);
 		t->fn(t);
@@ -265,11 +563,7 @@ void sys_clock_announce(int32_t ticks)
 		announce_remaining -= dt;
 	}
 
-	if (t != NULL) {
-		t->dticks -= announce_remaining;
-	}
-
-	curr_tick += announce_remaining;
+	advance(announce_remaining);
 	announce_remaining = 0;
 
 	sys_clock_set_timeout(next_timeout(0), false);
@@ -353,7 +647,13 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	K_SPINLOCK(&timeout_lock) {
+		wheel_rebase(tick);
+	}
+#else
 	curr_tick = tick;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
@@ -4,10 +4,15 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <inttypes.h>
+#include <string.h>
+
 #include <zephyr/kernel.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/kernel_structs.h>
 #include <zephyr/toolchain.h>
+#include <zephyr/sys/speculation.h>
+#include <zephyr/sys/syscall_batch.h>
 
 static struct k_object *validate_kernel_object(const void *obj,
 					       enum k_objects otype,
@@ -87,3 +92,60 @@ static inline void *z_vrfy_k_object_alloc_size(enum k_objects otype, size_t size
 	return z_impl_k_object_alloc_size(otype, size);
 }
 #include <zephyr/syscalls/k_object_alloc_size_mrsh.c>
+
+#ifdef CONFIG_SYSCALL_BATCH
+int z_impl_k_syscall_batch(struct k_syscall_batch_entry *entries, size_t count)
+{
+	ARG_UNUSED(entries);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+}
+
+static inline int z_vrfy_k_syscall_batch(struct k_syscall_batch_entry *entries,
+					 size_t count)
+{
+	/* Set by the marshalling function of this system call */
+	void *ssf = _current->syscall_frame;
+	struct k_syscall_batch_entry entry;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(entries, count, sizeof(*entries)));
+
+	for (size_t i = 0; i < count; i++) {
+		/* The system calls before may have blocked, while another
+		 * thread changed the memory this thread can access.
+		 */
+		if (i != 0) {
+			K_OOPS(K_SYSCALL_MEMORY_WRITE(&entries[i], sizeof(entries[i])));
+		}
+
+		/* Work on a copy the caller cannot change once verified */
+		(void)memcpy(&entry, &entries[i], sizeof(entry));
+
+		K_OOPS(K_SYSCALL_VERIFY_MSG(entry.id < K_SYSCALL_BAD,
+					    "bad system call id %" PRIuPTR " in batch",
+					    entry.id));
+		K_OOPS(K_SYSCALL_VERIFY_MSG(entry.id != K_SYSCALL_K_SYSCALL_BATCH,
+					    "nested system call batch"));
+
+		/* Like the arch system call entry, keep a mispredicted bounds
+		 * check from indexing the table speculatively.
+		 */
+		entry.id = k_array_index_sanitize(entry.id, K_SYSCALL_BAD);
+
+		/* Marshalling functions verify their arguments, and set then
+		 * clear the syscall frame of the current thread.
+		 */
+		entry.ret = _k_syscall_table[entry.id](entry.args[0], entry.args[1],
+						       entry.args[2], entry.args[3],
+						       entry.args[4], entry.args[5], ssf);
+		_current->syscall_frame = ssf;
+
+		K_OOPS(K_SYSCALL_MEMORY_WRITE(&entries[i].ret, sizeof(entries[i].ret)));
+		entries[i].ret = entry.ret;
+	}
+
+	return 0;
+}
+#include <zephyr/syscalls/k_syscall_batch_mrsh.c>
+#endif /* CONFIG_SYSCALL_BATCH */
@@ -176,6 +176,164 @@ int k_work_busy_get(const struct k_work *work)
 	return ret;
 }
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+static inline bool queue_is_pool(const struct k_work_q *queue)
+{
+	return queue->workers != NULL;
+}
+
+/* Find the pool worker that is the given thread.
+ *
+ * @return the worker, or NULL if the thread is not a worker of @p queue
+ */
+static struct k_work_q_worker *pool_worker_find(struct k_work_q *queue,
+						const struct k_thread *thread)
+{
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		if (&queue->workers[i].thread == thread) {
+			return &queue->workers[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Find the pool worker running a work item.
+ *
+ * Invoked with work lock held.
+ *
+ * @return the worker, or NULL if no worker of @p queue runs @p work
+ */
+static struct k_work_q_worker *pool_runner_find_locked(struct k_work_q *queue,
+						       const struct k_work *work)
+{
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		if (queue->workers[i].current == work) {
+			return &queue->workers[i];
+		}
+	}
+
+	return NULL;
+}
+#else
+static inline bool queue_is_pool(const struct k_work_q *queue)
+{
+	ARG_UNUSED(queue);
+
+	return false;
+}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+/* Determine whether the current thread services a queue.
+ *
+ * @param queue the queue to check.
+ */
+static inline bool queue_is_current(struct k_work_q *queue)
+{
+	if (k_is_in_isr()) {
+		return false;
+	}
+
+#if defined(CONFIG_WORKQUEUE_POOL)
+	if (queue_is_pool(queue)) {
+		return pool_worker_find(queue, _current) != NULL;
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	return _current == queue->thread_id;
+}
+
+/* Find the list a queued work item is on.
+ *
+ * For a pool this is either the queue's pending list or the list of one
+ * of its workers.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue the work is queued on
+ * @param work work that is queued on @p queue
+ */
+static sys_slist_t *queue_list_of_locked(struct k_work_q *queue,
+					 const struct k_work *work)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	sys_snode_t *prev;
+
+	if (queue_is_pool(queue) &&
+	    !sys_slist_find(&queue->pending, &work->node, &prev)) {
+		for (size_t i = 0; i < queue->num_workers; i++) {
+			sys_slist_t *deque = &queue->workers[i].deque;
+
+			if (sys_slist_find(deque, &work->node, &prev)) {
+				return deque;
+			}
+		}
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	return &queue->pending;
+}
+
+/* Find the list to which a work item should be added.
+ *
+ * A single threaded queue has only one.  A pool keeps an item that is
+ * still running on the worker running it, so that it never runs
+ * concurrently with itself, and items submitted by a worker on that
+ * worker.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue to which work is submitted
+ * @param work the work item to be added
+ */
+static sys_slist_t *queue_list_for_locked(struct k_work_q *queue,
+					  const struct k_work *work)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	struct k_work_q_worker *worker = NULL;
+
+	if (queue_is_pool(queue)) {
+		if (flag_test(&work->flags, K_WORK_RUNNING_BIT)) {
+			worker = pool_runner_find_locked(queue, work);
+			__ASSERT_NO_MSG(worker != NULL);
+		} else if (!k_is_in_isr()) {
+			worker = pool_worker_find(queue, _current);
+		}
+	}
+
+	if (worker != NULL) {
+		return &worker->deque;
+	}
+#else
+	ARG_UNUSED(work);
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	return &queue->pending;
+}
+
+/* Determine whether any work item is queued on a queue.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue to check
+ */
+static bool queue_has_pending_locked(struct k_work_q *queue)
+{
+	if (!sys_slist_is_empty(&queue->pending)) {
+		return true;
+	}
+
+#if defined(CONFIG_WORKQUEUE_POOL)
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		if (!sys_slist_is_empty(&queue->workers[i].deque)) {
+			return true;
+		}
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	return false;
+}
+
 /* Add a flusher work item to the queue.
  *
  * Invoked with work lock held.
@@ -193,11 +351,15 @@ static void queue_flusher_locked(struct k_work_q *queue,
 {
 	init_flusher(flusher);
 
+	/* On a pool, flushers stay on the worker running the work item, and
+	 * follow the work item if a worker takes it.
+	 */
 	if ((flags_get(&work->flags) & K_WORK_QUEUED) != 0U) {
-		sys_slist_insert(&queue->pending, &work->node,
+		sys_slist_insert(queue_list_of_locked(queue, work), &work->node,
 				 &flusher->work.node);
 	} else {
-		sys_slist_prepend(&queue->pending, &flusher->work.node);
+		sys_slist_prepend(queue_list_for_locked(queue, work),
+				  &flusher->work.node);
 	}
 }
 
@@ -212,7 +374,8 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 				       struct k_work *work)
 {
 	if (flag_test_and_clear(&work->flags, K_WORK_QUEUED_BIT)) {
-		(void)sys_slist_find_and_remove(&queue->pending, &work->node);
+		(void)sys_slist_find_and_remove(queue_list_of_locked(queue, work),
+						&work->node);
 	}
 }
 
@@ -265,7 +428,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret;
-	bool chained = (_current == queue->thread_id) && !k_is_in_isr();
+	bool chained = queue_is_current(queue);
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -283,7 +446,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	} else if (plugged && !draining) {
 		ret = -EBUSY;
 	} else {
-		sys_slist_append(&queue->pending, &work->node);
+		sys_slist_append(queue_list_for_locked(queue, work), &work->node);
 		ret = 1;
 		(void)notify_queue_locked(queue);
 	}
@@ -648,6 +811,26 @@ static void work_timeout_stop_locked(struct k_work_q *queue)
 }
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
 
+/* Mark a work item as no longer running and deal with any cancellation
+ * and flushing issued while it was running.
+ *
+ * Invoked with work lock held.
+ *
+ * Invoked from a work queue thread.
+ *
+ * @param work the work item that has completed
+ */
+static void work_done_locked(struct k_work *work)
+{
+	flag_clear(&work->flags, K_WORK_RUNNING_BIT);
+	if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
+		finalize_flush_locked(work);
+	}
+	if (flag_test(&work->flags, K_WORK_CANCELING_BIT)) {
+		finalize_cancel_locked(work);
+	}
+}
+
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
@@ -747,13 +930,7 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		work_timeout_stop_locked(queue);
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
 
-		flag_clear(&work->flags, K_WORK_RUNNING_BIT);
-		if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
-			finalize_flush_locked(work);
-		}
-		if (flag_test(&work->flags, K_WORK_CANCELING_BIT)) {
-			finalize_cancel_locked(work);
-		}
+		work_done_locked(work);
 
 		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
@@ -768,6 +945,176 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 	}
 }
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+static inline bool is_flusher(const struct k_work *work)
+{
+	return work->handler == handle_flush;
+}
+
+/* Determine whether a pool worker may take over a work item queued on
+ * another worker.
+ *
+ * Items running on the other worker, and flushers waiting for it to
+ * complete an item, must stay there.
+ */
+static inline bool pool_stealable(const struct k_work *work)
+{
+	return !flag_test(&work->flags, K_WORK_RUNNING_BIT) && !is_flusher(work);
+}
+
+/* Take the next work item to be run by a pool worker.
+ *
+ * The worker runs its own items first, then items submitted from
+ * outside the pool, and then takes over an item queued on another
+ * worker.  Flushers queued behind the item move along with it to the
+ * head of the worker's list, so that they complete after the item.
+ *
+ * Invoked with work lock held.
+ *
+ * @param worker the worker looking for work
+ *
+ * @return the work item, or NULL if there is nothing to run.
+ */
+static struct k_work *pool_take_locked(struct k_work_q_worker *worker)
+{
+	struct k_work_q *queue = worker->queue;
+	size_t self = worker - queue->workers;
+	sys_slist_t *list = NULL;
+	sys_snode_t *prev = NULL;
+	sys_snode_t *node;
+	sys_slist_t flushers;
+
+	if (!sys_slist_is_empty(&worker->deque)) {
+		list = &worker->deque;
+	} else if (!sys_slist_is_empty(&queue->pending)) {
+		list = &queue->pending;
+	} else {
+		for (size_t i = 1; (i < queue->num_workers) && (list == NULL); i++) {
+			sys_slist_t *deque = &queue->workers[(self + i) % queue->num_workers].deque;
+
+			prev = NULL;
+			SYS_SLIST_FOR_EACH_NODE(deque, node) {
+				if (pool_stealable(CONTAINER_OF(node, struct k_work, node))) {
+					list = deque;
+					break;
+				}
+				prev = node;
+			}
+		}
+
+		if (list == NULL) {
+			return NULL;
+		}
+	}
+
+	node = (prev == NULL) ? sys_slist_peek_head(list) : sys_slist_peek_next(prev);
+	sys_slist_remove(list, prev, node);
+
+	if (list != &worker->deque) {
+		sys_snode_t *next;
+
+		sys_slist_init(&flushers);
+		while (true) {
+			next = (prev == NULL) ? sys_slist_peek_head(list)
+					      : sys_slist_peek_next(prev);
+			if ((next == NULL) ||
+			    !is_flusher(CONTAINER_OF(next, struct k_work, node))) {
+				break;
+			}
+			sys_slist_remove(list, prev, next);
+			sys_slist_append(&flushers, next);
+		}
+
+		sys_slist_merge_slist(&flushers, &worker->deque);
+		worker->deque = flushers;
+	}
+
+	/* Let another idle worker pick up what is left */
+	if (queue_has_pending_locked(queue)) {
+		(void)notify_queue_locked(queue);
+	}
+
+	return CONTAINER_OF(node, struct k_work, node);
+}
+
+/* Loop executed by the threads of a work queue pool.
+ *
+ * @param worker_ptr pointer to the worker structure
+ */
+static void work_queue_pool_main(void *worker_ptr, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	struct k_work_q_worker *worker = worker_ptr;
+	struct k_work_q *queue = worker->queue;
+
+	while (true) {
+		struct k_work *work;
+		k_work_handler_t handler = NULL;
+		k_spinlock_key_t key = k_spin_lock(&lock);
+		bool yield;
+
+		work = pool_take_locked(worker);
+		if (work != NULL) {
+			queue->num_busy++;
+			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+			flag_set(&work->flags, K_WORK_RUNNING_BIT);
+			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
+			worker->current = work;
+			handler = work->handler;
+		} else if ((queue->num_busy == 0U) &&
+			   !queue_has_pending_locked(queue) &&
+			   flag_test_and_clear(&queue->flags,
+					       K_WORK_QUEUE_DRAIN_BIT)) {
+			/* No worker busy and nothing queued: release the
+			 * threads waiting for the drain.  Items this worker
+			 * may not take over, such as flushers queued behind
+			 * an item another worker just completed, still hold
+			 * the drain back until that worker has run them.
+			 */
+			(void)z_sched_wake_all(&queue->drainq, 1, NULL);
+		} else if (flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
+			/* Make sure the other workers see the request too.
+			 * k_work_queue_stop() clears the flags once all of
+			 * them have exited.
+			 */
+			(void)z_sched_wake_all(&queue->notifyq, 0, NULL);
+			k_spin_unlock(&lock, key);
+			return;
+		} else {
+			;
+		}
+
+		if (work == NULL) {
+			(void)z_sched_wait(&lock, key, &queue->notifyq,
+					   K_FOREVER, NULL);
+			continue;
+		}
+
+		k_spin_unlock(&lock, key);
+
+		__ASSERT_NO_MSG(handler != NULL);
+		handler(work);
+
+		key = k_spin_lock(&lock);
+
+		worker->current = NULL;
+		work_done_locked(work);
+
+		if (--queue->num_busy == 0U) {
+			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		}
+		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
+		k_spin_unlock(&lock, key);
+
+		if (yield) {
+			k_yield();
+		}
+	}
+}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
 void k_work_queue_init(struct k_work_q *queue)
 {
 	__ASSERT_NO_MSG(queue != NULL);
@@ -804,6 +1151,9 @@ void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+#if defined(CONFIG_WORKQUEUE_POOL)
+	queue->workers = NULL;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 	queue->thread_id = _current;
 	flags_set(&queue->flags, flags);
 	work_queue_main(queue, NULL, NULL);
@@ -826,6 +1176,9 @@ void k_work_queue_start(struct k_work_q *queue,
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+#if defined(CONFIG_WORKQUEUE_POOL)
+	queue->workers = NULL;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 
 	if ((cfg != NULL) && cfg->no_yield) {
 		flags |= K_WORK_QUEUE_NO_YIELD;
@@ -863,6 +1216,87 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+void k_work_queue_start_pool(struct k_work_q *queue,
+			     struct k_work_q_worker *workers, size_t num_workers,
+			     k_thread_stack_t *stacks, size_t stack_size,
+			     int prio, const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(workers);
+	__ASSERT_NO_MSG(stacks);
+	__ASSERT_NO_MSG((num_workers > 0U) && (num_workers <= UINT16_MAX));
+	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+
+	uint32_t flags = K_WORK_QUEUE_STARTED;
+	size_t stride = K_KERNEL_STACK_LEN(stack_size);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
+
+	sys_slist_init(&queue->pending);
+	z_waitq_init(&queue->notifyq);
+	z_waitq_init(&queue->drainq);
+	queue->workers = workers;
+	queue->num_workers = (uint16_t)num_workers;
+	queue->num_busy = 0U;
+
+	if ((cfg != NULL) && cfg->no_yield) {
+		flags |= K_WORK_QUEUE_NO_YIELD;
+	}
+
+#if defined(CONFIG_WORKQUEUE_WORK_TIMEOUT)
+	/* A work timeout aborts the thread running the item, which would
+	 * leave a pool short of a worker.
+	 */
+	queue->work_timeout = K_FOREVER;
+#endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
+
+	flags_set(&queue->flags, flags);
+
+	for (size_t i = 0; i < num_workers; i++) {
+		struct k_work_q_worker *worker = &workers[i];
+		k_thread_stack_t *stack =
+			(k_thread_stack_t *)((uint8_t *)stacks + (i * stride));
+
+		*worker = (struct k_work_q_worker) {
+			.queue = queue,
+		};
+		sys_slist_init(&worker->deque);
+
+		(void)k_thread_create(&worker->thread, stack, stack_size,
+				      work_queue_pool_main, worker, NULL, NULL,
+				      prio, 0, K_FOREVER);
+
+		if ((cfg != NULL) && (cfg->name != NULL)) {
+#ifdef CONFIG_THREAD_NAME
+			char name[CONFIG_THREAD_MAX_NAME_LEN];
+
+			snprintk(name, sizeof(name), "%s#%u", cfg->name, (unsigned int)i);
+			k_thread_name_set(&worker->thread, name);
+#endif /* CONFIG_THREAD_NAME */
+		}
+
+		if ((cfg != NULL) && (cfg->essential)) {
+			worker->thread.base.user_options |= K_ESSENTIAL;
+		}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		if ((cfg != NULL) && cfg->pin_workers) {
+			(void)k_thread_cpu_pin(&worker->thread, i % arch_num_cpus());
+		}
+#endif /* CONFIG_SCHED_CPU_MASK */
+	}
+
+	queue->thread_id = &workers[0].thread;
+
+	for (size_t i = 0; i < num_workers; i++) {
+		k_thread_start(&workers[i].thread);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
+}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -877,7 +1311,7 @@ int k_work_queue_drain(struct k_work_q *queue,
 	if (((flags_get(&queue->flags)
 	      & (K_WORK_QUEUE_BUSY | K_WORK_QUEUE_DRAIN)) != 0U)
 	    || plug
-	    || !sys_slist_is_empty(&queue->pending)) {
+	    || queue_has_pending_locked(queue)) {
 		flag_set(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 		if (plug) {
 			flag_set(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
@@ -938,6 +1372,30 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 	notify_queue_locked(queue);
 	k_spin_unlock(&lock, key);
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work_queue, stop, queue, timeout);
+#if defined(CONFIG_WORKQUEUE_POOL)
+	if (queue_is_pool(queue)) {
+		k_timepoint_t end = sys_timepoint_calc(timeout);
+		int ret = 0;
+
+		for (size_t i = 0; (i < queue->num_workers) && (ret == 0); i++) {
+			ret = k_thread_join(&queue->workers[i].thread,
+					    sys_timepoint_timeout(end));
+		}
+
+		key = k_spin_lock(&lock);
+		if (ret != 0) {
+			/* Workers that have exited already are gone */
+			flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
+		} else {
+			flags_set(&queue->flags, 0);
+		}
+		k_spin_unlock(&lock, key);
+
+		ret = (ret != 0) ? -ETIMEDOUT : 0;
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, stop, queue, timeout, ret);
+		return ret;
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 	if (k_thread_join(queue->thread_id, timeout)) {
 		key = k_spin_lock(&lock);
 		flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
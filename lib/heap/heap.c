@@ -160,7 +160,7 @@ static chunkid_t mem_to_chunkid(struct z_heap *h, void *p)
 	return (mem - chunk_header_bytes(h) - base) / CHUNK_UNIT;
 }
 
-void sys_heap_free(struct sys_heap *heap, void *mem)
+static void heap_free(struct sys_heap *heap, void *mem, bool notify)
 {
 	if (mem == NULL) {
 		return; /* ISO C free() semantics */
@@ -190,13 +190,22 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 #endif
 
 #ifdef CONFIG_SYS_HEAP_LISTENER
-	heap_listener_notify_free(HEAP_ID_FROM_POINTER(heap), mem,
-				  chunksz_to_bytes(h, chunk_size(h, c)));
+	if (notify) {
+		heap_listener_notify_free(HEAP_ID_FROM_POINTER(heap), mem,
+					  chunksz_to_bytes(h, chunk_size(h, c)));
+	}
+#else
+	ARG_UNUSED(notify);
 #endif
 
 	free_chunk(h, c);
 }
 
+void sys_heap_free(struct sys_heap *heap, void *mem)
+{
+	heap_free(heap, mem, true);
+}
+
 size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
 {
 	struct z_heap *h = heap->heap;
@@ -260,7 +269,7 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 	return 0;
 }
 
-void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
+static void *heap_alloc(struct sys_heap *heap, size_t bytes, bool notify)
 {
 	struct z_heap *h = heap->heap;
 	void *mem;
@@ -291,14 +300,35 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 #endif
 
 #ifdef CONFIG_SYS_HEAP_LISTENER
-	heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(heap), mem,
-				   chunksz_to_bytes(h, chunk_size(h, c)));
+	if (notify) {
+		heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(heap), mem,
+					   chunksz_to_bytes(h, chunk_size(h, c)));
+	}
+#else
+	ARG_UNUSED(notify);
 #endif
 
 	IF_ENABLED(CONFIG_MSAN, (__msan_allocated_memory(mem, bytes)));
 	return mem;
 }
 
+void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
+{
+	return heap_alloc(heap, bytes, true);
+}
+
+#ifdef CONFIG_SYS_HEAP_MAGAZINES
+void *z_heap_alloc_quiet(struct sys_heap *heap, size_t bytes)
+{
+	return heap_alloc(heap, bytes, false);
+}
+
+void z_heap_free_quiet(struct sys_heap *heap, void *mem)
+{
+	heap_free(heap, mem, false);
+}
+#endif
+
 void *sys_heap_noalign_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 {
 	ARG_UNUSED(align);
@@ -550,6 +580,9 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 	heap->heap = h;
 	h->end_chunk = heap_sz;
 	h->avail_buckets = 0;
+#ifdef CONFIG_SYS_HEAP_MAGAZINES
+	h->magazines = NULL;
+#endif
 
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->free_bytes = 0;
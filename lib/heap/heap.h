@@ -65,6 +65,41 @@ struct z_heap_bucket {
 	chunkid_t next;
 };
 
+#ifdef CONFIG_SYS_HEAP_MAGAZINES
+#include <zephyr/spinlock.h>
+
+/* Magazine layer (see heap_magazine.c).  Each CPU owns a small stack
+ * ("magazine") of free blocks per power-of-two size class, starting
+ * at Z_HEAP_MAGAZINE_MIN_BYTES.  The blocks are allocated chunks as
+ * far as the underlying heap is concerned.  Each magazine has its own
+ * lock, which in practice is only ever contended by a drain.
+ */
+#define Z_HEAP_MAGAZINE_MIN_BYTES 16U
+#define Z_HEAP_MAGAZINE_CLASSES   CONFIG_SYS_HEAP_MAGAZINE_CLASSES
+#define Z_HEAP_MAGAZINE_DEPTH     CONFIG_SYS_HEAP_MAGAZINE_DEPTH
+
+struct z_heap_magazine {
+	struct k_spinlock lock;
+	uint8_t count[Z_HEAP_MAGAZINE_CLASSES];
+	void *blocks[Z_HEAP_MAGAZINE_CLASSES][Z_HEAP_MAGAZINE_DEPTH];
+};
+
+struct z_heap_magazines {
+	/* Lock serializing the underlying heap */
+	struct k_spinlock *heap_lock;
+	/* Usable bytes of a block of each class */
+	size_t class_bytes[Z_HEAP_MAGAZINE_CLASSES];
+	struct z_heap_magazine cpu[CONFIG_MP_MAX_NUM_CPUS];
+};
+
+/* sys_heap_alloc()/sys_heap_free() without listener notification,
+ * for refilling and flushing magazines.  The magazine layer reports
+ * the allocations it hands out and takes back itself.
+ */
+void *z_heap_alloc_quiet(struct sys_heap *heap, size_t bytes);
+void z_heap_free_quiet(struct sys_heap *heap, void *mem);
+#endif
+
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
@@ -73,6 +108,9 @@ struct z_heap {
 	size_t free_bytes;
 	size_t allocated_bytes;
 	size_t max_allocated_bytes;
+#endif
+#ifdef CONFIG_SYS_HEAP_MAGAZINES
+	struct z_heap_magazines *magazines;
 #endif
 	struct z_heap_bucket buckets[0];
 };
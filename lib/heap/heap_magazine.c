@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/heap_listener.h>
+#include <zephyr/kernel.h>
+#include <string.h>
+#include "heap.h"
+#ifdef CONFIG_MSAN
+#include <sanitizer/msan_interface.h>
+#endif
+
+/* Per-CPU magazine caches for small sys_heap allocations.
+ *
+ * Small requests are rounded up to a power-of-two size class and
+ * served from a stack of free blocks owned by the current CPU, taking
+ * only that magazine's (uncontended) lock.  The heap lock is taken
+ * once per batch of Z_HEAP_MAGAZINE_BATCH blocks, to refill an empty
+ * magazine or to flush half of a full one.
+ *
+ * Cached blocks stay allocated chunks in the underlying heap, so the
+ * heap structure, sys_heap_validate() and the runtime statistics see
+ * them as in use.  Listeners on the other hand are notified when a
+ * block is handed to or taken back from the user, exactly as if the
+ * heap had been called directly.
+ */
+
+#define Z_HEAP_MAGAZINE_BATCH MAX(Z_HEAP_MAGAZINE_DEPTH / 2, 1)
+
+#define MAX_CLASS_BYTES (Z_HEAP_MAGAZINE_MIN_BYTES << (Z_HEAP_MAGAZINE_CLASSES - 1))
+
+/* Don't let the cache bookkeeping take a noticeable share of small
+ * heaps; those are typically sized to an exact workload.
+ */
+#define MIN_HEAP_RATIO 32
+
+static int size_class(size_t bytes)
+{
+	if (bytes > MAX_CLASS_BYTES) {
+		return -1;
+	}
+	if (bytes <= Z_HEAP_MAGAZINE_MIN_BYTES) {
+		return 0;
+	}
+
+	return (32 - __builtin_clz((unsigned int)bytes - 1U)) -
+	       (31 - __builtin_clz(Z_HEAP_MAGAZINE_MIN_BYTES));
+}
+
+/* Only blocks starting right after their chunk header are cached, so
+ * the chunk size (which is what listeners are told) can be derived
+ * from the usable size.  The chunk header is read under the heap lock,
+ * as other CPUs may be splitting or merging the chunks around it.
+ */
+static int block_class(struct sys_heap *heap, void *mem)
+{
+	struct z_heap *h = heap->heap;
+	struct z_heap_magazines *m = h->magazines;
+	uintptr_t offs = (uint8_t *)mem - chunk_header_bytes(h) - (uint8_t *)chunk_buf(h);
+	chunkid_t c = offs / CHUNK_UNIT;
+	k_spinlock_key_t key;
+	size_t usable;
+
+	if ((offs % CHUNK_UNIT) != 0U) {
+		return -1;
+	}
+
+	key = k_spin_lock(m->heap_lock);
+	__ASSERT(chunk_used(h, c),
+		 "unexpected heap state (double-free?) for memory at %p", mem);
+	usable = chunksz_to_bytes(h, chunk_size(h, c)) - chunk_header_bytes(h);
+	k_spin_unlock(m->heap_lock, key);
+
+	for (int cls = 0; cls < Z_HEAP_MAGAZINE_CLASSES; cls++) {
+		if (m->class_bytes[cls] == usable) {
+			return cls;
+		}
+	}
+
+	return -1;
+}
+
+#ifdef CONFIG_SYS_HEAP_VALIDATE
+/* Cached blocks are still used chunks, so a block freed twice in a row
+ * is only caught by looking for it in the magazines.
+ */
+static bool block_cached(struct z_heap_magazines *m, int cls, void *mem)
+{
+	bool found = false;
+
+	for (int cpu = 0; (cpu < CONFIG_MP_MAX_NUM_CPUS) && !found; cpu++) {
+		struct z_heap_magazine *mag = &m->cpu[cpu];
+		k_spinlock_key_t key = k_spin_lock(&mag->lock);
+
+		for (int i = 0; i < mag->count[cls]; i++) {
+			if (mag->blocks[cls][i] == mem) {
+				found = true;
+				break;
+			}
+		}
+
+		k_spin_unlock(&mag->lock, key);
+	}
+
+	return found;
+}
+#endif /* CONFIG_SYS_HEAP_VALIDATE */
+
+static inline struct z_heap_magazine *local_magazine(struct z_heap_magazines *m)
+{
+	/* The caller may move to another CPU right after this and then
+	 * use the magazine of the CPU it left.  That only costs some
+	 * contention on the magazine lock: a block may go to or come from
+	 * any magazine of the heap, since all of them flush to the heap.
+	 */
+#ifdef CONFIG_SMP
+	return &m->cpu[arch_curr_cpu()->id];
+#else
+	return &m->cpu[0];
+#endif /* CONFIG_SMP */
+}
+
+static void flush_batch(struct sys_heap *heap, void **batch, int n)
+{
+	struct z_heap_magazines *m = heap->heap->magazines;
+	k_spinlock_key_t key = k_spin_lock(m->heap_lock);
+
+	for (int i = 0; i < n; i++) {
+		z_heap_free_quiet(heap, batch[i]);
+	}
+
+	k_spin_unlock(m->heap_lock, key);
+}
+
+/* Allocates a batch of class @cls blocks from the heap, returns one
+ * and stores the rest in @mag.
+ */
+static void *refill(struct sys_heap *heap, struct z_heap_magazine *mag, int cls)
+{
+	struct z_heap_magazines *m = heap->heap->magazines;
+	size_t bytes = Z_HEAP_MAGAZINE_MIN_BYTES << cls;
+	void *batch[Z_HEAP_MAGAZINE_BATCH];
+	k_spinlock_key_t key;
+	int n;
+
+	key = k_spin_lock(m->heap_lock);
+	for (n = 0; n < Z_HEAP_MAGAZINE_BATCH; n++) {
+		batch[n] = z_heap_alloc_quiet(heap, bytes);
+		if (batch[n] == NULL) {
+			break;
+		}
+	}
+	k_spin_unlock(m->heap_lock, key);
+
+	if (n == 0) {
+		return NULL;
+	}
+
+	key = k_spin_lock(&mag->lock);
+	while ((n > 1) && (mag->count[cls] < Z_HEAP_MAGAZINE_DEPTH)) {
+		mag->blocks[cls][mag->count[cls]++] = batch[--n];
+	}
+	k_spin_unlock(&mag->lock, key);
+
+	/* Someone else refilled the magazine meanwhile */
+	if (n > 1) {
+		flush_batch(heap, &batch[1], n - 1);
+	}
+
+	return batch[0];
+}
+
+int sys_heap_magazines_init(struct sys_heap *heap, struct k_spinlock *lock)
+{
+	struct z_heap *h = heap->heap;
+	struct z_heap_magazines *m;
+
+	if (sizeof(*m) * MIN_HEAP_RATIO > chunksz_to_bytes(h, h->end_chunk)) {
+		return -ENOMEM;
+	}
+
+	m = z_heap_alloc_quiet(heap, sizeof(*m));
+	if (m == NULL) {
+		return -ENOMEM;
+	}
+
+	(void)memset(m, 0, sizeof(*m));
+	m->heap_lock = lock;
+	for (int cls = 0; cls < Z_HEAP_MAGAZINE_CLASSES; cls++) {
+		chunksz_t sz = bytes_to_chunksz(h, Z_HEAP_MAGAZINE_MIN_BYTES << cls, 0);
+
+		m->class_bytes[cls] = chunksz_to_bytes(h, sz) - chunk_header_bytes(h);
+	}
+
+	h->magazines = m;
+
+	return 0;
+}
+
+void *sys_heap_magazine_alloc(struct sys_heap *heap, size_t bytes)
+{
+	struct z_heap *h = heap->heap;
+	struct z_heap_magazines *m = h->magazines;
+	struct z_heap_magazine *mag;
+	k_spinlock_key_t key;
+	void *mem = NULL;
+	int cls;
+
+	if ((m == NULL) || (bytes == 0U)) {
+		return NULL;
+	}
+
+	cls = size_class(bytes);
+	if (cls < 0) {
+		return NULL;
+	}
+
+	mag = local_magazine(m);
+	key = k_spin_lock(&mag->lock);
+	if (mag->count[cls] > 0U) {
+		mem = mag->blocks[cls][--mag->count[cls]];
+	}
+	k_spin_unlock(&mag->lock, key);
+
+	if (mem == NULL) {
+		mem = refill(heap, mag, cls);
+		if (mem == NULL) {
+			return NULL;
+		}
+	}
+
+#ifdef CONFIG_SYS_HEAP_LISTENER
+	heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(heap), mem,
+				   m->class_bytes[cls] + chunk_header_bytes(h));
+#endif
+
+	IF_ENABLED(CONFIG_MSAN, (__msan_allocated_memory(mem, bytes)));
+	return mem;
+}
+
+bool sys_heap_magazine_free(struct sys_heap *heap, void *mem)
+{
+	struct z_heap *h = heap->heap;
+	struct z_heap_magazines *m = h->magazines;
+	void *batch[Z_HEAP_MAGAZINE_BATCH];
+	struct z_heap_magazine *mag;
+	k_spinlock_key_t key;
+	int n = 0;
+	int cls;
+
+	if ((m == NULL) || (mem == NULL)) {
+		return false;
+	}
+
+	cls = block_class(heap, mem);
+	if (cls < 0) {
+		return false;
+	}
+
+#ifdef CONFIG_SYS_HEAP_VALIDATE
+	__ASSERT(!block_cached(m, cls, mem),
+		 "unexpected heap state (double-free?) for memory at %p", mem);
+#endif /* CONFIG_SYS_HEAP_VALIDATE */
+
+#ifdef CONFIG_SYS_HEAP_LISTENER
+	/* Before the block can be handed out again by another CPU */
+	heap_listener_notify_free(HEAP_ID_FROM_POINTER(heap), mem,
+				  m->class_bytes[cls] + chunk_header_bytes(h));
+#endif
+
+	mag = local_magazine(m);
+	key = k_spin_lock(&mag->lock);
+	if (mag->count[cls] == Z_HEAP_MAGAZINE_DEPTH) {
+		n = Z_HEAP_MAGAZINE_BATCH;
+		mag->count[cls] -= n;
+		memcpy(batch, &mag->blocks[cls][mag->count[cls]], n * sizeof(void *));
+	}
+	mag->blocks[cls][mag->count[cls]++] = mem;
+	k_spin_unlock(&mag->lock, key);
+
+	if (n > 0) {
+		flush_batch(heap, batch, n);
+	}
+
+	return true;
+}
+
+bool sys_heap_magazines_drain(struct sys_heap *heap)
+{
+	struct z_heap_magazines *m = heap->heap->magazines;
+	bool drained = false;
+
+	if (m == NULL) {
+		return false;
+	}
+
+	for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		struct z_heap_magazine *mag = &m->cpu[cpu];
+		k_spinlock_key_t key = k_spin_lock(&mag->lock);
+
+		for (int cls = 0; cls < Z_HEAP_MAGAZINE_CLASSES; cls++) {
+			while (mag->count[cls] > 0U) {
+				z_heap_free_quiet(heap, mag->blocks[cls][--mag->count[cls]]);
+				drained = true;
+			}
+		}
+
+		k_spin_unlock(&mag->lock, key);
+	}
+
+	return drained;
+}
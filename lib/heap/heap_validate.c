@@ -68,6 +68,54 @@ static inline void check_nexts(struct z_heap *h, int bidx)
 	}
 }
 
+#ifdef CONFIG_SYS_HEAP_MAGAZINES
+static bool cached_twice(struct z_heap_magazines *m, void *mem, int cpu, int cls, int idx)
+{
+	for (int i = 0; i <= cpu; i++) {
+		for (int j = 0; j < Z_HEAP_MAGAZINE_CLASSES; j++) {
+			for (int k = 0; k < m->cpu[i].count[j]; k++) {
+				if ((i == cpu) && (j == cls) && (k == idx)) {
+					return false;
+				}
+				if (m->cpu[i].blocks[j][k] == mem) {
+					return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+/* Every block cached in a magazine must be a distinct in-use chunk
+ * whose size matches its class.
+ */
+static bool valid_magazines(struct sys_heap *heap)
+{
+	struct z_heap *h = heap->heap;
+	struct z_heap_magazines *m = h->magazines;
+
+	for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		struct z_heap_magazine *mag = &m->cpu[cpu];
+
+		for (int cls = 0; cls < Z_HEAP_MAGAZINE_CLASSES; cls++) {
+			VALIDATE(mag->count[cls] <= Z_HEAP_MAGAZINE_DEPTH);
+
+			for (int i = 0; i < mag->count[cls]; i++) {
+				uint8_t *mem = mag->blocks[cls][i];
+				chunkid_t c = (mem - chunk_header_bytes(h) -
+					       (uint8_t *)chunk_buf(h)) / CHUNK_UNIT;
+
+				VALIDATE(in_bounds(h, c));
+				VALIDATE(chunk_used(h, c));
+				VALIDATE(sys_heap_usable_size(heap, mem) == m->class_bytes[cls]);
+				VALIDATE(!cached_twice(m, mem, cpu, cls, i));
+			}
+		}
+	}
+	return true;
+}
+#endif
+
 bool sys_heap_validate(struct sys_heap *heap)
 {
 	struct z_heap *h = heap->heap;
@@ -103,6 +151,12 @@ bool sys_heap_validate(struct sys_heap *heap)
 	}
 #endif
 
+#ifdef CONFIG_SYS_HEAP_MAGAZINES
+	if ((h->magazines != NULL) && !valid_magazines(heap)) {
+		return false;
+	}
+#endif
+
 	/* Check the free lists: entry count should match, empty bit
 	 * should be correct, and all chunk entries should point into
 	 * valid unused chunks.  Mark those chunks USED, temporarily.
@@ -23,6 +23,7 @@
 #include <zephyr/sys/speculation.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/zvfs/epoll.h>
 
 struct stat;
 
@@ -34,6 +35,10 @@ struct fd_entry {
 	struct k_condvar cond;
 	size_t offset;
 	uint32_t mode;
+#ifdef CONFIG_ZVFS_EPOLL
+	/* zvfs_close() started, epoll may no longer watch the fd */
+	bool closing;
+#endif
 };
 
 #if defined(CONFIG_POSIX_DEVICE_IO)
@@ -274,6 +279,9 @@ void zvfs_finalize_typed_fd(int fd, void *obj, const struct fd_op_vtable *vtable
 	fdtable[fd].obj = obj;
 	fdtable[fd].vtable = vtable;
 	fdtable[fd].mode = mode;
+#ifdef CONFIG_ZVFS_EPOLL
+	fdtable[fd].closing = false;
+#endif
 
 	/* Let the object know about the lock just in case it needs it
 	 * for something. For BSD sockets, the lock is used with condition
@@ -291,6 +299,14 @@ void zvfs_finalize_typed_fd(int fd, void *obj, const struct fd_op_vtable *vtable
 	}
 }
 
+#ifdef CONFIG_ZVFS_EPOLL
+bool zvfs_epoll_fd_closing(int fd)
+{
+	/* Assumes fd was already bounds-checked, and its lock is held. */
+	return fdtable[fd].closing;
+}
+#endif
+
 void zvfs_free_fd(int fd)
 {
 	/* Assumes fd was already bounds-checked. */
@@ -392,6 +408,17 @@ int zvfs_close(int fd)
 		return -1;
 	}
 
+#ifdef CONFIG_ZVFS_EPOLL
+	/* Poll events of epoll instances must not outlive the fd, and none
+	 * may be added once they are removed.
+	 */
+	(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
+	fdtable[fd].closing = true;
+	k_mutex_unlock(&fdtable[fd].lock);
+
+	zvfs_epoll_fd_close(fd);
+#endif
+
 	(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
 	if (fdtable[fd].vtable->close != NULL) {
 		/* close() is optional - e.g. stdinout_fd_op_vtable */
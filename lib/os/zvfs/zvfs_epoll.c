@@ -0,0 +1,593 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/zvfs/epoll.h>
+
+/* Sockets and eventfds use one poll event per direction */
+#define ZVFS_EPOLL_ITEM_EVENTS 2
+
+/* Ready poll events taken from the poll set at once */
+#define ZVFS_EPOLL_WAIT_BATCH 8
+
+#define ZVFS_EPOLL_POLL_EVENTS (ZVFS_EPOLLIN | ZVFS_EPOLLPRI | ZVFS_EPOLLOUT)
+#define ZVFS_EPOLL_ALWAYS      (ZVFS_EPOLLERR | ZVFS_EPOLLHUP)
+
+struct zvfs_epoll {
+	struct k_mutex lock;
+	struct k_poll_set set;
+	/* registered items */
+	sys_dlist_t items;
+	/* items to check at the next wait, whatever their poll events say */
+	sys_dlist_t rdlist;
+	/* incremented by every wait, so that items are reported once */
+	uint32_t seq;
+	bool in_use;
+};
+
+struct zvfs_epoll_item {
+	sys_dnode_t node;
+	sys_dnode_t rdnode;
+	struct zvfs_epoll *ep;
+	struct k_poll_event pev[ZVFS_EPOLL_ITEM_EVENTS];
+	uint8_t num_pev;
+	/* poll events are in the poll set */
+	bool armed;
+	int fd;
+	struct zvfs_epoll_event event;
+	uint32_t seq;
+};
+
+SYS_BITARRAY_DEFINE_STATIC(epolls_bitarray, CONFIG_ZVFS_EPOLL_MAX);
+static struct zvfs_epoll epolls[CONFIG_ZVFS_EPOLL_MAX];
+
+SYS_BITARRAY_DEFINE_STATIC(epoll_items_bitarray, CONFIG_ZVFS_EPOLL_MAX_ITEMS);
+static struct zvfs_epoll_item epoll_items[CONFIG_ZVFS_EPOLL_MAX_ITEMS];
+
+static const struct fd_op_vtable zvfs_epoll_fd_vtable;
+
+static inline bool epoll_item_is_edge(struct zvfs_epoll_item *item)
+{
+	return (item->event.events & ZVFS_EPOLLET) != 0;
+}
+
+static inline bool epoll_item_is_oneshot(struct zvfs_epoll_item *item)
+{
+	return (item->event.events & ZVFS_EPOLLONESHOT) != 0;
+}
+
+static struct zvfs_epoll_item *epoll_item_find(struct zvfs_epoll *ep, int fd)
+{
+	struct zvfs_epoll_item *item;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&ep->items, item, node) {
+		if (item->fd == fd) {
+			return item;
+		}
+	}
+
+	return NULL;
+}
+
+static void epoll_item_unarm(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	for (int i = 0; i < item->num_pev; i++) {
+		(void)k_poll_set_remove(&ep->set, &item->pev[i]);
+	}
+
+	item->num_pev = 0;
+	item->armed = false;
+}
+
+/*
+ * Prepare the poll events of an item through the poll hooks of its file
+ * descriptor and add them to the poll set. Edge-triggered items only wait
+ * for the next signal of their objects. Returns 1 if the file descriptor
+ * told it is ready without any poll event to wait for, e.g. at EOF.
+ */
+static int epoll_item_arm(struct zvfs_epoll *ep, struct zvfs_epoll_item *item, bool edge)
+{
+	struct zvfs_pollfd pfd = {
+		.fd = item->fd,
+		.events = item->event.events & ZVFS_EPOLL_POLL_EVENTS,
+	};
+	struct k_poll_event *pev = item->pev;
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	bool ready = false;
+	void *ctx;
+	int ret;
+
+	ctx = zvfs_get_fd_obj_and_vtable(item->fd, &vtable, &lock);
+	if (ctx == NULL) {
+		return -EBADF;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	if (zvfs_epoll_fd_closing(item->fd)) {
+		/* zvfs_epoll_fd_close() may already have run for it */
+		k_mutex_unlock(lock);
+		return -EBADF;
+	}
+	ret = zvfs_fdtable_call_ioctl(vtable, ctx, ZFD_IOCTL_POLL_PREPARE, &pfd, &pev,
+				      item->pev + ARRAY_SIZE(item->pev));
+	k_mutex_unlock(lock);
+
+	if (ret == -EALREADY) {
+		ready = true;
+	} else if (ret == -EXDEV || (ret == -1 && errno == EOPNOTSUPP)) {
+		/* Offloaded sockets and files cannot be waited for here */
+		return -EPERM;
+	} else if (ret == -1) {
+		return -errno;
+	} else if (ret < 0) {
+		return ret;
+	}
+
+	item->num_pev = pev - item->pev;
+	for (int i = 0; i < item->num_pev; i++) {
+		item->pev[i].tag = i;
+		if (edge) {
+			k_poll_set_arm(&ep->set, &item->pev[i]);
+		} else {
+			k_poll_set_add(&ep->set, &item->pev[i]);
+		}
+	}
+	item->armed = true;
+
+	return ready ? 1 : 0;
+}
+
+/* Get the events an item is ready for from the poll hooks of its fd */
+static uint32_t epoll_item_poll(struct zvfs_epoll_item *item, struct k_poll_event *pev)
+{
+	struct zvfs_pollfd pfd = {
+		.fd = item->fd,
+		.events = item->event.events & ZVFS_EPOLL_POLL_EVENTS,
+	};
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *ctx;
+	int ret;
+
+	ctx = zvfs_get_fd_obj_and_vtable(item->fd, &vtable, &lock);
+	if (ctx == NULL) {
+		return ZVFS_EPOLLERR;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = zvfs_fdtable_call_ioctl(vtable, ctx, ZFD_IOCTL_POLL_UPDATE, &pfd, &pev);
+	k_mutex_unlock(lock);
+
+	if (ret == -EAGAIN) {
+		/* e.g. TLS got data, but not a whole record yet */
+		return 0;
+	} else if (ret != 0) {
+		return ZVFS_EPOLLERR;
+	}
+
+	return (uint16_t)pfd.revents & (item->event.events | ZVFS_EPOLL_ALWAYS);
+}
+
+static void epoll_rdlist_add(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	if (!sys_dnode_is_linked(&item->rdnode)) {
+		sys_dlist_append(&ep->rdlist, &item->rdnode);
+	}
+}
+
+static void epoll_rdlist_remove(struct zvfs_epoll_item *item)
+{
+	if (sys_dnode_is_linked(&item->rdnode)) {
+		sys_dlist_remove(&item->rdnode);
+	}
+}
+
+static void epoll_item_rearm_edge(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	epoll_item_unarm(ep, item);
+	(void)epoll_item_arm(ep, item, true);
+}
+
+/*
+ * Get the events an armed item is ready for. Edge-triggered items wait for
+ * the next signal of their objects before the events are collected from a
+ * copy of the signaled poll events, so that a signal in between is seen by
+ * the next wait instead of being lost.
+ */
+static uint32_t epoll_item_collect(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	struct k_poll_event pev[ZVFS_EPOLL_ITEM_EVENTS];
+
+	if (!epoll_item_is_edge(item) || epoll_item_is_oneshot(item)) {
+		return epoll_item_poll(item, item->pev);
+	}
+
+	memcpy(pev, item->pev, item->num_pev * sizeof(pev[0]));
+	epoll_item_rearm_edge(ep, item);
+
+	return epoll_item_poll(item, pev);
+}
+
+/* Store an item in the events returned by a wait, and see to its next report */
+static void epoll_item_report(struct zvfs_epoll *ep, struct zvfs_epoll_item *item,
+			      uint32_t revents, struct zvfs_epoll_event *event)
+{
+	event->events = revents;
+	event->data = item->event.data;
+
+	if (epoll_item_is_oneshot(item)) {
+		/* disabled until ZVFS_EPOLL_CTL_MOD */
+		epoll_rdlist_remove(item);
+		epoll_item_unarm(ep, item);
+	} else if (epoll_item_is_edge(item)) {
+		/* already rearmed by epoll_item_collect() */
+		epoll_rdlist_remove(item);
+	} else {
+		/* level-triggered: check it again at the next wait */
+		epoll_rdlist_add(ep, item);
+	}
+}
+
+/* Check the items reported by the last wait, or found ready when armed */
+static int epoll_check_rdlist(struct zvfs_epoll *ep, struct zvfs_epoll_event *events,
+			      int maxevents)
+{
+	struct zvfs_epoll_item *item;
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+	uint32_t revents;
+	int count = 0;
+	int ret;
+
+	sys_dlist_init(&pending);
+	while ((node = sys_dlist_get(&ep->rdlist)) != NULL) {
+		sys_dlist_append(&pending, node);
+	}
+
+	while ((count < maxevents) && ((node = sys_dlist_get(&pending)) != NULL)) {
+		item = CONTAINER_OF(node, struct zvfs_epoll_item, rdnode);
+		item->seq = ep->seq;
+
+		/* Fresh poll events tell the current state of the fd */
+		epoll_item_unarm(ep, item);
+		ret = epoll_item_arm(ep, item, false);
+		revents = (ret < 0) ? ZVFS_EPOLLERR : epoll_item_collect(ep, item);
+
+		if (revents != 0) {
+			epoll_item_report(ep, item, revents, &events[count++]);
+		}
+	}
+
+	/* Whatever did not fit in the events array waits for the next call */
+	while ((node = sys_dlist_get(&pending)) != NULL) {
+		sys_dlist_append(&ep->rdlist, node);
+	}
+
+	return count;
+}
+
+/* Check the items of the poll events found ready by the poll set */
+static int epoll_check_ready(struct zvfs_epoll *ep, struct k_poll_event **ready, int num_ready,
+			     struct zvfs_epoll_event *events)
+{
+	struct zvfs_epoll_item *item;
+	uint32_t revents;
+	int count = 0;
+
+	for (int i = 0; i < num_ready; i++) {
+		struct k_poll_event *pev = ready[i];
+
+		if (pev->tag >= ZVFS_EPOLL_ITEM_EVENTS) {
+			continue;
+		}
+
+		item = CONTAINER_OF(pev - pev->tag, struct zvfs_epoll_item, pev[0]);
+
+		/* The item may have been removed while the lock was released */
+		if ((item->ep != ep) || !item->armed || (pev->tag >= item->num_pev) ||
+		    (item->seq == ep->seq)) {
+			continue;
+		}
+
+		item->seq = ep->seq;
+		revents = epoll_item_collect(ep, item);
+
+		if (revents != 0) {
+			epoll_item_report(ep, item, revents, &events[count++]);
+		}
+	}
+
+	return count;
+}
+
+static void epoll_item_free(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	int err;
+
+	epoll_item_unarm(ep, item);
+	epoll_rdlist_remove(item);
+	sys_dlist_remove(&item->node);
+	item->ep = NULL;
+
+	err = sys_bitarray_free(&epoll_items_bitarray, 1, item - epoll_items);
+	__ASSERT(err == 0, "sys_bitarray_free() failed: %d", err);
+}
+
+static int epoll_ctl_add(struct zvfs_epoll *ep, int fd, struct zvfs_epoll_event *event)
+{
+	struct zvfs_epoll_item *item;
+	size_t offset;
+	int ret;
+
+	if (epoll_item_find(ep, fd) != NULL) {
+		return -EEXIST;
+	}
+
+	if (sys_bitarray_alloc(&epoll_items_bitarray, 1, &offset) < 0) {
+		return -ENOMEM;
+	}
+
+	item = &epoll_items[offset];
+	*item = (struct zvfs_epoll_item){
+		.ep = ep,
+		.fd = fd,
+		.event = *event,
+		.seq = ep->seq - 1,
+	};
+	sys_dlist_append(&ep->items, &item->node);
+
+	ret = epoll_item_arm(ep, item, false);
+	if (ret < 0) {
+		epoll_item_free(ep, item);
+		return ret;
+	}
+
+	if (ret > 0) {
+		epoll_rdlist_add(ep, item);
+	}
+
+	return 0;
+}
+
+static int epoll_ctl_mod(struct zvfs_epoll *ep, int fd, struct zvfs_epoll_event *event)
+{
+	struct zvfs_epoll_item *item;
+	int ret;
+
+	item = epoll_item_find(ep, fd);
+	if (item == NULL) {
+		return -ENOENT;
+	}
+
+	epoll_item_unarm(ep, item);
+	epoll_rdlist_remove(item);
+	item->event = *event;
+
+	ret = epoll_item_arm(ep, item, false);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (ret > 0) {
+		epoll_rdlist_add(ep, item);
+	}
+
+	return 0;
+}
+
+static int zvfs_epoll_close_op(void *obj)
+{
+	struct zvfs_epoll *ep = obj;
+	struct zvfs_epoll_item *item;
+	struct zvfs_epoll_item *next;
+	int err;
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ep->items, item, next, node) {
+		epoll_item_free(ep, item);
+	}
+
+	ep->in_use = false;
+
+	k_mutex_unlock(&ep->lock);
+
+	err = sys_bitarray_free(&epolls_bitarray, 1, ep - epolls);
+	__ASSERT(err == 0, "sys_bitarray_free() failed: %d", err);
+
+	return 0;
+}
+
+static int zvfs_epoll_ioctl_op(void *obj, unsigned int request, va_list args)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(request);
+	ARG_UNUSED(args);
+
+	/* Neither poll nor epoll can watch an epoll instance */
+	errno = EOPNOTSUPP;
+	return -1;
+}
+
+static const struct fd_op_vtable zvfs_epoll_fd_vtable = {
+	.close = zvfs_epoll_close_op,
+	.ioctl = zvfs_epoll_ioctl_op,
+};
+
+/*
+ * Public-facing API
+ */
+
+int zvfs_epoll_create1(int flags)
+{
+	struct zvfs_epoll *ep;
+	size_t offset;
+	int fd;
+
+	if (flags & ~ZVFS_EPOLL_CLOEXEC) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (sys_bitarray_alloc(&epolls_bitarray, 1, &offset) < 0) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	ep = &epolls[offset];
+
+	fd = zvfs_reserve_fd();
+	if (fd < 0) {
+		sys_bitarray_free(&epolls_bitarray, 1, offset);
+		return -1;
+	}
+
+	k_mutex_init(&ep->lock);
+	k_poll_set_init(&ep->set);
+	sys_dlist_init(&ep->items);
+	sys_dlist_init(&ep->rdlist);
+	ep->in_use = true;
+
+	zvfs_finalize_fd(fd, ep, &zvfs_epoll_fd_vtable);
+
+	return fd;
+}
+
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event)
+{
+	struct zvfs_epoll *ep;
+	int ret;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EINVAL);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (fd == epfd) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if ((op != ZVFS_EPOLL_CTL_DEL) && (event == NULL)) {
+		errno = EFAULT;
+		return -1;
+	}
+
+	if (zvfs_get_fd_obj(fd, NULL, EBADF) == NULL) {
+		return -1;
+	}
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	switch (op) {
+	case ZVFS_EPOLL_CTL_ADD:
+		ret = epoll_ctl_add(ep, fd, event);
+		break;
+	case ZVFS_EPOLL_CTL_MOD:
+		ret = epoll_ctl_mod(ep, fd, event);
+		break;
+	case ZVFS_EPOLL_CTL_DEL: {
+		struct zvfs_epoll_item *item = epoll_item_find(ep, fd);
+
+		if (item == NULL) {
+			ret = -ENOENT;
+		} else {
+			epoll_item_free(ep, item);
+			ret = 0;
+		}
+	} break;
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	k_mutex_unlock(&ep->lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout)
+{
+	struct k_poll_event *ready[ZVFS_EPOLL_WAIT_BATCH];
+	struct zvfs_epoll *ep;
+	k_timepoint_t end;
+	int count;
+	int ret;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EINVAL);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	end = sys_timepoint_calc((timeout < 0) ? K_FOREVER : K_MSEC(timeout));
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	ep->seq++;
+	count = epoll_check_rdlist(ep, events, maxevents);
+
+	/*
+	 * Only wait while nothing is ready: a level-triggered poll event is
+	 * handed back by every call to the poll set while it is ready.
+	 */
+	while (count < maxevents) {
+		k_timeout_t wait = (count > 0) ? K_NO_WAIT : sys_timepoint_timeout(end);
+
+		k_mutex_unlock(&ep->lock);
+		ret = k_poll_set_wait(&ep->set, ready,
+				      MIN(ARRAY_SIZE(ready), maxevents - count), wait);
+		(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+		if (ret > 0) {
+			count += epoll_check_ready(ep, ready, ret, &events[count]);
+		}
+
+		if ((count > 0) || (ret == -EAGAIN)) {
+			break;
+		}
+	}
+
+	k_mutex_unlock(&ep->lock);
+
+	return count;
+}
+
+void zvfs_epoll_fd_close(int fd)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(epolls); i++) {
+		struct zvfs_epoll *ep = &epolls[i];
+		struct zvfs_epoll_item *item;
+
+		if (!ep->in_use) {
+			continue;
+		}
+
+		(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+		item = ep->in_use ? epoll_item_find(ep, fd) : NULL;
+		if (item != NULL) {
+			epoll_item_free(ep, item);
+		}
+
+		k_mutex_unlock(&ep->lock);
+	}
+}
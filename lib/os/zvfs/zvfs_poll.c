@@ -17,13 +17,47 @@ bool net_socket_is_tls(void *obj);
 #define net_socket_is_tls(obj) false
 #endif
 
+/* Returns 1 if the fd has returned events, 0 if it has none, or a negative
+ * error code (-EAGAIN to wait again).
+ */
+static int poll_update_fd(struct zvfs_pollfd *pfd, struct k_poll_event **pev)
+{
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *ctx;
+	int result;
+
+	ctx = zvfs_get_fd_obj_and_vtable(pfd->fd, &vtable, &lock);
+	if (ctx == NULL) {
+		pfd->revents = ZVFS_POLLNVAL;
+		return 1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	result = zvfs_fdtable_call_ioctl(vtable, ctx, ZFD_IOCTL_POLL_UPDATE, pfd, pev);
+	k_mutex_unlock(lock);
+
+	if (result != 0) {
+		return result;
+	}
+
+	return (pfd->revents != 0) ? 1 : 0;
+}
+
 int zvfs_poll_internal(struct zvfs_pollfd *fds, int nfds, k_timeout_t timeout)
 {
 	bool retry;
+	bool scan_all = false;
 	int ret = 0;
 	int i;
 	struct zvfs_pollfd *pfd;
 	struct k_poll_event poll_events[CONFIG_ZVFS_POLL_MAX];
+	struct k_poll_event *ready[CONFIG_ZVFS_POLL_MAX];
+	/* Index in fds of the fd each event was prepared for */
+	int event_fd[CONFIG_ZVFS_POLL_MAX];
+	struct k_poll_set set;
+	int num_events;
+	int num_ready;
 	struct k_poll_event *pev;
 	struct k_poll_event *pev_end = poll_events + ARRAY_SIZE(poll_events);
 	const struct fd_op_vtable *vtable;
@@ -37,6 +71,7 @@ int zvfs_poll_internal(struct zvfs_pollfd *fds, int nfds, k_timeout_t timeout)
 
 	pev = poll_events;
 	for (pfd = fds, i = nfds; i--; pfd++) {
+		struct k_poll_event *pev_start = pev;
 		void *ctx;
 		int result;
 
@@ -48,6 +83,7 @@ int zvfs_poll_internal(struct zvfs_pollfd *fds, int nfds, k_timeout_t timeout)
 		ctx = zvfs_get_fd_obj_and_vtable(pfd->fd, &vtable, &lock);
 		if (ctx == NULL) {
 			/* Will set POLLNVAL in return loop */
+			scan_all = true;
 			continue;
 		}
 
@@ -63,6 +99,7 @@ int zvfs_poll_internal(struct zvfs_pollfd *fds, int nfds, k_timeout_t timeout)
 			 */
 			timeout = K_NO_WAIT;
 			end = sys_timepoint_calc(timeout);
+			scan_all = true;
 			result = 0;
 		} else if (result == -EXDEV) {
 			/* If POLL_PREPARE returned EXDEV, it means
@@ -88,6 +125,16 @@ int zvfs_poll_internal(struct zvfs_pollfd *fds, int nfds, k_timeout_t timeout)
 			errno = -result;
 			return -1;
 		}
+
+		/* An fd without events can be ready without being signaled,
+		 * it is checked after every wait.
+		 */
+		if (pev == pev_start) {
+			scan_all = true;
+		}
+		for (; pev_start < pev; pev_start++) {
+			event_fd[pev_start - poll_events] = pfd - fds;
+		}
 	}
 
 	if (offload) {
@@ -105,51 +152,83 @@ int zvfs_poll_internal(struct zvfs_pollfd *fds, int nfds, k_timeout_t timeout)
 
 	timeout = sys_timepoint_timeout(end);
 
+	/* Events stay registered on their objects when we have to retry, and
+	 * each wait only goes through the events signaled in the meantime.
+	 */
+	num_events = pev - poll_events;
+	k_poll_set_init(&set);
+	for (i = 0; i < num_events; i++) {
+		k_poll_set_add(&set, &poll_events[i]);
+	}
+
 	do {
-		ret = k_poll(poll_events, pev - poll_events, timeout);
-		/* EAGAIN when timeout expired, EINTR when cancelled (i.e. EOF) */
-		if (ret != 0 && ret != -EAGAIN && ret != -EINTR) {
-			errno = -ret;
-			return -1;
+		/* EAGAIN when timeout expired, then no event is ready. Cancelled
+		 * events (i.e. EOF) are returned as ready.
+		 */
+		num_ready = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), timeout);
+
+		/* Not every change of state is signaled, e.g. a failed TCP
+		 * connect, so the fds are all checked once more before
+		 * returning on a timeout.
+		 */
+		if (num_ready < 0) {
+			scan_all = true;
 		}
 
 		retry = false;
 		ret = 0;
 
-		pev = poll_events;
 		for (pfd = fds, i = nfds; i--; pfd++) {
-			void *ctx;
-			int result;
-
 			pfd->revents = 0;
+		}
 
-			if (pfd->fd < 0) {
-				continue;
-			}
+		/* Only the fds of the ready events are updated, unless some
+		 * fd has to be checked anyway.
+		 */
+		pev = poll_events;
+		for (i = 0; scan_all ? (i < nfds) : (i < num_ready); i++) {
+			int result;
 
-			ctx = zvfs_get_fd_obj_and_vtable(pfd->fd, &vtable, &lock);
-			if (ctx == NULL) {
-				pfd->revents = ZVFS_POLLNVAL;
-				ret++;
-				continue;
+			if (scan_all) {
+				pfd = &fds[i];
+				if (pfd->fd < 0) {
+					continue;
+				}
+			} else {
+				int ev = ready[i] - poll_events;
+				int first = ev;
+				bool seen = false;
+
+				/* An fd is updated once for all its events, which
+				 * are next to each other.
+				 */
+				for (int j = 0; j < i; j++) {
+					if (event_fd[ready[j] - poll_events] == event_fd[ev]) {
+						seen = true;
+						break;
+					}
+				}
+				if (seen) {
+					continue;
+				}
+
+				while ((first > 0) && (event_fd[first - 1] == event_fd[ev])) {
+					first--;
+				}
+
+				pfd = &fds[event_fd[ev]];
+				pev = &poll_events[first];
 			}
 
-			(void)k_mutex_lock(lock, K_FOREVER);
-
-			result = zvfs_fdtable_call_ioctl(vtable, ctx, ZFD_IOCTL_POLL_UPDATE, pfd,
-							 &pev);
-			k_mutex_unlock(lock);
-
+			result = poll_update_fd(pfd, &pev);
 			if (result == -EAGAIN) {
 				retry = true;
-				continue;
-			} else if (result != 0) {
+			} else if (result < 0) {
 				errno = -result;
-				return -1;
-			}
-
-			if (pfd->revents != 0) {
-				ret++;
+				ret = -1;
+				goto out;
+			} else {
+				ret += result;
 			}
 		}
 
@@ -166,6 +245,11 @@ int zvfs_poll_internal(struct zvfs_pollfd *fds, int nfds, k_timeout_t timeout)
 		}
 	} while (retry);
 
+out:
+	for (i = 0; i < num_events; i++) {
+		(void)k_poll_set_remove(&set, &poll_events[i]);
+	}
+
 	return ret;
 }
 
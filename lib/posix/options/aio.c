@@ -6,77 +6,576 @@
 
 #include <errno.h>
 #include <signal.h>
+#include <stdint.h>
 
+#include <zephyr/kernel.h>
 #include <zephyr/posix/aio.h>
+#include <zephyr/posix/posix_features.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/work.h>
+#include <zephyr/sys/timeutil.h>
 
+/* prototypes for external, not-yet-public, functions in fdtable.c */
+ssize_t zvfs_read(int fd, void *buf, size_t sz, size_t *from_offset);
+ssize_t zvfs_write(int fd, const void *buf, size_t sz, size_t *from_offset);
+int zvfs_fsync(int fd);
+
+/* Notification of the completion of a whole lio_listio() list */
+struct aio_lio {
+	/* Operations of the list in progress, 0 when unused */
+	unsigned int pending;
+	struct sigevent sig;
+};
+
+struct aio_req {
+	/* Control block of the operation in progress, NULL when unused */
+	struct aiocb *aiocbp;
+	struct aio_lio *lio;
+};
+
+/* SIGEV_THREAD notification waiting for the notification thread */
+struct aio_notification {
+	void (*function)(union sigval value);
+	union sigval value;
+};
+
+static struct aio_req aio_reqs[CONFIG_POSIX_AIO_MAX];
+static struct aio_lio aio_lios[CONFIG_POSIX_AIO_MAX];
+static K_MUTEX_DEFINE(aio_lock);
+static K_CONDVAR_DEFINE(aio_cond);
+
+/* Each operation in progress notifies at most itself and its list */
+#define AIO_NOTIFY_MAX (2 * CONFIG_POSIX_AIO_MAX)
+
+static char __noinit __aligned(sizeof(void *))
+	aio_notify_buf[AIO_NOTIFY_MAX * sizeof(struct aio_notification)];
+static STRUCT_SECTION_ITERABLE(k_msgq, aio_notify_msgq) =
+	Z_MSGQ_INITIALIZER(aio_notify_msgq, aio_notify_buf, sizeof(struct aio_notification),
+			   AIO_NOTIFY_MAX);
+
+RTIO_DEFINE(aio_rtio, CONFIG_POSIX_AIO_MAX, CONFIG_POSIX_AIO_MAX);
+
+static ssize_t aio_rw(struct aiocb *aiocbp, uint8_t *buf, size_t len, bool is_write)
+{
+	size_t off = aiocbp->aio_offset;
+	size_t *offp = &off;
+	ssize_t ret;
+
+	while (true) {
+		if (is_write) {
+			ret = zvfs_write(aiocbp->aio_fildes, buf, len, offp);
+		} else {
+			ret = zvfs_read(aiocbp->aio_fildes, buf, len, offp);
+		}
+
+		/* aio_offset is ignored for file descriptors that cannot seek */
+		if (ret < 0 && errno == ENOTSUP && offp != NULL) {
+			offp = NULL;
+			continue;
+		}
+
+		return ret;
+	}
+}
+
+static void aio_work_handler(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	struct aio_req *req = sqe->userdata;
+	ssize_t ret;
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		ret = aio_rw(req->aiocbp, sqe->rx.buf, sqe->rx.buf_len, false);
+		break;
+	case RTIO_OP_TX:
+		ret = aio_rw(req->aiocbp, (uint8_t *)sqe->tx.buf, sqe->tx.buf_len, true);
+		break;
+	default:
+		ret = zvfs_fsync(req->aiocbp->aio_fildes);
+		break;
+	}
+
+	if (ret < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, -errno);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, ret);
+	}
+}
+
+static void aio_reap(void);
+
+static void aio_work_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	aio_work_handler(iodev_sqe);
+	aio_reap();
+}
+
+static void aio_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_work_req *req = rtio_work_req_alloc();
+
+	/*
+	 * None of the fd table objects has an asynchronous path of its own, so their
+	 * blocking calls are run on the RTIO work queue.
+	 */
+	if (req == NULL) {
+		rtio_iodev_sqe_err(iodev_sqe, -EAGAIN);
+		return;
+	}
+
+	rtio_work_req_submit(req, iodev_sqe, aio_work_submit);
+}
+
+static const struct rtio_iodev_api aio_iodev_api = {
+	.submit = aio_iodev_submit,
+};
+
+RTIO_IODEV_DEFINE(aio_iodev, &aio_iodev_api, NULL);
+
+static void aio_notify_thread(void *p1, void *p2, void *p3);
+
+K_THREAD_DEFINE(aio_notify_tid, CONFIG_POSIX_AIO_NOTIFY_STACK_SIZE, aio_notify_thread, NULL, NULL,
+		NULL, CONFIG_POSIX_AIO_NOTIFY_PRIORITY, 0, 0);
+
+static void aio_notify_thread(void *p1, void *p2, void *p3)
+{
+	struct aio_notification notification;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_msgq_get(&aio_notify_msgq, &notification, K_FOREVER);
+		notification.function(notification.value);
+	}
+}
+
+/*
+ * Hand a notification over to the notification thread, so that neither the RTIO work queue
+ * threads nor the submitting thread run application code.
+ */
+static void aio_notify(const struct sigevent *sig)
+{
+	struct aio_notification notification;
+
+	if (sig->sigev_notify != SIGEV_THREAD || sig->sigev_notify_function == NULL) {
+		return;
+	}
+
+	notification = (struct aio_notification){
+		.function = sig->sigev_notify_function,
+		.value = sig->sigev_value,
+	};
+
+	if (k_current_get() == aio_notify_tid) {
+		/* Submitted from a notification: the queue cannot drain while this waits */
+		if (k_msgq_put(&aio_notify_msgq, &notification, K_NO_WAIT) != 0) {
+			notification.function(notification.value);
+		}
+		return;
+	}
+
+	(void)k_msgq_put(&aio_notify_msgq, &notification, K_FOREVER);
+}
+
+/* Move completions to their control block, then notify them */
+static void aio_reap(void)
+{
+	struct sigevent lio_sig;
+	struct sigevent sig;
+	struct rtio_cqe *cqe;
+	struct aio_req *req;
+	bool lio_done;
+
+	while (true) {
+		(void)k_mutex_lock(&aio_lock, K_FOREVER);
+
+		cqe = rtio_cqe_consume(&aio_rtio);
+		if (cqe == NULL) {
+			k_mutex_unlock(&aio_lock);
+			break;
+		}
+
+		req = cqe->userdata;
+		sig = req->aiocbp->aio_sigevent;
+		lio_done = false;
+		if (req->lio != NULL && --req->lio->pending == 0) {
+			lio_sig = req->lio->sig;
+			lio_done = true;
+		}
+
+		/* The control block may be reused as soon as its status is updated */
+		req->aiocbp->__return_value = (cqe->result < 0) ? -1 : cqe->result;
+		req->aiocbp->__error_code = (cqe->result < 0) ? -cqe->result : 0;
+		*req = (struct aio_req){0};
+		rtio_cqe_release(&aio_rtio, cqe);
+
+		k_condvar_broadcast(&aio_cond);
+		k_mutex_unlock(&aio_lock);
+
+		aio_notify(&sig);
+		if (lio_done) {
+			aio_notify(&lio_sig);
+		}
+	}
+}
+
+static int aio_check_sigevent(const struct sigevent *sig)
+{
+	if (sig->sigev_notify != SIGEV_NONE && sig->sigev_notify != SIGEV_THREAD) {
+		return EINVAL;
+	}
+
+	return 0;
+}
+
+static struct aio_req *aio_req_alloc(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(aio_reqs); i++) {
+		if (aio_reqs[i].aiocbp == NULL) {
+			return &aio_reqs[i];
+		}
+	}
+
+	return NULL;
+}
+
+static size_t aio_req_free_count(void)
+{
+	size_t count = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(aio_reqs); i++) {
+		if (aio_reqs[i].aiocbp == NULL) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+/* Queue an operation on the RTIO context, to be submitted by the caller */
+static int aio_queue(struct aiocb *aiocbp, uint8_t op, struct aio_lio *lio)
+{
+	struct aio_req *req;
+	struct rtio_sqe *sqe;
+	int ret;
+
+	if (aiocbp->aio_reqprio < 0 || aiocbp->aio_reqprio > AIO_PRIO_DELTA_MAX) {
+		return EINVAL;
+	}
+
+	if (op != RTIO_OP_NOP &&
+	    (aiocbp->aio_offset < 0 || aiocbp->aio_nbytes > UINT32_MAX)) {
+		return EINVAL;
+	}
+
+	ret = aio_check_sigevent(&aiocbp->aio_sigevent);
+	if (ret != 0) {
+		return ret;
+	}
+
+	req = aio_req_alloc();
+	if (req == NULL) {
+		return EAGAIN;
+	}
+
+	sqe = rtio_sqe_acquire(&aio_rtio);
+	if (sqe == NULL) {
+		return EAGAIN;
+	}
+
+	switch (op) {
+	case RTIO_OP_RX:
+		rtio_sqe_prep_read(sqe, &aio_iodev, RTIO_PRIO_NORM, (uint8_t *)aiocbp->aio_buf,
+				   aiocbp->aio_nbytes, req);
+		break;
+	case RTIO_OP_TX:
+		rtio_sqe_prep_write(sqe, &aio_iodev, RTIO_PRIO_NORM,
+				    (const uint8_t *)aiocbp->aio_buf, aiocbp->aio_nbytes, req);
+		break;
+	default:
+		rtio_sqe_prep_nop(sqe, &aio_iodev, req);
+		break;
+	}
+
+	req->aiocbp = aiocbp;
+	req->lio = lio;
+	if (lio != NULL) {
+		lio->pending++;
+	}
+
+	aiocbp->__return_value = 0;
+	aiocbp->__error_code = EINPROGRESS;
+
+	return 0;
+}
+
+static int aio_submit(struct aiocb *aiocbp, uint8_t op)
+{
+	int ret;
+
+	if (aiocbp == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	ret = aio_queue(aiocbp, op, NULL);
+	if (ret == 0) {
+		(void)rtio_submit(&aio_rtio, 0);
+	}
+	k_mutex_unlock(&aio_lock);
+
+	/* Completions of operations which could not be started */
+	aio_reap();
+
+	if (ret != 0) {
+		errno = ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Cancel asynchronous I/O operations.
+ *
+ * Operations are not cancelled once submitted, as the fd table objects do not support
+ * aborting a blocking call.
+ *
+ * See IEEE 1003.1
+ */
 int aio_cancel(int fildes, struct aiocb *aiocbp)
 {
-	ARG_UNUSED(fildes);
-	ARG_UNUSED(aiocbp);
+	int ret = AIO_ALLDONE;
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	for (size_t i = 0; i < ARRAY_SIZE(aio_reqs); i++) {
+		if (aio_reqs[i].aiocbp == NULL) {
+			continue;
+		}
+
+		if (aiocbp != NULL ? aio_reqs[i].aiocbp == aiocbp
+				   : aio_reqs[i].aiocbp->aio_fildes == fildes) {
+			ret = AIO_NOTCANCELED;
+			break;
+		}
+	}
+	k_mutex_unlock(&aio_lock);
 
-	errno = ENOSYS;
-	return -1;
+	return ret;
 }
 
 int aio_error(const struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
+	if (aiocbp == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
 
-	errno = ENOSYS;
-	return -1;
+	return aiocbp->__error_code;
 }
 
-int aio_fsync(int fildes, struct aiocb *aiocbp)
+/**
+ * @brief Asynchronously synchronize a file.
+ *
+ * @a op is not checked, as O_SYNC and O_DSYNC are not defined, and both behave as fsync().
+ *
+ * See IEEE 1003.1
+ */
+int aio_fsync(int op, struct aiocb *aiocbp)
 {
-	ARG_UNUSED(fildes);
-	ARG_UNUSED(aiocbp);
+	ARG_UNUSED(op);
 
-	errno = ENOSYS;
-	return -1;
+	return aio_submit(aiocbp, RTIO_OP_NOP);
 }
 
 int aio_read(struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
-
-	errno = ENOSYS;
-	return -1;
+	return aio_submit(aiocbp, RTIO_OP_RX);
 }
 
 ssize_t aio_return(struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
+	if (aiocbp == NULL || aiocbp->__error_code == EINPROGRESS) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	return aiocbp->__return_value;
+}
+
+static bool aio_any_done(const struct aiocb *const list[], int nent)
+{
+	for (int i = 0; i < nent; i++) {
+		if (list[i] != NULL && list[i]->__error_code != EINPROGRESS) {
+			return true;
+		}
+	}
 
-	errno = ENOSYS;
-	return -1;
+	return false;
 }
 
 int aio_suspend(const struct aiocb *const list[], int nent, const struct timespec *timeout)
 {
-	ARG_UNUSED(list);
-	ARG_UNUSED(nent);
-	ARG_UNUSED(timeout);
+	k_timepoint_t end;
+	int ret = 0;
 
-	errno = ENOSYS;
-	return -1;
+	if (list == NULL || nent < 0 || (timeout != NULL && !timespec_is_valid(timeout))) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	end = sys_timepoint_calc(timeout == NULL ? K_FOREVER : timespec_to_timeout(timeout));
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	while (!aio_any_done(list, nent)) {
+		if (sys_timepoint_expired(end)) {
+			ret = -1;
+			errno = EAGAIN;
+			break;
+		}
+
+		(void)k_condvar_wait(&aio_cond, &aio_lock, sys_timepoint_timeout(end));
+	}
+	k_mutex_unlock(&aio_lock);
+
+	return ret;
 }
 
 int aio_write(struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
+	return aio_submit(aiocbp, RTIO_OP_TX);
+}
 
-	errno = ENOSYS;
-	return -1;
+static uint8_t lio_opcode_to_op(int opcode)
+{
+	return (opcode == LIO_READ) ? RTIO_OP_RX : RTIO_OP_TX;
+}
+
+static bool lio_is_op(const struct aiocb *aiocbp)
+{
+	return aiocbp != NULL &&
+	       (aiocbp->aio_lio_opcode == LIO_READ || aiocbp->aio_lio_opcode == LIO_WRITE);
 }
 
+static struct aio_lio *aio_lio_alloc(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(aio_lios); i++) {
+		if (aio_lios[i].pending == 0) {
+			return &aio_lios[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Initiate a list of I/O requests.
+ *
+ * All operations of the list are submitted to RTIO at once.
+ *
+ * See IEEE 1003.1
+ */
 int lio_listio(int mode, struct aiocb *const ZRESTRICT list[], int nent,
 	       struct sigevent *ZRESTRICT sig)
 {
-	ARG_UNUSED(mode);
-	ARG_UNUSED(list);
-	ARG_UNUSED(nent);
-	ARG_UNUSED(sig);
+	struct aio_lio *lio = NULL;
+	bool lio_done = false;
+	size_t count = 0;
+	bool failed = false;
+	int ret;
+
+	if ((mode != LIO_WAIT && mode != LIO_NOWAIT) || list == NULL || nent < 0 ||
+	    nent > AIO_LISTIO_MAX) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (mode == LIO_NOWAIT && sig != NULL && aio_check_sigevent(sig) != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	for (int i = 0; i < nent; i++) {
+		if (lio_is_op(list[i])) {
+			count++;
+		}
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+
+	/* Either the whole list is queued, or none of it */
+	if (count > aio_req_free_count()) {
+		k_mutex_unlock(&aio_lock);
+		errno = EAGAIN;
+		return -1;
+	}
+
+	if (mode == LIO_NOWAIT && sig != NULL && sig->sigev_notify == SIGEV_THREAD) {
+		/* Only unavailable when every operation in progress has its own list */
+		lio = aio_lio_alloc();
+		if (lio == NULL) {
+			__ASSERT_NO_MSG(count == 0);
+			lio_done = true;
+		} else {
+			/* Hold a reference until the whole list is queued */
+			lio->pending = 1;
+			lio->sig = *sig;
+		}
+	}
+
+	for (int i = 0; i < nent; i++) {
+		if (!lio_is_op(list[i])) {
+			continue;
+		}
+
+		ret = aio_queue(list[i], lio_opcode_to_op(list[i]->aio_lio_opcode), lio);
+		if (ret != 0) {
+			list[i]->__return_value = -1;
+			list[i]->__error_code = ret;
+			failed = true;
+		}
+	}
+
+	(void)rtio_submit(&aio_rtio, 0);
+
+	if (lio != NULL && --lio->pending == 0) {
+		lio_done = true;
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	aio_reap();
+
+	if (lio_done) {
+		aio_notify(sig);
+	}
+
+	if (mode == LIO_WAIT) {
+		(void)k_mutex_lock(&aio_lock, K_FOREVER);
+		for (int i = 0; i < nent; i++) {
+			if (!lio_is_op(list[i])) {
+				continue;
+			}
+
+			while (list[i]->__error_code == EINPROGRESS) {
+				(void)k_condvar_wait(&aio_cond, &aio_lock, K_FOREVER);
+			}
+
+			if (list[i]->__error_code != 0) {
+				failed = true;
+			}
+		}
+		k_mutex_unlock(&aio_lock);
+	}
+
+	if (failed) {
+		errno = EIO;
+		return -1;
+	}
 
-	errno = ENOSYS;
-	return -1;
+	return 0;
 }
@@ -14,13 +14,8 @@
 #include <zephyr/sys/bitarray.h>
 #include <zephyr/sys/sem.h>
 
-#define CONCURRENT_READER_LIMIT  (CONFIG_POSIX_THREAD_THREADS_MAX + 1)
-
 struct posix_rwlock {
-	struct sys_sem rd_sem;
-	struct sys_sem wr_sem;
-	struct sys_sem reader_active; /* blocks WR till reader has acquired lock */
-	k_tid_t wr_owner;
+	struct k_rwlock lock;
 };
 
 struct posix_rwlockattr {
@@ -28,9 +23,6 @@ struct posix_rwlockattr {
 	bool pshared: 1;
 };
 
-static uint32_t read_lock_acquire(struct posix_rwlock *rwl, uint32_t timeout);
-static uint32_t write_lock_acquire(struct posix_rwlock *rwl, uint32_t timeout);
-
 LOG_MODULE_REGISTER(pthread_rwlock, CONFIG_PTHREAD_RWLOCK_LOG_LEVEL);
 
 static SYS_SEM_DEFINE(posix_rwlock_lock, 1, 1);
@@ -124,10 +116,7 @@ int pthread_rwlock_init(pthread_rwlock_t *rwlock,
 		return ENOMEM;
 	}
 
-	sys_sem_init(&rwl->rd_sem, CONCURRENT_READER_LIMIT, CONCURRENT_READER_LIMIT);
-	sys_sem_init(&rwl->wr_sem, 1, 1);
-	sys_sem_init(&rwl->reader_active, 1, 1);
-	rwl->wr_owner = NULL;
+	k_rwlock_init(&rwl->lock);
 
 	LOG_DBG("Initialized rwlock %p", rwl);
 
@@ -153,10 +142,12 @@ int pthread_rwlock_destroy(pthread_rwlock_t *rwlock)
 			SYS_SEM_LOCK_BREAK;
 		}
 
-		if (rwl->wr_owner != NULL) {
+		/* Held for reading or writing, by this thread or another */
+		if (k_rwlock_write_lock(&rwl->lock, K_NO_WAIT) != 0) {
 			ret = EBUSY;
 			SYS_SEM_LOCK_BREAK;
 		}
+		(void)k_rwlock_write_unlock(&rwl->lock);
 
 		ret = 0;
 		bit = posix_rwlock_to_offset(rwl);
@@ -167,11 +158,33 @@ int pthread_rwlock_destroy(pthread_rwlock_t *rwlock)
 	return ret;
 }
 
+static int read_lock_acquire(struct posix_rwlock *rwl, k_timeout_t timeout, int busy)
+{
+	int ret = k_rwlock_read_lock(&rwl->lock, timeout);
+
+	if (ret == -EDEADLK) {
+		return EDEADLK;
+	}
+
+	return (ret == 0) ? 0 : busy;
+}
+
+static int write_lock_acquire(struct posix_rwlock *rwl, k_timeout_t timeout, int busy)
+{
+	int ret = k_rwlock_write_lock(&rwl->lock, timeout);
+
+	if (ret == -EDEADLK) {
+		return EDEADLK;
+	}
+
+	return (ret == 0) ? 0 : busy;
+}
+
 /**
  * @brief Lock a read-write lock object for reading.
  *
- * API behaviour is unpredictable if number of concurrent reader
- * lock held is greater than CONCURRENT_READER_LIMIT.
+ * Readers do not get the lock while a writer of the same or higher
+ * priority is waiting for it.
  *
  * See IEEE 1003.1
  */
@@ -184,21 +197,17 @@ int pthread_rwlock_rdlock(pthread_rwlock_t *rwlock)
 		return EINVAL;
 	}
 
-	return read_lock_acquire(rwl, SYS_FOREVER_MS);
+	return read_lock_acquire(rwl, K_FOREVER, EBUSY);
 }
 
 /**
  * @brief Lock a read-write lock object for reading within specific time.
  *
- * API behaviour is unpredictable if number of concurrent reader
- * lock held is greater than CONCURRENT_READER_LIMIT.
- *
  * See IEEE 1003.1
  */
 int pthread_rwlock_timedrdlock(pthread_rwlock_t *rwlock,
 			       const struct timespec *abstime)
 {
-	uint32_t ret = 0U;
 	struct posix_rwlock *rwl;
 
 	if ((abstime == NULL) || !timespec_is_valid(abstime)) {
@@ -211,19 +220,14 @@ int pthread_rwlock_timedrdlock(pthread_rwlock_t *rwlock,
 		return EINVAL;
 	}
 
-	if (read_lock_acquire(rwl, timespec_to_timeoutms(CLOCK_REALTIME, abstime)) != 0U) {
-		ret = ETIMEDOUT;
-	}
-
-	return ret;
+	return read_lock_acquire(rwl,
+				 SYS_TIMEOUT_MS(timespec_to_timeoutms(CLOCK_REALTIME, abstime)),
+				 ETIMEDOUT);
 }
 
 /**
  * @brief Lock a read-write lock object for reading immediately.
  *
- * API behaviour is unpredictable if number of concurrent reader
- * lock held is greater than CONCURRENT_READER_LIMIT.
- *
  * See IEEE 1003.1
  */
 int pthread_rwlock_tryrdlock(pthread_rwlock_t *rwlock)
@@ -235,14 +239,14 @@ int pthread_rwlock_tryrdlock(pthread_rwlock_t *rwlock)
 		return EINVAL;
 	}
 
-	return read_lock_acquire(rwl, 0);
+	return read_lock_acquire(rwl, K_NO_WAIT, EBUSY);
 }
 
 /**
  * @brief Lock a read-write lock object for writing.
  *
- * Write lock does not have priority over reader lock,
- * threads get lock based on priority.
+ * Writers have priority over readers of the same or lower
+ * priority, waiting threads get the lock based on priority.
  *
  * See IEEE 1003.1
  */
@@ -255,21 +259,20 @@ int pthread_rwlock_wrlock(pthread_rwlock_t *rwlock)
 		return EINVAL;
 	}
 
-	return write_lock_acquire(rwl, SYS_FOREVER_MS);
+	return write_lock_acquire(rwl, K_FOREVER, EBUSY);
 }
 
 /**
  * @brief Lock a read-write lock object for writing within specific time.
  *
- * Write lock does not have priority over reader lock,
- * threads get lock based on priority.
+ * Writers have priority over readers of the same or lower
+ * priority, waiting threads get the lock based on priority.
  *
  * See IEEE 1003.1
  */
 int pthread_rwlock_timedwrlock(pthread_rwlock_t *rwlock,
 			       const struct timespec *abstime)
 {
-	uint32_t ret = 0U;
 	struct posix_rwlock *rwl;
 
 	if ((abstime == NULL) || !timespec_is_valid(abstime)) {
@@ -282,18 +285,16 @@ int pthread_rwlock_timedwrlock(pthread_rwlock_t *rwlock,
 		return EINVAL;
 	}
 
-	if (write_lock_acquire(rwl, timespec_to_timeoutms(CLOCK_REALTIME, abstime)) != 0U) {
-		ret = ETIMEDOUT;
-	}
-
-	return ret;
+	return write_lock_acquire(rwl,
+				  SYS_TIMEOUT_MS(timespec_to_timeoutms(CLOCK_REALTIME, abstime)),
+				  ETIMEDOUT);
 }
 
 /**
  * @brief Lock a read-write lock object for writing immediately.
  *
- * Write lock does not have priority over reader lock,
- * threads get lock based on priority.
+ * Writers have priority over readers of the same or lower
+ * priority, waiting threads get the lock based on priority.
  *
  * See IEEE 1003.1
  */
@@ -306,7 +307,7 @@ int pthread_rwlock_trywrlock(pthread_rwlock_t *rwlock)
 		return EINVAL;
 	}
 
-	return write_lock_acquire(rwl, 0);
+	return write_lock_acquire(rwl, K_NO_WAIT, EBUSY);
 }
 
 /**
@@ -324,69 +325,16 @@ int pthread_rwlock_unlock(pthread_rwlock_t *rwlock)
 		return EINVAL;
 	}
 
-	if (k_current_get() == rwl->wr_owner) {
-		/* Write unlock */
-		rwl->wr_owner = NULL;
-		(void)sys_sem_give(&rwl->reader_active);
-		(void)sys_sem_give(&rwl->wr_sem);
-	} else {
-		/* Read unlock */
-		(void)sys_sem_give(&rwl->rd_sem);
-
-		if (sys_sem_count_get(&rwl->rd_sem) == CONCURRENT_READER_LIMIT) {
-			/* Last read lock, unlock writer */
-			(void)sys_sem_give(&rwl->reader_active);
-		}
+	if (k_rwlock_write_unlock(&rwl->lock) == 0) {
+		return 0;
 	}
-	return 0;
-}
 
-static uint32_t read_lock_acquire(struct posix_rwlock *rwl, uint32_t timeout)
-{
-	uint32_t ret = 0U;
-
-	if (sys_sem_take(&rwl->wr_sem, SYS_TIMEOUT_MS(timeout)) == 0) {
-		(void)sys_sem_take(&rwl->reader_active, K_NO_WAIT);
-		(void)sys_sem_take(&rwl->rd_sem, K_NO_WAIT);
-		(void)sys_sem_give(&rwl->wr_sem);
-	} else {
-		ret = EBUSY;
+	/* Not the writer, so this must be a reader */
+	if (k_rwlock_read_unlock(&rwl->lock) != 0) {
+		return EPERM;
 	}
 
-	return ret;
-}
-
-static uint32_t write_lock_acquire(struct posix_rwlock *rwl, uint32_t timeout)
-{
-	uint32_t ret = 0U;
-	int64_t elapsed_time, st_time = k_uptime_get();
-	k_timeout_t k_timeout;
-
-	k_timeout = SYS_TIMEOUT_MS(timeout);
-
-	/* waiting for release of write lock */
-	if (sys_sem_take(&rwl->wr_sem, k_timeout) == 0) {
-		/* update remaining timeout time for 2nd sem */
-		if (timeout != SYS_FOREVER_MS) {
-			elapsed_time = k_uptime_get() - st_time;
-			timeout = timeout <= elapsed_time ? 0 :
-				  timeout - elapsed_time;
-		}
-
-		k_timeout = SYS_TIMEOUT_MS(timeout);
-
-		/* waiting for reader to complete operation */
-		if (sys_sem_take(&rwl->reader_active, k_timeout) == 0) {
-			rwl->wr_owner = k_current_get();
-		} else {
-			(void)sys_sem_give(&rwl->wr_sem);
-			ret = EBUSY;
-		}
-
-	} else {
-		ret = EBUSY;
-	}
-	return ret;
+	return 0;
 }
 
 int pthread_rwlockattr_getpshared(const pthread_rwlockattr_t *ZRESTRICT attr,
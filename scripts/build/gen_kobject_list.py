@@ -107,6 +107,7 @@ kobjects = OrderedDict([
     ("sys_mutex", (None, True, False)),
     ("k_futex", (None, True, False)),
     ("k_condvar", (None, False, True)),
+    ("k_rwlock", (None, False, True)),
     ("k_event", ("CONFIG_EVENTS", False, True)),
     ("ztest_suite_node", ("CONFIG_ZTEST", True, False)),
     ("ztest_suite_stats", ("CONFIG_ZTEST", True, False)),
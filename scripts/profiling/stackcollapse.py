@@ -8,18 +8,21 @@
 """
 Stack compressor for FlameGraph
 
-This translate stack samples captured by perf subsystem into format
-used by flamegraph.pl. Translation uses .elf file to get function names
+This translate stack samples captured by perf subsystem, or written to
+the tracing backend by the sampling profiler, into format used by
+flamegraph.pl. Translation uses .elf file to get function names
 from addresses
 
 Usage:
     ./script/perf/stackcollapse.py <file with perf printbuf output> <ELF file>
+    ./script/perf/stackcollapse.py <sampling profiler trace file> <ELF file>
 """
 
 import re
 import sys
 import struct
 import binascii
+from collections import Counter
 from functools import lru_cache
 from elftools.elf.elffile import ELFFile
 
@@ -54,12 +57,51 @@ def collapse(buf, elf):
         buf = buf[8 + 8 * count:]
 
 
+def merge_funcs(funcs):
+    # merge dublicate functions
+    merged = []
+    for func in funcs:
+        if not merged or merged[-1] != func:
+            merged.append(func)
+    return merged
+
+
+def collapse_sampler(lines, elf):
+    names = {}
+    stacks = Counter()
+    for line in lines:
+        fields = line.split()
+        if not fields:
+            continue
+        if fields[0] == "thread" and len(fields) >= 2:
+            names[fields[1]] = " ".join(fields[2:]) or fields[1]
+        elif fields[0] == "sample" and len(fields) >= 3:
+            thread = names.get(fields[1], fields[1])
+            # truncated samples miss their outermost frames
+            truncated = fields[-1] == "..."
+            if truncated:
+                fields = fields[:-1]
+            addrs = [int(a, 16) for a in fields[2:]]
+            funcs = merge_funcs(reversed([addr_to_sym(a, elf) for a in addrs]))
+            root = [thread, "[truncated]"] if truncated else [thread]
+            stacks[";".join(root + funcs)] += 1
+        elif fields[0] == "dropped":
+            print(f"{fields[1]} samples dropped", file=sys.stderr)
+
+    for stack, count in stacks.items():
+        print(stack, count)
+
+
 if __name__ == "__main__":
     elf = ELFFile(open(sys.argv[2], "rb"))
     with open(sys.argv[1], "r") as f:
         inp = f.read()
 
     lines = inp.splitlines()
+    if not lines or not lines[0].startswith("Perf buf length"):
+        collapse_sampler(lines, elf)
+        sys.exit(0)
+
     assert int(re.match(r"Perf buf length (\d+)", lines[0]).group(1)) == len(lines) - 1
     buf = binascii.unhexlify("".join(lines[1:]))
     collapse(buf, elf)
@@ -0,0 +1,465 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Compressed RAM backing store implementation
+ */
+#include <mmu.h>
+#include <string.h>
+#include <kernel_arch_interface.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/sys_heap.h>
+
+/*
+ * Like the RAM backing store, locations are freed as soon as their data
+ * page has been paged in, so K_MEM_PAGE_FRAME_BACKED is never set.
+ *
+ * Each location is a slot which holds the data page in one of three forms:
+ *
+ * - Same-filled: the page is a single word repeated, typically zeroes.
+ *   Only that word is kept and no pool space is used.
+ * - Compressed: the page went through the LZ77 codec below.
+ * - Raw: compression did not make the page smaller, it is copied as-is.
+ *
+ * Pool space for a whole page is reserved when the location is handed out,
+ * as k_mem_paging_backing_store_page_out() cannot fail. It is shrunk to the
+ * compressed size once the page is written out.
+ */
+
+BUILD_ASSERT(CONFIG_MMU_PAGE_SIZE <= (UINT16_MAX + 1),
+	     "match offsets are limited to 16 bits");
+
+struct ram_compressed_slot {
+	/* Pool chunk, NULL if the page is same-filled */
+	void *data;
+
+	/* Bytes of data, CONFIG_MMU_PAGE_SIZE if stored raw */
+	size_t size;
+
+	/* Word the page is filled with if there is no data */
+	uintptr_t fill;
+
+	bool used;
+};
+
+static struct ram_compressed_slot slots[CONFIG_BACKING_STORE_RAM_PAGES];
+static unsigned int free_slots;
+
+static char pool_mem[CONFIG_BACKING_STORE_RAM_COMPRESSED_POOL_SIZE] __aligned(sizeof(void *));
+static struct sys_heap pool;
+static struct k_spinlock lock;
+
+#ifdef CONFIG_DEMAND_PAGING_STATS
+static struct k_mem_paging_backing_store_compressed_stats_t stats;
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+
+/*
+ * LZ4-style block codec.
+ *
+ * A block is a series of sequences, each made of a token byte whose high
+ * nibble is the number of literals and low nibble the match length minus
+ * LZ_MIN_MATCH, the literals, then the 16-bit little-endian offset of the
+ * match. A nibble of 15 is followed by extra length bytes, added up until
+ * one is not 255. The last sequence only has literals.
+ */
+#define LZ_MIN_MATCH	4
+#define LZ_HASH_BITS	10
+
+static uint16_t lz_hash[1 << LZ_HASH_BITS];
+
+static inline uint32_t lz_read32(const uint8_t *p)
+{
+	uint32_t v;
+
+	(void)memcpy(&v, p, sizeof(v));
+
+	return v;
+}
+
+static inline uint32_t lz_hash32(uint32_t v)
+{
+	return (v * 2654435761U) >> (32 - LZ_HASH_BITS);
+}
+
+static uint8_t *lz_put_len(uint8_t *op, size_t len)
+{
+	while (len >= 255) {
+		*op++ = 255;
+		len -= 255;
+	}
+	*op++ = len;
+
+	return op;
+}
+
+static uint8_t *lz_put_seq(uint8_t *op, uint8_t *oend, const uint8_t *lit, size_t nlit,
+			   size_t offset, size_t mlen, bool last)
+{
+	size_t need = 1 + nlit + nlit / 255 + 1;
+	uint8_t *token;
+
+	if (!last) {
+		need += 2 + mlen / 255 + 1;
+	}
+	if (need > (size_t)(oend - op)) {
+		return NULL;
+	}
+
+	token = op++;
+	*token = MIN(nlit, 15) << 4;
+	if (nlit >= 15) {
+		op = lz_put_len(op, nlit - 15);
+	}
+	(void)memcpy(op, lit, nlit);
+	op += nlit;
+
+	if (!last) {
+		sys_put_le16(offset, op);
+		op += 2;
+		*token |= MIN(mlen, 15);
+		if (mlen >= 15) {
+			op = lz_put_len(op, mlen - 15);
+		}
+	}
+
+	return op;
+}
+
+/* Returns the compressed size, or 0 if it would not fit in cap bytes */
+static size_t lz_compress(const uint8_t *src, size_t len, uint8_t *dst, size_t cap)
+{
+	const uint8_t *iend = src + len;
+	const uint8_t *ip = src;
+	const uint8_t *anchor = src;
+	uint8_t *oend = dst + cap;
+	uint8_t *op = dst;
+
+	(void)memset(lz_hash, 0, sizeof(lz_hash));
+
+	while (ip + LZ_MIN_MATCH <= iend) {
+		uint32_t seq = lz_read32(ip);
+		uint32_t h = lz_hash32(seq);
+		const uint8_t *ref = src + lz_hash[h];
+		const uint8_t *mp;
+
+		lz_hash[h] = ip - src;
+		if (ref >= ip || lz_read32(ref) != seq) {
+			ip++;
+			continue;
+		}
+
+		mp = ip + LZ_MIN_MATCH;
+		ref += LZ_MIN_MATCH;
+		while (mp < iend && *mp == *ref) {
+			mp++;
+			ref++;
+		}
+
+		op = lz_put_seq(op, oend, anchor, ip - anchor, mp - ref,
+				mp - ip - LZ_MIN_MATCH, false);
+		if (op == NULL) {
+			return 0;
+		}
+		ip = mp;
+		anchor = ip;
+	}
+
+	op = lz_put_seq(op, oend, anchor, iend - anchor, 0, 0, true);
+	if (op == NULL) {
+		return 0;
+	}
+
+	return op - dst;
+}
+
+static int lz_get_len(const uint8_t **ip, const uint8_t *iend, size_t *len)
+{
+	uint8_t b;
+
+	do {
+		if (*ip == iend) {
+			return -EINVAL;
+		}
+		b = *(*ip)++;
+		*len += b;
+	} while (b == 255);
+
+	return 0;
+}
+
+/* Returns the decompressed size, or a negative errno for a corrupted block */
+static int lz_decompress(const uint8_t *src, size_t len, uint8_t *dst, size_t cap)
+{
+	const uint8_t *iend = src + len;
+	const uint8_t *ip = src;
+	uint8_t *oend = dst + cap;
+	uint8_t *op = dst;
+
+	while (ip < iend) {
+		uint8_t token = *ip++;
+		size_t offset;
+		size_t n;
+
+		n = token >> 4;
+		if (n == 15 && lz_get_len(&ip, iend, &n) != 0) {
+			return -EINVAL;
+		}
+		if (n > (size_t)(iend - ip) || n > (size_t)(oend - op)) {
+			return -EINVAL;
+		}
+		(void)memcpy(op, ip, n);
+		op += n;
+		ip += n;
+
+		if (ip == iend) {
+			break;
+		}
+
+		if (iend - ip < 2) {
+			return -EINVAL;
+		}
+		offset = sys_get_le16(ip);
+		ip += 2;
+
+		n = token & 0xf;
+		if (n == 15 && lz_get_len(&ip, iend, &n) != 0) {
+			return -EINVAL;
+		}
+		n += LZ_MIN_MATCH;
+		if (offset == 0 || offset > (size_t)(op - dst) || n > (size_t)(oend - op)) {
+			return -EINVAL;
+		}
+
+		/* Matches may overlap what they produce, copy bytewise */
+		for (const uint8_t *ref = op - offset; n > 0; n--) {
+			*op++ = *ref++;
+		}
+	}
+
+	return op - dst;
+}
+
+static bool page_same_filled(const void *page, uintptr_t *fill)
+{
+	const uintptr_t *word = page;
+
+	for (size_t i = 1; i < CONFIG_MMU_PAGE_SIZE / sizeof(uintptr_t); i++) {
+		if (word[i] != word[0]) {
+			return false;
+		}
+	}
+	*fill = word[0];
+
+	return true;
+}
+
+static struct ram_compressed_slot *location_to_slot(uintptr_t location)
+{
+	size_t idx = location / CONFIG_MMU_PAGE_SIZE;
+
+	__ASSERT(location % CONFIG_MMU_PAGE_SIZE == 0,
+		 "unaligned location 0x%lx", location);
+	__ASSERT(idx < ARRAY_SIZE(slots),
+		 "bad location 0x%lx, past bounds of backing store", location);
+	__ASSERT(slots[idx].used, "location 0x%lx not allocated", location);
+
+	return &slots[idx];
+}
+
+#ifdef CONFIG_DEMAND_PAGING_STATS
+static void stats_update(const struct ram_compressed_slot *slot, bool stored)
+{
+	unsigned long *cnt = NULL;
+
+	if (slot->data == NULL) {
+		cnt = &stats.same_filled;
+	} else if (slot->size == CONFIG_MMU_PAGE_SIZE) {
+		cnt = &stats.incompressible;
+	}
+
+	if (stored) {
+		stats.pages++;
+		stats.stored_bytes += slot->size;
+	} else {
+		stats.pages--;
+		stats.stored_bytes -= slot->size;
+	}
+
+	if (cnt != NULL) {
+		*cnt = stored ? *cnt + 1 : *cnt - 1;
+	}
+}
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+
+int k_mem_paging_backing_store_location_get(struct k_mem_page_frame *pf,
+					    uintptr_t *location,
+					    bool page_fault)
+{
+	k_spinlock_key_t key;
+	void *spare;
+	void *data;
+	size_t idx;
+
+	if ((!page_fault && free_slots == 1) || free_slots == 0) {
+		return -ENOMEM;
+	}
+
+	key = k_spin_lock(&lock);
+
+	data = sys_heap_alloc(&pool, CONFIG_MMU_PAGE_SIZE);
+	if (data != NULL && !page_fault) {
+		/* Keep room for a page to be evicted on a page fault */
+		spare = sys_heap_alloc(&pool, CONFIG_MMU_PAGE_SIZE);
+		if (spare == NULL) {
+			sys_heap_free(&pool, data);
+			data = NULL;
+		} else {
+			sys_heap_free(&pool, spare);
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	if (data == NULL) {
+		return -ENOMEM;
+	}
+
+	for (idx = 0; idx < ARRAY_SIZE(slots); idx++) {
+		if (!slots[idx].used) {
+			break;
+		}
+	}
+	__ASSERT(idx < ARRAY_SIZE(slots), "slot count mismatch");
+
+	slots[idx] = (struct ram_compressed_slot){
+		.data = data,
+		.size = 0,
+		.used = true,
+	};
+	*location = idx * CONFIG_MMU_PAGE_SIZE;
+	free_slots--;
+
+	return 0;
+}
+
+void k_mem_paging_backing_store_location_free(uintptr_t location)
+{
+	struct ram_compressed_slot *slot = location_to_slot(location);
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&lock);
+
+	if (slot->data != NULL) {
+		sys_heap_free(&pool, slot->data);
+	}
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	if (slot->size != 0 || slot->data == NULL) {
+		stats_update(slot, false);
+	}
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+
+	k_spin_unlock(&lock, key);
+
+	slot->data = NULL;
+	slot->used = false;
+	free_slots++;
+}
+
+void k_mem_paging_backing_store_page_out(uintptr_t location)
+{
+	struct ram_compressed_slot *slot = location_to_slot(location);
+	k_spinlock_key_t key;
+	size_t size;
+	void *data;
+
+	__ASSERT(slot->data != NULL && slot->size == 0,
+		 "location 0x%lx already written", location);
+
+	if (page_same_filled(K_MEM_SCRATCH_PAGE, &slot->fill)) {
+		data = NULL;
+		size = 0;
+	} else {
+		size = lz_compress(K_MEM_SCRATCH_PAGE, CONFIG_MMU_PAGE_SIZE,
+				   slot->data, CONFIG_MMU_PAGE_SIZE - 1);
+		if (size == 0) {
+			(void)memcpy(slot->data, K_MEM_SCRATCH_PAGE,
+				     CONFIG_MMU_PAGE_SIZE);
+			size = CONFIG_MMU_PAGE_SIZE;
+		}
+		data = slot->data;
+	}
+
+	key = k_spin_lock(&lock);
+
+	if (data == NULL) {
+		sys_heap_free(&pool, slot->data);
+	} else if (size < CONFIG_MMU_PAGE_SIZE) {
+		/* Shrinking is done in place and cannot fail */
+		data = sys_heap_realloc(&pool, slot->data, size);
+		__ASSERT_NO_MSG(data == slot->data);
+	}
+	slot->data = data;
+	slot->size = size;
+
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	stats_update(slot, true);
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+
+	k_spin_unlock(&lock, key);
+}
+
+void k_mem_paging_backing_store_page_in(uintptr_t location)
+{
+	struct ram_compressed_slot *slot = location_to_slot(location);
+	uintptr_t *word = K_MEM_SCRATCH_PAGE;
+	int ret;
+
+	if (slot->data == NULL) {
+		for (size_t i = 0; i < CONFIG_MMU_PAGE_SIZE / sizeof(uintptr_t); i++) {
+			word[i] = slot->fill;
+		}
+	} else if (slot->size == CONFIG_MMU_PAGE_SIZE) {
+		(void)memcpy(K_MEM_SCRATCH_PAGE, slot->data, CONFIG_MMU_PAGE_SIZE);
+	} else {
+		ret = lz_decompress(slot->data, slot->size, K_MEM_SCRATCH_PAGE,
+				    CONFIG_MMU_PAGE_SIZE);
+		__ASSERT(ret == CONFIG_MMU_PAGE_SIZE,
+			 "corrupted page at location 0x%lx: %d", location, ret);
+		ARG_UNUSED(ret);
+	}
+}
+
+void k_mem_paging_backing_store_page_finalize(struct k_mem_page_frame *pf,
+					      uintptr_t location)
+{
+#ifdef CONFIG_DEMAND_MAPPING
+	/* ignore those */
+	if (location == ARCH_UNPAGED_ANON_ZERO || location == ARCH_UNPAGED_ANON_UNINIT) {
+		return;
+	}
+#endif
+	k_mem_paging_backing_store_location_free(location);
+}
+
+void k_mem_paging_backing_store_compressed_stats_get(
+	struct k_mem_paging_backing_store_compressed_stats_t *stats_out)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	*stats_out = stats;
+
+	k_spin_unlock(&lock, key);
+#else
+	ARG_UNUSED(stats_out);
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+
+void k_mem_paging_backing_store_init(void)
+{
+	sys_heap_init(&pool, pool_mem, sizeof(pool_mem));
+	free_slots = CONFIG_BACKING_STORE_RAM_PAGES;
+}
@@ -56,11 +56,27 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #define NET_CONN_RANK(_flags)		(_flags & 0x78)
 
+/** Remote and local address and port specified */
+#define NET_CONN_TUPLE_SPEC		NET_CONN_RANK(0xff)
+
 static struct net_conn conns[CONFIG_NET_MAX_CONN];
 
 static sys_slist_t conn_unused;
 static sys_slist_t conn_used;
 
+#if defined(CONFIG_NET_CONN_HASH)
+/* Connections bound to a 5-tuple are hashed on it, and the other
+ * connections bound to a local port on the protocol and that port.
+ * Both are sorted from the most recently registered one, like conn_used.
+ */
+static sys_slist_t conn_hash[CONFIG_NET_CONN_HASH_BUCKETS];
+
+/* Connections not bound to a local port */
+static sys_slist_t conn_wildcard;
+
+static uint32_t conn_seq;
+#endif /* CONFIG_NET_CONN_HASH */
+
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
 void conn_register_debug(struct net_conn *conn,
@@ -113,6 +129,138 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#if defined(CONFIG_NET_CONN_HASH)
+#define FNV1A_OFFSET_BASIS 2166136261U
+#define FNV1A_PRIME 16777619U
+
+static uint32_t conn_hash_update(uint32_t hash, const void *data, size_t len)
+{
+	const uint8_t *bytes = data;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ bytes[i]) * FNV1A_PRIME;
+	}
+
+	return hash;
+}
+
+static size_t conn_hash_addr_len(uint8_t family)
+{
+	return family == AF_INET6 ? sizeof(struct in6_addr) : sizeof(struct in_addr);
+}
+
+/* Addresses are raw bytes and ports are in network byte order */
+static sys_slist_t *conn_hash_tuple_bucket(uint16_t proto, uint8_t family,
+					   const void *local_addr, uint16_t local_port,
+					   const void *remote_addr, uint16_t remote_port)
+{
+	uint32_t hash = FNV1A_OFFSET_BASIS;
+
+	hash = conn_hash_update(hash, &proto, sizeof(proto));
+	hash = conn_hash_update(hash, &family, sizeof(family));
+	hash = conn_hash_update(hash, &local_port, sizeof(local_port));
+	hash = conn_hash_update(hash, &remote_port, sizeof(remote_port));
+	hash = conn_hash_update(hash, local_addr, conn_hash_addr_len(family));
+	hash = conn_hash_update(hash, remote_addr, conn_hash_addr_len(family));
+
+	return &conn_hash[hash % CONFIG_NET_CONN_HASH_BUCKETS];
+}
+
+static sys_slist_t *conn_hash_port_bucket(uint16_t proto, uint16_t local_port)
+{
+	uint32_t hash = FNV1A_OFFSET_BASIS;
+
+	hash = conn_hash_update(hash, &proto, sizeof(proto));
+	hash = conn_hash_update(hash, &local_port, sizeof(local_port));
+
+	return &conn_hash[hash % CONFIG_NET_CONN_HASH_BUCKETS];
+}
+
+/* Can only packets of this very 5-tuple match the connection? */
+static bool conn_is_tuple_bound(struct net_conn *conn)
+{
+	return (conn->family == AF_INET || conn->family == AF_INET6) &&
+	       conn->local_addr.sa_family == conn->family &&
+	       conn->remote_addr.sa_family == conn->family &&
+	       (conn->flags & NET_CONN_TUPLE_SPEC) == NET_CONN_TUPLE_SPEC;
+}
+
+static bool conn_is_more_recent(struct net_conn *conn, struct net_conn *other)
+{
+	return (int32_t)(conn->seq - other->seq) > 0;
+}
+
+static sys_slist_t *conn_hash_list(struct net_conn *conn)
+{
+	const void *local_addr;
+	const void *remote_addr;
+
+	/* Only these can be matched by net_conn_input() */
+	if (conn->family != AF_INET && conn->family != AF_INET6 &&
+	    conn->family != AF_UNSPEC) {
+		return NULL;
+	}
+
+	if (conn_is_tuple_bound(conn)) {
+		if (conn->family == AF_INET6) {
+			local_addr = &net_sin6(&conn->local_addr)->sin6_addr;
+			remote_addr = &net_sin6(&conn->remote_addr)->sin6_addr;
+		} else {
+			local_addr = &net_sin(&conn->local_addr)->sin_addr;
+			remote_addr = &net_sin(&conn->remote_addr)->sin_addr;
+		}
+
+		return conn_hash_tuple_bucket(conn->proto, conn->family,
+					      local_addr,
+					      net_sin(&conn->local_addr)->sin_port,
+					      remote_addr,
+					      net_sin(&conn->remote_addr)->sin_port);
+	}
+
+	if (net_sin(&conn->local_addr)->sin_port != 0U) {
+		return conn_hash_port_bucket(conn->proto,
+					     net_sin(&conn->local_addr)->sin_port);
+	}
+
+	return &conn_wildcard;
+}
+
+/* Must be called with conn_lock held, like conn_hash_remove() */
+static void conn_hash_add(struct net_conn *conn)
+{
+	sys_slist_t *list = conn_hash_list(conn);
+	struct net_conn *prev = NULL;
+	struct net_conn *tmp;
+
+	if (list == NULL) {
+		return;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(list, tmp, hash_node) {
+		if (conn_is_more_recent(conn, tmp)) {
+			break;
+		}
+
+		prev = tmp;
+	}
+
+	sys_slist_insert(list, prev != NULL ? &prev->hash_node : NULL,
+			 &conn->hash_node);
+}
+
+static void conn_hash_remove(struct net_conn *conn)
+{
+	sys_slist_t *list = conn_hash_list(conn);
+
+	if (list != NULL) {
+		sys_slist_find_and_remove(list, &conn->hash_node);
+	}
+}
+#else
+#define conn_hash_add(...)
+#define conn_hash_remove(...)
+#endif /* CONFIG_NET_CONN_HASH */
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -138,6 +286,10 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+#if defined(CONFIG_NET_CONN_HASH)
+	conn->seq = conn_seq++;
+	conn_hash_add(conn);
+#endif
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -283,6 +435,8 @@ static int net_conn_change_remote(struct net_conn *conn,
 		conn - conns, conn);
 
 	if (remote_addr) {
+		conn->flags &= ~NET_CONN_REMOTE_ADDR_SPEC;
+
 		if (IS_ENABLED(CONFIG_NET_IPV6) &&
 		    remote_addr->sa_family == AF_INET6) {
 			memcpy(&conn->remote_addr, remote_addr,
@@ -330,6 +484,8 @@ static int net_conn_change_local(struct net_conn *conn,
 		conn - conns, conn);
 
 	if (local_addr != NULL) {
+		conn->flags &= ~NET_CONN_LOCAL_ADDR_SPEC;
+
 		if (IS_ENABLED(CONFIG_NET_IPV6) &&
 		    local_addr->sa_family == AF_INET6) {
 			memcpy(&conn->local_addr, local_addr,
@@ -463,6 +619,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+	conn_hash_remove(conn);
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -489,15 +646,23 @@ int net_conn_update(struct net_conn_handle *handle,
 		return -ENOENT;
 	}
 
+	/* The addresses and ports may move the connection in the index */
+	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn_hash_remove(conn);
+
 	net_conn_change_callback(conn, cb, user_data);
 
 	ret = net_conn_change_local(conn, local_addr, local_port);
 	if (ret < 0) {
-		return ret;
+		goto out;
 	}
 
 	ret = net_conn_change_remote(conn, remote_addr, remote_port);
 
+out:
+	conn_hash_add(conn);
+	k_mutex_unlock(&conn_lock);
+
 	return ret;
 }
 
@@ -871,6 +1036,167 @@ enum net_verdict net_conn_can_input(struct net_pkt *pkt, uint8_t proto)
 }
 #endif /* defined(CONFIG_NET_SOCKETS_CAN) */
 
+/* Is the candidate connection matching the TCP/UDP packet? */
+static bool conn_is_matching(struct net_conn *conn, struct net_pkt *pkt,
+			     union net_ip_header *ip_hdr, uint8_t proto,
+			     uint16_t src_port, uint16_t dst_port)
+{
+	uint8_t pkt_family = net_pkt_family(pkt);
+
+	/* Is the candidate connection matching the packet's interface? */
+	if (!is_iface_matching(conn, pkt)) {
+		return false; /* wrong interface */
+	}
+
+	/* Is the candidate connection matching the packet's protocol family? */
+	if (conn->family != AF_UNSPEC && conn->family != pkt_family) {
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
+			      !conn->v6only && conn->type != SOCK_RAW)) {
+				return false;
+			}
+		} else {
+			return false; /* wrong protocol family */
+		}
+
+		/* We might have a match for v4-to-v6 mapping, check more */
+	}
+
+	/* Is the candidate connection matching the packet's protocol within the family? */
+	if (conn->proto != proto) {
+		return false; /* wrong protocol */
+	}
+
+	/* Apply protocol-specific matching criteria... */
+	if (!(IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) ||
+	    !(conn->family == AF_INET || conn->family == AF_INET6 ||
+	      conn->family == AF_UNSPEC)) {
+		return false;
+	}
+
+	/* Is the candidate connection matching the packet's TCP/UDP
+	 * address and port?
+	 */
+	if (net_sin(&conn->remote_addr)->sin_port &&
+	    net_sin(&conn->remote_addr)->sin_port != src_port) {
+		return false; /* wrong remote port */
+	}
+
+	if (net_sin(&conn->local_addr)->sin_port &&
+	    net_sin(&conn->local_addr)->sin_port != dst_port) {
+		return false; /* wrong local port */
+	}
+
+	if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
+		return false; /* wrong remote address */
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+
+		/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
+		 * has no IPV6_V6ONLY option set and if the local IPV6 address
+		 * is unspecified, then we could accept a connection from IPv4
+		 * address by mapping it to IPv6 address.
+		 */
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
+			      !conn->v6only &&
+			      net_ipv6_is_addr_unspecified(
+				      &net_sin6(&conn->local_addr)->sin6_addr))) {
+				return false; /* wrong local address */
+			}
+		} else {
+			return false; /* wrong local address */
+		}
+
+		/* We might have a match for v4-to-v6 mapping,
+		 * continue with rank checking.
+		 */
+	}
+
+	return true;
+}
+
+#if defined(CONFIG_NET_CONN_HASH)
+/* Same precedence as walking conn_used for the best ranked connection, the
+ * most recently registered one winning ties. Must be called with conn_lock
+ * held.
+ */
+static struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr,
+					 uint8_t proto, uint16_t src_port,
+					 uint16_t dst_port)
+{
+	uint8_t pkt_family = net_pkt_family(pkt);
+	struct net_conn *best_match = NULL;
+	int16_t best_rank = -1;
+	struct net_conn *conn;
+	sys_slist_t *bucket;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && pkt_family == AF_INET6) {
+		bucket = conn_hash_tuple_bucket(proto, pkt_family,
+						ip_hdr->ipv6->dst, dst_port,
+						ip_hdr->ipv6->src, src_port);
+	} else {
+		bucket = conn_hash_tuple_bucket(proto, pkt_family,
+						ip_hdr->ipv4->dst, dst_port,
+						ip_hdr->ipv4->src, src_port);
+	}
+
+	/* Connections bound to the packet's 5-tuple have the highest rank */
+	SYS_SLIST_FOR_EACH_CONTAINER(bucket, conn, hash_node) {
+		if (conn_is_tuple_bound(conn) &&
+		    conn_is_matching(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+			return conn;
+		}
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(conn_hash_port_bucket(proto, dst_port), conn,
+				     hash_node) {
+		if (conn_is_tuple_bound(conn) ||
+		    !conn_is_matching(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+			continue;
+		}
+
+		if (best_rank < NET_CONN_RANK(conn->flags)) {
+			best_rank = NET_CONN_RANK(conn->flags);
+			best_match = conn;
+		}
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn_wildcard, conn, hash_node) {
+		if (!conn_is_matching(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+			continue;
+		}
+
+		if (best_rank < NET_CONN_RANK(conn->flags) ||
+		    (best_rank == NET_CONN_RANK(conn->flags) &&
+		     conn_is_more_recent(conn, best_match))) {
+			best_rank = NET_CONN_RANK(conn->flags);
+			best_match = conn;
+		}
+	}
+
+	return best_match;
+}
+#else
+static inline struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+						union net_ip_header *ip_hdr,
+						uint8_t proto, uint16_t src_port,
+						uint16_t dst_port)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto);
+	ARG_UNUSED(src_port);
+	ARG_UNUSED(dst_port);
+
+	return NULL;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 enum net_verdict net_conn_input(struct net_pkt *pkt,
 				union net_ip_header *ip_hdr,
 				uint8_t proto,
@@ -936,118 +1262,55 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
-		/* Is the candidate connection matching the packet's interface? */
-		if (!is_iface_matching(conn, pkt)) {
-			continue; /* wrong interface */
-		}
+	if (IS_ENABLED(CONFIG_NET_CONN_HASH) && !is_mcast_pkt) {
+		best_match = conn_hash_lookup(pkt, ip_hdr, proto, src_port, dst_port);
+	} else {
+		SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
+			struct net_pkt *mcast_pkt;
 
-		/* Is the candidate connection matching the packet's protocol family? */
-		if (conn->family != AF_UNSPEC && conn->family != pkt_family) {
-			if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-				if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-				      !conn->v6only && conn->type != SOCK_RAW)) {
-					continue;
-				}
-			} else {
-				continue; /* wrong protocol family */
+			if (!conn_is_matching(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+				continue;
 			}
 
-			/* We might have a match for v4-to-v6 mapping, check more */
-		}
+			if (best_rank >= NET_CONN_RANK(conn->flags)) {
+				continue;
+			}
 
-		/* Is the candidate connection matching the packet's protocol within the family? */
-		if (conn->proto != proto) {
-			continue; /* wrong protocol */
-		}
+			if (!is_mcast_pkt) {
+				best_rank = NET_CONN_RANK(conn->flags);
+				best_match = conn;
 
-		/* Apply protocol-specific matching criteria... */
-		uint8_t conn_family = conn->family;
+				continue; /* found a match - but maybe not yet the best */
+			}
 
-		if ((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
-		    (conn_family == AF_INET || conn_family == AF_INET6 ||
-		     conn_family == AF_UNSPEC)) {
-			/* Is the candidate connection matching the packet's TCP/UDP
-			 * address and port?
+			/* If we have a multicast packet, and we found
+			 * a match, then deliver the packet immediately
+			 * to the handler. As there might be several
+			 * sockets interested about these, we need to
+			 * clone the received pkt.
 			 */
-			if (net_sin(&conn->remote_addr)->sin_port &&
-			    net_sin(&conn->remote_addr)->sin_port != src_port) {
-				continue; /* wrong remote port */
-			}
 
-			if (net_sin(&conn->local_addr)->sin_port &&
-			    net_sin(&conn->local_addr)->sin_port != dst_port) {
-				continue; /* wrong local port */
-			}
+			NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
+				conn->user_data);
 
-			if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
-				continue; /* wrong remote address */
+			mcast_pkt = net_pkt_clone(
+				pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
+			if (!mcast_pkt) {
+				k_mutex_unlock(&conn_lock);
+				goto drop;
 			}
 
-			if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
-
-				/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
-				 * has no IPV6_V6ONLY option set and if the local IPV6 address
-				 * is unspecified, then we could accept a connection from IPv4
-				 * address by mapping it to IPv6 address.
-				 */
-				if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-					if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-					      !conn->v6only &&
-					      net_ipv6_is_addr_unspecified(
-						      &net_sin6(&conn->local_addr)->sin6_addr))) {
-						continue; /* wrong local address */
-					}
-				} else {
-					continue; /* wrong local address */
-				}
-
-				/* We might have a match for v4-to-v6 mapping,
-				 * continue with rank checking.
-				 */
+			if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
+			    NET_DROP) {
+				net_stats_update_per_proto_drop(pkt_iface, proto);
+				net_pkt_unref(mcast_pkt);
+			} else {
+				net_stats_update_per_proto_recv(pkt_iface, proto);
 			}
 
-			if (best_rank < NET_CONN_RANK(conn->flags)) {
-				struct net_pkt *mcast_pkt;
-
-				if (!is_mcast_pkt) {
-					best_rank = NET_CONN_RANK(conn->flags);
-					best_match = conn;
-
-					continue; /* found a match - but maybe not yet the best */
-				}
-
-				/* If we have a multicast packet, and we found
-				 * a match, then deliver the packet immediately
-				 * to the handler. As there might be several
-				 * sockets interested about these, we need to
-				 * clone the received pkt.
-				 */
-
-				NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
-					conn->user_data);
-
-				mcast_pkt = net_pkt_clone(
-					pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
-				if (!mcast_pkt) {
-					k_mutex_unlock(&conn_lock);
-					goto drop;
-				}
-
-				if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
-				    NET_DROP) {
-					net_stats_update_per_proto_drop(pkt_iface, proto);
-					net_pkt_unref(mcast_pkt);
-				} else {
-					net_stats_update_per_proto_recv(pkt_iface, proto);
-				}
-
-				mcast_pkt_delivered = true;
-			}
-		}
-	} /* loop end */
+			mcast_pkt_delivered = true;
+		} /* loop end */
+	}
 
 	if (best_match != NULL) {
 		cb = best_match->cb;
@@ -1118,6 +1381,14 @@ void net_conn_init(void)
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
 
+#if defined(CONFIG_NET_CONN_HASH)
+	for (i = 0; i < ARRAY_SIZE(conn_hash); i++) {
+		sys_slist_init(&conn_hash[i]);
+	}
+
+	sys_slist_init(&conn_wildcard);
+#endif
+
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
 	}
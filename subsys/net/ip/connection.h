@@ -54,6 +54,14 @@ struct net_conn {
 	/** Internal slist node */
 	sys_snode_t node;
 
+#if defined(CONFIG_NET_CONN_HASH)
+	/** Internal slist node in the lookup index */
+	sys_snode_t hash_node;
+
+	/** Registration sequence number, for the lookup precedence */
+	uint32_t seq;
+#endif
+
 	/** Remote socket address */
 	struct sockaddr remote_addr;
 
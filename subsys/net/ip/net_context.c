@@ -1809,6 +1809,20 @@ static int get_context_ipv4_mcast_loop(struct net_context *context,
 #endif
 }
 
+static int get_context_udp_segment(struct net_context *context,
+				   void *value, size_t *len)
+{
+#if defined(CONFIG_NET_CONTEXT_UDP_SEGMENT)
+	return get_uint16_option(context->options.udp_segment, value, len);
+#else
+	ARG_UNUSED(context);
+	ARG_UNUSED(value);
+	ARG_UNUSED(len);
+
+	return -ENOTSUP;
+#endif
+}
+
 static int get_context_mcast_hop_limit(struct net_context *context,
 				       void *value, size_t *len)
 {
@@ -2078,6 +2092,42 @@ static int get_context_ipv6_mcast_loop(struct net_context *context,
 #endif
 }
 
+/* Write buf_len bytes of the data, from the given offset in buf if it is
+ * not NULL, or in the iovecs of msghdr otherwise.
+ */
+static int context_write_data_at(struct net_pkt *pkt, const void *buf,
+				 size_t offset, size_t buf_len,
+				 const struct msghdr *msghdr)
+{
+	if (!msghdr) {
+		return net_pkt_write(pkt, (const uint8_t *)buf + offset, buf_len);
+	}
+
+	for (size_t i = 0; i < msghdr->msg_iovlen && buf_len > 0; i++) {
+		size_t iov_len = msghdr->msg_iov[i].iov_len;
+		size_t len;
+		int ret;
+
+		if (offset >= iov_len) {
+			offset -= iov_len;
+			continue;
+		}
+
+		len = MIN(iov_len - offset, buf_len);
+
+		ret = net_pkt_write(pkt, (const uint8_t *)msghdr->msg_iov[i].iov_base + offset,
+				    len);
+		if (ret < 0) {
+			return ret;
+		}
+
+		offset = 0;
+		buf_len -= len;
+	}
+
+	return 0;
+}
+
 /* If buf is not NULL, then use it. Otherwise read the data to be written
  * to net_pkt from msghdr.
  */
@@ -2114,6 +2164,7 @@ static int context_setup_udp_packet(struct net_context *context,
 				    sa_family_t family,
 				    struct net_pkt *pkt,
 				    const void *buf,
+				    size_t offset,
 				    size_t len,
 				    const struct msghdr *msg,
 				    const struct sockaddr *dst_addr,
@@ -2155,7 +2206,7 @@ static int context_setup_udp_packet(struct net_context *context,
 		return ret;
 	}
 
-	ret = context_write_data(pkt, buf, len, msg);
+	ret = context_write_data_at(pkt, buf, offset, len, msg);
 	if (ret) {
 		return ret;
 	}
@@ -2295,6 +2346,85 @@ static void set_pkt_txtime(struct net_pkt *pkt, const struct msghdr *msghdr)
 	}
 }
 
+#if defined(CONFIG_NET_CONTEXT_UDP_SEGMENT)
+/* Send the data in datagrams of the segment size of the context, the last
+ * one being shorter if needed. If a datagram cannot be sent, the number of
+ * bytes already sent is returned, so that the caller can resume from there.
+ */
+static int context_sendto_udp_segments(struct net_context *context,
+				       sa_family_t family,
+				       const void *buf, size_t len,
+				       const struct msghdr *msghdr,
+				       const struct sockaddr *dst_addr,
+				       socklen_t addrlen,
+				       k_timeout_t timeout)
+{
+	uint16_t segment = context->options.udp_segment;
+	size_t offset = 0;
+	int ret = 0;
+
+	while (offset < len) {
+		size_t seg_len = MIN(len - offset, segment);
+		struct net_pkt *pkt;
+
+		pkt = context_alloc_pkt(context, family, seg_len, PKT_WAIT_TIME);
+		if (!pkt) {
+			NET_ERR("Failed to allocate net_pkt");
+			ret = -ENOBUFS;
+			break;
+		}
+
+		if (net_pkt_available_payload_buffer(pkt, IPPROTO_UDP) < seg_len) {
+			NET_ERR("Available payload buffer is not enough for segment (%zu)",
+				seg_len);
+			net_pkt_unref(pkt);
+			ret = -ENOMEM;
+			break;
+		}
+
+		if (IS_ENABLED(CONFIG_NET_CONTEXT_PRIORITY)) {
+			uint8_t priority;
+
+			get_context_priority(context, &priority, NULL);
+			net_pkt_set_priority(pkt, priority);
+		}
+
+		/* Every segment is sent at the requested time, as one datagram
+		 * would be.
+		 */
+		if (msghdr && msghdr->msg_control && msghdr->msg_controllen) {
+			if (IS_ENABLED(CONFIG_NET_CONTEXT_TXTIME)) {
+				int is_txtime;
+
+				get_context_txtime(context, &is_txtime, NULL);
+				if (is_txtime) {
+					set_pkt_txtime(pkt, msghdr);
+				}
+			}
+		}
+
+		ret = context_setup_udp_packet(context, family, pkt, buf, offset,
+					       seg_len, msghdr, dst_addr, addrlen);
+		if (ret < 0) {
+			net_pkt_unref(pkt);
+			break;
+		}
+
+		context_finalize_packet(context, family, pkt);
+
+		ret = net_try_send_data(pkt, timeout);
+		if (ret < 0) {
+			net_pkt_unref(pkt);
+			break;
+		}
+
+		offset += seg_len;
+	}
+
+	return offset > 0 ? offset : ret;
+}
+#endif /* CONFIG_NET_CONTEXT_UDP_SEGMENT */
+
 static int context_sendto(struct net_context *context,
 			  const void *buf,
 			  size_t len,
@@ -2569,6 +2699,16 @@ static int context_sendto(struct net_context *context,
 	context->send_cb = cb;
 	context->user_data = user_data;
 
+#if defined(CONFIG_NET_CONTEXT_UDP_SEGMENT)
+	if (net_context_get_proto(context) == IPPROTO_UDP &&
+	    net_context_get_type(context) == SOCK_DGRAM &&
+	    context->options.udp_segment > 0 && len > context->options.udp_segment &&
+	    !net_if_is_ip_offloaded(net_context_get_iface(context))) {
+		return context_sendto_udp_segments(context, family, buf, len, msghdr,
+						   dst_addr, addrlen, timeout);
+	}
+#endif
+
 	if (IS_ENABLED(CONFIG_NET_TCP) &&
 	    net_context_get_proto(context) == IPPROTO_TCP &&
 	    !net_if_is_ip_offloaded(net_context_get_iface(context))) {
@@ -2645,7 +2785,7 @@ skip_alloc:
 		ret = net_try_send_data(pkt, timeout);
 	} else if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_proto(context) == IPPROTO_UDP) {
-		ret = context_setup_udp_packet(context, family, pkt, buf, len, msghdr,
+		ret = context_setup_udp_packet(context, family, pkt, buf, 0, len, msghdr,
 					       dst_addr, addrlen);
 		if (ret < 0) {
 			goto fail;
@@ -3469,6 +3609,24 @@ static int set_context_ipv4_mcast_loop(struct net_context *context,
 #endif
 }
 
+static int set_context_udp_segment(struct net_context *context,
+				   const void *value, size_t len)
+{
+#if defined(CONFIG_NET_CONTEXT_UDP_SEGMENT)
+	if (net_context_get_proto(context) != IPPROTO_UDP) {
+		return -EINVAL;
+	}
+
+	return set_uint16_option(&context->options.udp_segment, value, len);
+#else
+	ARG_UNUSED(context);
+	ARG_UNUSED(value);
+	ARG_UNUSED(len);
+
+	return -ENOTSUP;
+#endif
+}
+
 static int set_context_mcast_hop_limit(struct net_context *context,
 				       const void *value, size_t len)
 {
@@ -3867,6 +4025,9 @@ int net_context_set_option(struct net_context *context,
 	case NET_OPT_IPV4_MCAST_LOOP:
 		ret = set_context_ipv4_mcast_loop(context, value, len);
 		break;
+	case NET_OPT_UDP_SEGMENT:
+		ret = set_context_udp_segment(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
@@ -3958,6 +4119,9 @@ int net_context_get_option(struct net_context *context,
 	case NET_OPT_IPV4_MCAST_LOOP:
 		ret = get_context_ipv4_mcast_loop(context, value, len);
 		break;
+	case NET_OPT_UDP_SEGMENT:
+		ret = get_context_udp_segment(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
@@ -514,29 +514,142 @@ static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 	tcp_new_reno_log(conn, "pkts_acked");
 }
 
+static const struct tcp_ca_ops tcp_new_reno_ops = {
+	.name = "reno",
+	.init = tcp_new_reno_init,
+	.fast_retransmit = tcp_new_reno_fast_retransmit,
+	.timeout = tcp_new_reno_timeout,
+	.dup_ack = tcp_new_reno_dup_ack,
+	.pkts_acked = tcp_new_reno_pkts_acked,
+};
+
+static const struct tcp_ca_ops *const tcp_ca_algorithms[] = {
+	&tcp_new_reno_ops,
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+	&tcp_cubic_ops,
+#endif
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+	&tcp_bbr_ops,
+#endif
+};
+
+static const struct tcp_ca_ops *tcp_ca_default(void)
+{
+#if defined(CONFIG_NET_TCP_CONGESTION_DEFAULT_CUBIC)
+	return &tcp_cubic_ops;
+#elif defined(CONFIG_NET_TCP_CONGESTION_DEFAULT_BBR)
+	return &tcp_bbr_ops;
+#else
+	return &tcp_new_reno_ops;
+#endif
+}
+
 static void tcp_ca_init(struct tcp *conn)
 {
-	tcp_new_reno_init(conn);
+	conn->ca.round_active = false;
+	conn->ca.ops->init(conn);
+}
+
+/* Like in Karn's algorithm, do not time the rounds with retransmissions */
+static void tcp_ca_data_resent(struct tcp *conn)
+{
+	conn->ca.round_rexmit = true;
 }
 
 static void tcp_ca_fast_retransmit(struct tcp *conn)
 {
-	tcp_new_reno_fast_retransmit(conn);
+	tcp_ca_data_resent(conn);
+	conn->ca.ops->fast_retransmit(conn);
 }
 
 static void tcp_ca_timeout(struct tcp *conn)
 {
-	tcp_new_reno_timeout(conn);
+	tcp_ca_data_resent(conn);
+	conn->ca.ops->timeout(conn);
 }
 
 static void tcp_ca_dup_ack(struct tcp *conn)
 {
-	tcp_new_reno_dup_ack(conn);
+	conn->ca.ops->dup_ack(conn);
+}
+
+/* Time a round trip from the first segment sent after the previous one ended */
+static void tcp_ca_data_sent(struct tcp *conn)
+{
+	if (conn->ca.round_active || conn->data_mode == TCP_DATA_MODE_RESEND) {
+		return;
+	}
+
+	conn->ca.round_active = true;
+	conn->ca.round_rexmit = false;
+	conn->ca.round_seq = conn->seq + conn->unacked_len;
+	conn->ca.round_start = k_uptime_get_32();
+	conn->ca.round_delivered = 0;
 }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
-	tcp_new_reno_pkts_acked(conn, acked_len);
+	struct tcp_congestion *ca = &conn->ca;
+
+	if (ca->round_active) {
+		ca->round_delivered += acked_len;
+
+		if (net_tcp_seq_cmp(conn->seq + acked_len, ca->round_seq) >= 0) {
+			ca->round_active = false;
+
+			if (!ca->round_rexmit && ca->ops->round != NULL) {
+				ca->ops->round(conn, k_uptime_get_32() - ca->round_start,
+					       ca->round_delivered);
+			}
+		}
+	}
+
+	ca->ops->pkts_acked(conn, acked_len);
+}
+
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
+{
+	char name[TCP_CA_NAME_MAX];
+
+	if (value == NULL || len == 0) {
+		return -EINVAL;
+	}
+
+	/* The name does not need to be NUL terminated */
+	len = MIN(len, sizeof(name) - 1);
+	memcpy(name, value, len);
+	name[len] = '\0';
+
+	ARRAY_FOR_EACH(tcp_ca_algorithms, i) {
+		if (strcmp(tcp_ca_algorithms[i]->name, name) != 0) {
+			continue;
+		}
+
+		conn->ca.ops = tcp_ca_algorithms[i];
+
+		/* Start over with the new algorithm if data can be sent */
+		if (conn->state == TCP_ESTABLISHED || conn->state == TCP_CLOSE_WAIT) {
+			tcp_ca_init(conn);
+		}
+
+		return 0;
+	}
+
+	return -ENOENT;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, size_t *len)
+{
+	size_t name_len = strlen(conn->ca.ops->name) + 1;
+
+	if (value == NULL || len == NULL) {
+		return -EINVAL;
+	}
+
+	*len = MIN(*len, name_len);
+	memcpy(value, conn->ca.ops->name, *len);
+
+	return 0;
 }
 #else
 
@@ -548,8 +661,15 @@ static void tcp_ca_timeout(struct tcp *conn) { }
 
 static void tcp_ca_dup_ack(struct tcp *conn) { }
 
+static void tcp_ca_data_sent(struct tcp *conn) { }
+
+static inline void tcp_ca_data_resent(struct tcp *conn) { }
+
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len) { }
 
+#define set_tcp_congestion(...) (-ENOPROTOOPT)
+#define get_tcp_congestion(...) (-ENOPROTOOPT)
+
 #endif
 
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
@@ -999,7 +1119,7 @@ static uint8_t *tcp_options_get(struct net_pkt *pkt, int tcp_options_len,
 }
 
 static bool tcp_options_check(struct tcp_options *recv_options,
-			      struct net_pkt *pkt, ssize_t len)
+			      struct net_pkt *pkt, ssize_t len, bool syn)
 {
 	uint8_t options_buf[40]; /* TCP header max options size is 40 */
 	bool result = len > 0 && ((len % 4) == 0) ? true : false;
@@ -1009,8 +1129,17 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	NET_DBG("len=%zd", len);
 
-	recv_options->mss_found = false;
-	recv_options->wnd_found = false;
+	/* MSS and window scale are only sent in SYN segments, keep them when
+	 * other segments carry options.
+	 */
+	if (syn) {
+		recv_options->mss_found = false;
+		recv_options->wnd_found = false;
+	}
+
+#ifdef CONFIG_NET_TCP_SACK
+	recv_options->sack_perm_found = false;
+#endif
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -1059,6 +1188,35 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+#ifdef CONFIG_NET_TCP_SACK
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+		case NET_TCP_SACK_OPT:
+			if (opt_len < 2 + NET_TCP_SACK_BLOCK_SIZE ||
+			    ((opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE) != 0) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_cnt = MIN((opt_len - 2) / NET_TCP_SACK_BLOCK_SIZE,
+						     NET_TCP_SACK_MAX_BLOCKS);
+
+			for (int i = 0; i < recv_options->sack_cnt; i++) {
+				uint8_t *block = options + 2 + i * NET_TCP_SACK_BLOCK_SIZE;
+
+				recv_options->sack[i].start =
+					ntohl(UNALIGNED_GET((uint32_t *)block));
+				recv_options->sack[i].end =
+					ntohl(UNALIGNED_GET((uint32_t *)(block + 4)));
+			}
+			break;
+#endif
 		default:
 			continue;
 		}
@@ -1249,6 +1407,86 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 	return -EINVAL;
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+/* SACK-permitted is offered in SYN, and confirmed in SYN-ACK if the peer
+ * offered it.
+ */
+static bool tcp_sack_perm_to_send(struct tcp *conn, uint8_t flags)
+{
+	return (flags & SYN) && (!(flags & ACK) || conn->sack_enabled);
+}
+
+/* Get the out-of-order data to report in an ACK, the receive queue holds
+ * at most one sequence of it.
+ */
+static bool tcp_sack_block_get(struct tcp *conn, uint8_t flags,
+			       struct tcp_sack_block *block)
+{
+	if (!conn->sack_enabled || (flags & (SYN | ACK)) != ACK ||
+	    !CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT ||
+	    net_pkt_is_empty(conn->queue_recv_data)) {
+		return false;
+	}
+
+	block->start = tcp_get_seq(conn->queue_recv_data->buffer);
+	block->end = block->start + net_pkt_get_len(conn->queue_recv_data);
+
+	return net_tcp_seq_greater(block->start, conn->ack);
+}
+
+static size_t tcp_sack_options_len(struct tcp *conn, uint8_t flags)
+{
+	struct tcp_sack_block block;
+
+	if (tcp_sack_perm_to_send(conn, flags)) {
+		return 2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_PERM_SIZE;
+	}
+
+	if (tcp_sack_block_get(conn, flags, &block)) {
+		return 2 * NET_TCP_NOP_SIZE + 2 + NET_TCP_SACK_BLOCK_SIZE;
+	}
+
+	return 0;
+}
+
+static int tcp_sack_options_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags)
+{
+	uint8_t opts[2 * NET_TCP_NOP_SIZE + 2 + NET_TCP_SACK_BLOCK_SIZE] = {
+		NET_TCP_NOP_OPT, NET_TCP_NOP_OPT,
+	};
+	struct tcp_sack_block block;
+
+	if (tcp_sack_perm_to_send(conn, flags)) {
+		opts[2] = NET_TCP_SACK_PERM_OPT;
+		opts[3] = NET_TCP_SACK_PERM_SIZE;
+
+		return net_pkt_write(pkt, opts, 4);
+	}
+
+	if (tcp_sack_block_get(conn, flags, &block)) {
+		opts[2] = NET_TCP_SACK_OPT;
+		opts[3] = 2 + NET_TCP_SACK_BLOCK_SIZE;
+		sys_put_be32(block.start, &opts[4]);
+		sys_put_be32(block.end, &opts[8]);
+
+		return net_pkt_write(pkt, opts, sizeof(opts));
+	}
+
+	return 0;
+}
+#else
+static inline size_t tcp_sack_options_len(struct tcp *conn, uint8_t flags)
+{
+	return 0;
+}
+
+static inline int tcp_sack_options_add(struct tcp *conn, struct net_pkt *pkt,
+				       uint8_t flags)
+{
+	return 0;
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 			  uint32_t seq)
 {
@@ -1270,6 +1508,8 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 		th->th_off++;
 	}
 
+	th->th_off += tcp_sack_options_len(conn, flags) / 4;
+
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(htons(conn->recv_win), UNALIGNED_MEMBER_ADDR(th, th_win));
 	UNALIGNED_PUT(htonl(seq), UNALIGNED_MEMBER_ADDR(th, th_seq));
@@ -1465,6 +1705,8 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		alloc_len += sizeof(uint32_t);
 	}
 
+	alloc_len += tcp_sack_options_len(conn, flags);
+
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1497,6 +1739,12 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	ret = tcp_sack_options_add(conn, pkt, flags);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		goto out;
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1714,13 +1962,50 @@ static void tcp_setup_retransmission(struct tcp *conn)
 	k_work_reschedule_for_queue(&tcp_work_q, &conn->send_data_timer, K_MSEC(TCP_RTO_MS));
 }
 
+/* Largest payload of a data segment. The MSS does not account for TCP
+ * options (RFC 6691), so leave room for the SACK block that is added to
+ * every ACK while out-of-order data is queued.
+ */
+static int tcp_data_seg_max(struct tcp *conn)
+{
+	return conn_mss(conn) - tcp_sack_options_len(conn, PSH | ACK);
+}
+
+/* Send len bytes of the send_data from the given offset in a segment */
+static int tcp_send_segment(struct tcp *conn, size_t offset, int len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = tcp_pkt_alloc(conn, len);
+	if (!pkt) {
+		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
+		return -ENOBUFS;
+	}
+
+	ret = tcp_pkt_peek(pkt, conn->send_data, offset, len);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		return -ENOBUFS;
+	}
+
+	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + offset);
+
+	/* The data we want to send, has been moved to the send queue so we
+	 * can unref the head net_pkt. If there was an error, we need to remove
+	 * the packet anyway.
+	 */
+	tcp_pkt_unref(pkt);
+
+	return ret;
+}
+
 static int tcp_send_data(struct tcp *conn)
 {
 	int ret = 0;
 	int len;
-	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+	len = MIN(tcp_unsent_len(conn), tcp_data_seg_max(conn));
 	if (len < 0) {
 		ret = len;
 		goto out;
@@ -1731,24 +2016,12 @@ static int tcp_send_data(struct tcp *conn)
 		goto out;
 	}
 
-	pkt = tcp_pkt_alloc(conn, len);
-	if (!pkt) {
-		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
-		ret = -ENOBUFS;
-		goto out;
-	}
-
-	ret = tcp_pkt_peek(pkt, conn->send_data, conn->unacked_len, len);
-	if (ret < 0) {
-		tcp_pkt_unref(pkt);
-		ret = -ENOBUFS;
-		goto out;
-	}
-
-	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
+	ret = tcp_send_segment(conn, conn->unacked_len, len);
 	if (ret == 0) {
 		conn->unacked_len += len;
 
+		tcp_ca_data_sent(conn);
+
 		if (conn->data_mode == TCP_DATA_MODE_RESEND) {
 			net_stats_update_tcp_resent(conn->iface, len);
 			net_stats_update_tcp_seg_rexmit(conn->iface);
@@ -1758,12 +2031,6 @@ static int tcp_send_data(struct tcp *conn)
 		}
 	}
 
-	/* The data we want to send, has been moved to the send queue so we
-	 * can unref the head net_pkt. If there was an error, we need to remove
-	 * the packet anyway.
-	 */
-	tcp_pkt_unref(pkt);
-
 	conn_send_data_dump(conn);
 
  out:
@@ -1816,6 +2083,206 @@ static int tcp_send_queued_data(struct tcp *conn)
 	return ret;
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+
+/* Implementation according to RFC 6675, with the scoreboard reduced to the
+ * SACKed ranges as the send path only tracks SND.UNA and SND.NXT.
+ */
+
+static void tcp_sack_reset(struct tcp *conn)
+{
+	conn->sack.cnt = 0;
+	conn->sack.in_recovery = false;
+}
+
+static void tcp_sack_insert(struct tcp_sack_scoreboard *sb, uint32_t start, uint32_t end)
+{
+	uint8_t i = 0;
+	uint8_t j;
+
+	/* Skip the ranges below the new one */
+	while (i < sb->cnt && net_tcp_seq_cmp(sb->blocks[i].end, start) < 0) {
+		i++;
+	}
+
+	/* Merge the ranges overlapping or adjacent to it */
+	for (j = i; j < sb->cnt && net_tcp_seq_cmp(sb->blocks[j].start, end) <= 0; j++) {
+		if (net_tcp_seq_cmp(sb->blocks[j].start, start) < 0) {
+			start = sb->blocks[j].start;
+		}
+
+		if (net_tcp_seq_cmp(sb->blocks[j].end, end) > 0) {
+			end = sb->blocks[j].end;
+		}
+	}
+
+	if (j == i) {
+		if (sb->cnt == ARRAY_SIZE(sb->blocks)) {
+			/* Forget the highest range, which only costs a
+			 * useless retransmission.
+			 */
+			if (i == sb->cnt) {
+				return;
+			}
+
+			sb->cnt--;
+		}
+
+		memmove(&sb->blocks[i + 1], &sb->blocks[i],
+			(sb->cnt - i) * sizeof(sb->blocks[0]));
+		sb->cnt++;
+	} else if (j > i + 1) {
+		memmove(&sb->blocks[i + 1], &sb->blocks[j],
+			(sb->cnt - j) * sizeof(sb->blocks[0]));
+		sb->cnt -= j - i - 1;
+	}
+
+	sb->blocks[i].start = start;
+	sb->blocks[i].end = end;
+}
+
+/* Update the scoreboard with the cumulative ACK and the SACK blocks of a
+ * received segment.
+ */
+static void tcp_sack_update(struct tcp *conn, uint32_t ack)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t snd_nxt = conn->seq + conn->unacked_len;
+	uint8_t cnt = 0;
+
+	if (!conn->sack_enabled) {
+		return;
+	}
+
+	for (uint8_t i = 0; i < sb->cnt; i++) {
+		if (net_tcp_seq_cmp(sb->blocks[i].end, ack) <= 0) {
+			continue;
+		}
+
+		sb->blocks[cnt].start = net_tcp_seq_greater(ack, sb->blocks[i].start) ?
+					ack : sb->blocks[i].start;
+		sb->blocks[cnt].end = sb->blocks[i].end;
+		cnt++;
+	}
+
+	sb->cnt = cnt;
+
+	for (uint8_t i = 0; i < conn->recv_options.sack_cnt; i++) {
+		struct tcp_sack_block *block = &conn->recv_options.sack[i];
+
+		/* Only keep the blocks about data sent and not yet cumulatively
+		 * acknowledged, which also skips D-SACK ones (RFC 2883).
+		 */
+		if (!net_tcp_seq_greater(block->start, ack) ||
+		    !net_tcp_seq_greater(block->end, block->start) ||
+		    net_tcp_seq_greater(block->end, snd_nxt)) {
+			continue;
+		}
+
+		tcp_sack_insert(sb, block->start, block->end);
+	}
+}
+
+/* Retransmit the first hole below the highest SACKed data which has not been
+ * retransmitted yet, see NextSeg() in RFC 6675.
+ */
+static void tcp_sack_retransmit(struct tcp *conn)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t pos = sb->high_rxt;
+	int len;
+
+	if (net_tcp_seq_greater(conn->seq, pos)) {
+		pos = conn->seq;
+	}
+
+	for (uint8_t i = 0; i < sb->cnt; i++) {
+		if (net_tcp_seq_greater(sb->blocks[i].start, pos)) {
+			len = MIN(sb->blocks[i].start - pos, tcp_data_seg_max(conn));
+
+			if (tcp_send_segment(conn, pos - conn->seq, len) == 0) {
+				sb->high_rxt = pos + len;
+				tcp_ca_data_resent(conn);
+				net_stats_update_tcp_resent(conn->iface, len);
+				net_stats_update_tcp_seg_rexmit(conn->iface);
+			}
+
+			return;
+		}
+
+		if (net_tcp_seq_greater(sb->blocks[i].end, pos)) {
+			pos = sb->blocks[i].end;
+		}
+	}
+}
+
+/* Start the loss recovery on duplicate ACKs, return false if there is no
+ * SACK information to use.
+ */
+static bool tcp_sack_recovery_start(struct tcp *conn)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+
+	if (!conn->sack_enabled || sb->cnt == 0) {
+		return false;
+	}
+
+	if (!sb->in_recovery) {
+		sb->in_recovery = true;
+		sb->recovery_point = conn->seq + conn->unacked_len;
+		sb->high_rxt = conn->seq;
+
+		NET_DBG("conn: %p SACK recovery until %u", conn, sb->recovery_point);
+	}
+
+	tcp_sack_retransmit(conn);
+
+	return true;
+}
+
+static bool tcp_sack_in_recovery(struct tcp *conn)
+{
+	return conn->sack.in_recovery;
+}
+
+/* SND.UNA moved forward: leave the loss recovery, or retransmit the next hole
+ * right away on a partial ACK.
+ */
+static void tcp_sack_acked(struct tcp *conn)
+{
+	if (!conn->sack.in_recovery) {
+		return;
+	}
+
+	if (net_tcp_seq_cmp(conn->seq, conn->sack.recovery_point) >= 0) {
+		conn->sack.in_recovery = false;
+		return;
+	}
+
+	tcp_sack_retransmit(conn);
+}
+#else
+
+static inline void tcp_sack_reset(struct tcp *conn) { }
+
+static inline void tcp_sack_update(struct tcp *conn, uint32_t ack) { }
+
+static inline void tcp_sack_retransmit(struct tcp *conn) { }
+
+static inline bool tcp_sack_recovery_start(struct tcp *conn)
+{
+	return false;
+}
+
+static inline bool tcp_sack_in_recovery(struct tcp *conn)
+{
+	return false;
+}
+
+static inline void tcp_sack_acked(struct tcp *conn) { }
+
+#endif /* CONFIG_NET_TCP_SACK */
+
 static void tcp_cleanup_recv_queue(struct k_work *work)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
@@ -1868,6 +2335,11 @@ static void tcp_resend_data(struct k_work *work)
 			}
 		}
 
+		/* The peer may have discarded the data it SACKed, so start over
+		 * (RFC 6675, section 5.1).
+		 */
+		tcp_sack_reset(conn);
+
 		conn->data_mode = TCP_DATA_MODE_RESEND;
 		conn->unacked_len = 0;
 
@@ -2113,6 +2585,7 @@ static struct tcp *tcp_conn_alloc(void)
 	 * is available as soon as the connection is established
 	 */
 	conn->ca.cwnd = UINT16_MAX;
+	conn->ca.ops = tcp_ca_default();
 #endif
 
 	/* The ISN value will be set when we get the connection attempt or
@@ -2895,8 +3368,14 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto out;
 	}
 
+#ifdef CONFIG_NET_TCP_SACK
+	/* SACK blocks only describe the segment carrying them */
+	conn->recv_options.sack_cnt = 0;
+#endif
+
 	if (tcp_options_len && !tcp_options_check(&conn->recv_options, pkt,
-						  tcp_options_len)) {
+						  tcp_options_len,
+						  (th_flags(th) & SYN) != 0)) {
 		NET_DBG("DROP: Invalid TCP option list");
 		net_tcp_reply_rst(pkt);
 		do_close = true;
@@ -2979,6 +3458,9 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 	switch (conn->state) {
 	case TCP_LISTEN:
 		if (FL(&fl, ==, SYN)) {
+#ifdef CONFIG_NET_TCP_SACK
+			conn->sack_enabled = conn->recv_options.sack_perm_found;
+#endif
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
@@ -3009,6 +3491,9 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				accept_cb = conn->accepted_conn->accept_cb;
 				context = conn->accepted_conn->context;
 				keep_alive_param_copy(conn, conn->accepted_conn);
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+				conn->ca.ops = conn->accepted_conn->ca.ops;
+#endif
 			}
 
 			k_work_cancel_delayable(&conn->establish_timer);
@@ -3096,6 +3581,9 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		 */
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			k_work_cancel_delayable(&conn->send_data_timer);
+#ifdef CONFIG_NET_TCP_SACK
+			conn->sack_enabled = conn->recv_options.sack_perm_found;
+#endif
 			conn_ack(conn, th_seq(th) + 1);
 			if (len) {
 				verdict = tcp_data_get(conn, pkt, &len);
@@ -3169,6 +3657,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		 */
 		keep_alive_timer_restart(conn);
 
+		tcp_sack_update(conn, th_ack(th));
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -3189,20 +3679,27 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			/* Only do fast retransmit when not already in a resend state */
 			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
 			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
-				/* Apply a fast retransmit */
-				int temp_unacked_len = conn->unacked_len;
+				/* Retransmit what the peer misses if it told us,
+				 * otherwise apply a fast retransmit.
+				 */
+				if (!tcp_sack_recovery_start(conn)) {
+					int temp_unacked_len = conn->unacked_len;
 
-				conn->unacked_len = 0;
+					conn->unacked_len = 0;
 
-				(void)tcp_send_data(conn);
+					(void)tcp_send_data(conn);
 
-				/* Restore the current transmission */
-				conn->unacked_len = temp_unacked_len;
+					/* Restore the current transmission */
+					conn->unacked_len = temp_unacked_len;
+				}
 
 				tcp_ca_fast_retransmit(conn);
 				if (tcp_window_full(conn)) {
 					(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 				}
+			} else if (len == 0 && tcp_sack_in_recovery(conn)) {
+				/* Each further duplicate ACK lets a hole through */
+				tcp_sack_retransmit(conn);
 			}
 		}
 #endif
@@ -3249,6 +3746,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			conn_seq(conn, + len_acked);
 			net_stats_update_tcp_seg_recv(conn->iface);
 
+			tcp_sack_acked(conn);
+
 			/* Receipt of an acknowledgment that covers a sequence number
 			 * not previously acknowledged indicates that the connection
 			 * makes a "forward progress".
@@ -4546,6 +5045,9 @@ int net_tcp_set_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = set_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = set_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -4583,6 +5085,9 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = get_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = get_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <string.h>
+#include <zephyr/kernel.h>
+
+#include "tcp_internal.h"
+
+/* Lightweight BBR: the state machine of BBR v1 driving the congestion window
+ * only, as there is no pacing of the transmissions. The model is updated
+ * once per round trip, from the rounds timed by the TCP core.
+ */
+
+enum tcp_bbr_state {
+	BBR_STARTUP,
+	BBR_DRAIN,
+	BBR_PROBE_BW,
+	BBR_PROBE_RTT,
+};
+
+/* Gains are in percent. 2/ln(2) doubles the delivery rate every round */
+#define BBR_HIGH_GAIN 289
+#define BBR_UNIT_GAIN 100
+#define BBR_CWND_GAIN 200
+
+/* The bandwidth is full when it grew by less than 25% in three rounds */
+#define BBR_FULL_BW_GROWTH 125
+#define BBR_FULL_BW_ROUNDS 3
+
+#define BBR_MIN_RTT_WINDOW_MS 10000
+#define BBR_PROBE_RTT_MS 200
+#define BBR_MIN_CWND_SEGMENTS 4
+
+/* Probe for more bandwidth, drain the queue it created, then cruise */
+static const uint8_t bbr_cycle_gain[] = {125, 75, 100, 100, 100, 100, 100, 100};
+
+static void tcp_bbr_log(struct tcp *conn, char *step)
+{
+	NET_DBG("conn: %p, ca %s, cwnd=%d, state=%d, min_rtt=%u",
+		conn, step, conn->ca.cwnd, conn->ca.bbr.state,
+		conn->ca.bbr.min_rtt);
+}
+
+static uint32_t tcp_bbr_max_bw(struct tcp_bbr *bbr)
+{
+	uint32_t bw = 0;
+
+	ARRAY_FOR_EACH(bbr->bw, i) {
+		bw = MAX(bw, bbr->bw[i]);
+	}
+
+	return bw;
+}
+
+/* Bandwidth-delay product scaled by a gain, 0 when there is no model yet */
+static uint32_t tcp_bbr_bdp(struct tcp *conn, uint32_t gain)
+{
+	struct tcp_bbr *bbr = &conn->ca.bbr;
+
+	if (bbr->min_rtt == UINT32_MAX) {
+		return 0;
+	}
+
+	return (uint64_t)tcp_bbr_max_bw(bbr) * bbr->min_rtt * gain /
+	       (MSEC_PER_SEC * BBR_UNIT_GAIN);
+}
+
+static uint32_t tcp_bbr_cwnd_gain(struct tcp_bbr *bbr)
+{
+	switch (bbr->state) {
+	case BBR_STARTUP:
+		return BBR_HIGH_GAIN;
+	case BBR_PROBE_BW:
+		return BBR_CWND_GAIN * bbr_cycle_gain[bbr->cycle_idx] / BBR_UNIT_GAIN;
+	default:
+		return BBR_UNIT_GAIN;
+	}
+}
+
+static uint32_t tcp_bbr_min_cwnd(struct tcp *conn)
+{
+	return conn_mss(conn) * BBR_MIN_CWND_SEGMENTS;
+}
+
+static void tcp_bbr_init(struct tcp *conn)
+{
+	struct tcp_bbr *bbr = &conn->ca.bbr;
+
+	memset(bbr, 0, sizeof(*bbr));
+	bbr->state = BBR_STARTUP;
+	bbr->min_rtt = UINT32_MAX;
+	bbr->min_rtt_stamp = k_uptime_get_32();
+
+	conn->ca.cwnd = tcp_bbr_min_cwnd(conn);
+	conn->ca.ssthresh = UINT16_MAX;
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	tcp_bbr_log(conn, "init");
+}
+
+/* Losses are not a congestion signal, the model tells how much to send */
+static void tcp_bbr_fast_retransmit(struct tcp *conn)
+{
+	tcp_bbr_log(conn, "fast_retransmit");
+}
+
+static void tcp_bbr_timeout(struct tcp *conn)
+{
+	/* Restart from one segment, the window grows back to the model */
+	conn->ca.cwnd = conn_mss(conn);
+	tcp_bbr_log(conn, "timeout");
+}
+
+static void tcp_bbr_dup_ack(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static void tcp_bbr_update_min_rtt(struct tcp *conn, uint32_t rtt, uint32_t now)
+{
+	struct tcp_bbr *bbr = &conn->ca.bbr;
+	bool expired = now - bbr->min_rtt_stamp > BBR_MIN_RTT_WINDOW_MS;
+
+	if (rtt <= bbr->min_rtt || expired) {
+		bbr->min_rtt = rtt;
+		bbr->min_rtt_stamp = now;
+	}
+
+	/* Drain the queue for a while to measure the propagation delay */
+	if (expired && bbr->state != BBR_PROBE_RTT) {
+		bbr->prior_cwnd = conn->ca.cwnd;
+		bbr->state = BBR_PROBE_RTT;
+		bbr->probe_rtt_end = now + BBR_PROBE_RTT_MS;
+	}
+}
+
+static void tcp_bbr_round(struct tcp *conn, uint32_t rtt, uint32_t delivered)
+{
+	struct tcp_bbr *bbr = &conn->ca.bbr;
+	uint32_t now = k_uptime_get_32();
+
+	/* Millisecond timing of a fast path may round down to nothing */
+	rtt = MAX(rtt, 1U);
+
+	bbr->rounds++;
+	bbr->bw[bbr->rounds % ARRAY_SIZE(bbr->bw)] =
+		(uint64_t)delivered * MSEC_PER_SEC / rtt;
+
+	tcp_bbr_update_min_rtt(conn, rtt, now);
+
+	switch (bbr->state) {
+	case BBR_STARTUP:
+		if (tcp_bbr_max_bw(bbr) * 100ULL >= bbr->full_bw * (uint64_t)BBR_FULL_BW_GROWTH) {
+			bbr->full_bw = tcp_bbr_max_bw(bbr);
+			bbr->full_bw_cnt = 0;
+		} else if (++bbr->full_bw_cnt >= BBR_FULL_BW_ROUNDS) {
+			bbr->state = BBR_DRAIN;
+		}
+		break;
+	case BBR_PROBE_BW:
+		bbr->cycle_idx = (bbr->cycle_idx + 1) % ARRAY_SIZE(bbr_cycle_gain);
+		break;
+	case BBR_PROBE_RTT:
+		if ((int32_t)(now - bbr->probe_rtt_end) >= 0) {
+			bbr->min_rtt_stamp = now;
+			bbr->state = bbr->full_bw_cnt >= BBR_FULL_BW_ROUNDS ?
+				     BBR_PROBE_BW : BBR_STARTUP;
+			conn->ca.cwnd = MAX(conn->ca.cwnd, bbr->prior_cwnd);
+		}
+		break;
+	default:
+		break;
+	}
+
+	tcp_bbr_log(conn, "round");
+}
+
+static void tcp_bbr_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_bbr *bbr = &conn->ca.bbr;
+	uint32_t cwnd = conn->ca.cwnd;
+	uint32_t in_flight;
+	uint32_t target;
+
+	if (bbr->state == BBR_PROBE_RTT) {
+		conn->ca.cwnd = tcp_bbr_min_cwnd(conn);
+		return;
+	}
+
+	in_flight = conn->unacked_len > acked_len ? conn->unacked_len - acked_len : 0;
+
+	if (bbr->state == BBR_DRAIN && in_flight <= tcp_bbr_bdp(conn, BBR_UNIT_GAIN)) {
+		bbr->state = BBR_PROBE_BW;
+		bbr->cycle_idx = 0;
+	}
+
+	target = tcp_bbr_bdp(conn, tcp_bbr_cwnd_gain(bbr));
+
+	if (bbr->state == BBR_STARTUP) {
+		/* Slow start until the bandwidth stops growing */
+		if (target == 0 || cwnd < target) {
+			cwnd += acked_len;
+		}
+	} else {
+		cwnd = MIN(cwnd + acked_len, target);
+	}
+
+	conn->ca.cwnd = CLAMP(cwnd, tcp_bbr_min_cwnd(conn), UINT16_MAX);
+	tcp_bbr_log(conn, "pkts_acked");
+}
+
+const struct tcp_ca_ops tcp_bbr_ops = {
+	.name = "bbr",
+	.init = tcp_bbr_init,
+	.fast_retransmit = tcp_bbr_fast_retransmit,
+	.timeout = tcp_bbr_timeout,
+	.dup_ack = tcp_bbr_dup_ack,
+	.pkts_acked = tcp_bbr_pkts_acked,
+	.round = tcp_bbr_round,
+};
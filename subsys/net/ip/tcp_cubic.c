@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+
+#include "tcp_internal.h"
+
+/* Implementation according to RFC 9438, with the windows in bytes and the
+ * times in milliseconds.
+ */
+
+/* Multiplicative decrease factor, 0.7 */
+#define CUBIC_BETA_NUM 7
+#define CUBIC_BETA_DEN 10
+
+/* C = 0.4 segments per cubed second, so 4 segments per 10^10 cubed ms */
+#define CUBIC_C_NUM 4
+#define CUBIC_C_DEN 10000000000LL
+
+/* Reno-friendly additive increase, 3 * (1 - beta) / (1 + beta) */
+#define CUBIC_ALPHA_NUM 9
+#define CUBIC_ALPHA_DEN 17
+
+/* Bound the time from the plateau, so that its cube does not overflow */
+#define CUBIC_MAX_OFFSET_MS 10000
+
+static void tcp_cubic_log(struct tcp *conn, char *step)
+{
+	NET_DBG("conn: %p, ca %s, cwnd=%d, ssthres=%d, w_max=%d, k=%u",
+		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
+		conn->ca.cubic.w_max, conn->ca.cubic.k);
+}
+
+/* The argument is below 2^60, so that the cube of the candidates, which are
+ * below 2^20, does not overflow.
+ */
+static uint32_t cubic_root(uint64_t a)
+{
+	uint32_t x = 0;
+
+	for (int bit = 19; bit >= 0; bit--) {
+		uint32_t y = x | BIT(bit);
+
+		if ((uint64_t)y * y * y <= a) {
+			x = y;
+		}
+	}
+
+	return x;
+}
+
+static void tcp_cubic_init(struct tcp *conn)
+{
+	uint16_t mss = conn_mss(conn);
+
+	/* Initial window of RFC 5681, then slow start up to the first
+	 * congestion event.
+	 */
+	conn->ca.cwnd = MIN(mss * 4, MAX(mss * 2, 4380));
+	conn->ca.ssthresh = UINT16_MAX;
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	conn->ca.cubic.w_max = 0;
+	conn->ca.cubic.srtt = 0;
+	conn->ca.cubic.in_epoch = false;
+	tcp_cubic_log(conn, "init");
+}
+
+/* Base the reduction on the flight size, as New Reno does, since the cwnd
+ * may be inflated by duplicate acks or not be used up by the sender.
+ */
+static void tcp_cubic_reduce(struct tcp *conn)
+{
+	struct tcp_cubic *cubic = &conn->ca.cubic;
+	uint16_t flight = MIN(conn->unacked_len, UINT16_MAX);
+
+	/* Fast convergence: leave some room to the flows which caused it */
+	if (flight < cubic->w_max) {
+		cubic->w_max = flight * (CUBIC_BETA_DEN + CUBIC_BETA_NUM) /
+			       (2 * CUBIC_BETA_DEN);
+	} else {
+		cubic->w_max = flight;
+	}
+
+	conn->ca.ssthresh = MAX(flight * CUBIC_BETA_NUM / CUBIC_BETA_DEN,
+				conn_mss(conn) * 2);
+	cubic->in_epoch = false;
+}
+
+static void tcp_cubic_fast_retransmit(struct tcp *conn)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		tcp_cubic_reduce(conn);
+		/* Account for the lost segments */
+		conn->ca.cwnd = MIN(conn->ca.ssthresh + conn_mss(conn) * 3, UINT16_MAX);
+		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
+		tcp_cubic_log(conn, "fast_retransmit");
+	}
+}
+
+static void tcp_cubic_timeout(struct tcp *conn)
+{
+	tcp_cubic_reduce(conn);
+	conn->ca.cwnd = conn_mss(conn);
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	tcp_cubic_log(conn, "timeout");
+}
+
+/* For every duplicate ack increment the cwnd by mss */
+static void tcp_cubic_dup_ack(struct tcp *conn)
+{
+	conn->ca.cwnd = MIN(conn->ca.cwnd + conn_mss(conn), UINT16_MAX);
+	tcp_cubic_log(conn, "dup_ack");
+}
+
+static void tcp_cubic_round(struct tcp *conn, uint32_t rtt, uint32_t delivered)
+{
+	struct tcp_cubic *cubic = &conn->ca.cubic;
+
+	ARG_UNUSED(delivered);
+
+	cubic->srtt = cubic->srtt == 0 ? rtt : (cubic->srtt * 7 + rtt) / 8;
+}
+
+static void tcp_cubic_increase(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_cubic *cubic = &conn->ca.cubic;
+	uint32_t now = k_uptime_get_32();
+	uint32_t cwnd = conn->ca.cwnd;
+	uint32_t mss = conn_mss(conn);
+	uint32_t target;
+	int64_t offset;
+	int64_t delta;
+
+	if (!cubic->in_epoch) {
+		cubic->in_epoch = true;
+		cubic->epoch_start = now;
+		cubic->w_est = cwnd;
+
+		if (cwnd < cubic->w_max) {
+			cubic->k = cubic_root((uint64_t)(cubic->w_max - cwnd) * CUBIC_C_DEN /
+					      (CUBIC_C_NUM * mss));
+			cubic->origin = cubic->w_max;
+		} else {
+			cubic->k = 0;
+			cubic->origin = cwnd;
+		}
+	}
+
+	/* Aim at the window of the cubic function one round-trip time later */
+	offset = (int64_t)(now - cubic->epoch_start) + cubic->srtt - cubic->k;
+	offset = CLAMP(offset, -CUBIC_MAX_OFFSET_MS, CUBIC_MAX_OFFSET_MS);
+	delta = CUBIC_C_NUM * offset * offset * offset * mss / CUBIC_C_DEN;
+	target = CLAMP(cubic->origin + delta, (int64_t)cwnd, (int64_t)cwnd * 3 / 2);
+
+	/* Grow at least as fast as Reno would */
+	cubic->w_est += (uint64_t)acked_len * mss * CUBIC_ALPHA_NUM /
+			(CUBIC_ALPHA_DEN * cwnd);
+
+	if (cubic->w_est > target) {
+		conn->ca.cwnd = MIN(cubic->w_est, UINT16_MAX);
+	} else {
+		conn->ca.cwnd = MIN(cwnd + (target - cwnd) * acked_len / cwnd, UINT16_MAX);
+	}
+}
+
+static void tcp_cubic_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_congestion *ca = &conn->ca;
+
+	if (ca->pending_fast_retransmit_bytes > 0) {
+		/* Check if it is still in fast recovery mode */
+		if (ca->pending_fast_retransmit_bytes <= acked_len) {
+			ca->pending_fast_retransmit_bytes = 0;
+			ca->cwnd = ca->ssthresh;
+		} else {
+			ca->pending_fast_retransmit_bytes -= acked_len;
+			ca->cwnd = MAX(ca->cwnd - (int32_t)acked_len, (int32_t)conn_mss(conn));
+		}
+	} else if (ca->cwnd < ca->ssthresh) {
+		ca->cwnd = MIN(ca->cwnd + MIN(acked_len, conn_mss(conn)), UINT16_MAX);
+	} else {
+		tcp_cubic_increase(conn, acked_len);
+	}
+
+	tcp_cubic_log(conn, "pkts_acked");
+}
+
+const struct tcp_ca_ops tcp_cubic_ops = {
+	.name = "cubic",
+	.init = tcp_cubic_init,
+	.fast_retransmit = tcp_cubic_fast_retransmit,
+	.timeout = tcp_cubic_timeout,
+	.dup_ack = tcp_cubic_dup_ack,
+	.pkts_acked = tcp_cubic_pkts_acked,
+	.round = tcp_cubic_round,
+};
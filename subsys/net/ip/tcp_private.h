@@ -229,30 +229,142 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* SACK blocks fitting in the TCP options, along with 2 NOPs for alignment */
+#define NET_TCP_SACK_MAX_BLOCKS   4
+
+struct tcp_sack_block {
+	uint32_t start;
+	uint32_t end;
+};
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_block sack[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t sack_cnt;
+#endif
 	bool mss_found : 1;
 	bool wnd_found : 1;
+#ifdef CONFIG_NET_TCP_SACK
+	bool sack_perm_found : 1;
+#endif
 };
 
+#ifdef CONFIG_NET_TCP_SACK
+/* Sent data the peer has selectively acknowledged, and the state of the
+ * SACK based loss recovery (RFC 6675).
+ */
+struct tcp_sack_scoreboard {
+	/* Disjoint ranges above SND.UNA, in sequence order */
+	struct tcp_sack_block blocks[NET_TCP_SACK_MAX_BLOCKS];
+	/* SND.NXT when the loss recovery started */
+	uint32_t recovery_point;
+	/* End of the data retransmitted during the loss recovery */
+	uint32_t high_rxt;
+	uint8_t cnt;
+	bool in_recovery : 1;
+};
+#endif
+
+struct tcp;
+
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
-struct tcp_collision_avoidance_reno {
+/* Congestion control algorithm, its callbacks are called with the connection
+ * locked.
+ */
+struct tcp_ca_ops {
+	/* Name of the algorithm for the TCP_CONGESTION socket option */
+	const char *name;
+	void (*init)(struct tcp *conn);
+	void (*fast_retransmit)(struct tcp *conn);
+	void (*timeout)(struct tcp *conn);
+	void (*dup_ack)(struct tcp *conn);
+	/* Called before SND.UNA and the unacked length are updated */
+	void (*pkts_acked)(struct tcp *conn, uint32_t acked_len);
+	/* Optional, called when the first segment sent in a round trip is
+	 * acknowledged, unless data was retransmitted meanwhile. rtt is the
+	 * round-trip time in milliseconds, and delivered the number of bytes
+	 * acknowledged during it.
+	 */
+	void (*round)(struct tcp *conn, uint32_t rtt, uint32_t delivered);
+};
+
+#define TCP_CA_NAME_MAX 16
+
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+struct tcp_cubic {
+	uint32_t epoch_start;
+	uint32_t k;
+	uint32_t w_est;
+	uint32_t srtt;
+	uint16_t w_max;
+	uint16_t origin;
+	bool in_epoch : 1;
+};
+#endif
+
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+#define TCP_BBR_BW_ROUNDS 10
+
+struct tcp_bbr {
+	/* Delivery rate of the last rounds, in bytes per second */
+	uint32_t bw[TCP_BBR_BW_ROUNDS];
+	uint32_t full_bw;
+	uint32_t min_rtt;
+	uint32_t min_rtt_stamp;
+	uint32_t probe_rtt_end;
+	uint32_t rounds;
+	uint16_t prior_cwnd;
+	uint8_t state;
+	uint8_t cycle_idx;
+	uint8_t full_bw_cnt;
+};
+#endif
+
+struct tcp_congestion {
+	const struct tcp_ca_ops *ops;
 	uint16_t cwnd;
 	uint16_t ssthresh;
 	uint16_t pending_fast_retransmit_bytes;
+	/* Round trip being timed, ending when round_seq is acknowledged */
+	uint32_t round_seq;
+	uint32_t round_start;
+	uint32_t round_delivered;
+	bool round_active : 1;
+	bool round_rexmit : 1;
+#if defined(CONFIG_NET_TCP_CONGESTION_CUBIC) || defined(CONFIG_NET_TCP_CONGESTION_BBR)
+	union {
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+		struct tcp_cubic cubic;
+#endif
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+		struct tcp_bbr bbr;
+#endif
+	};
+#endif
 };
+
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+extern const struct tcp_ca_ops tcp_cubic_ops;
+#endif
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+extern const struct tcp_ca_ops tcp_bbr_ops;
 #endif
+#endif /* CONFIG_NET_TCP_CONGESTION_AVOIDANCE */
 
-struct tcp;
 typedef void (*net_tcp_closed_cb_t)(struct tcp *conn, void *user_data);
 
 struct tcp { /* TCP connection */
@@ -324,7 +436,10 @@ struct tcp { /* TCP connection */
 	uint16_t rto;
 #endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
-	struct tcp_collision_avoidance_reno ca;
+	struct tcp_congestion ca;
+#endif
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_scoreboard sack;
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
@@ -339,6 +454,9 @@ struct tcp { /* TCP connection */
 	bool tcp_nodelay : 1;
 	bool addr_ref_done : 1;
 	bool rst_received : 1;
+#ifdef CONFIG_NET_TCP_SACK
+	bool sack_enabled : 1;
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
@@ -14,6 +14,7 @@ LOG_MODULE_REGISTER(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/timeutil.h>
 
 #include "sockets_internal.h"
 
@@ -386,90 +387,105 @@ ssize_t z_impl_zsock_sendmsg(int sock, const struct msghdr *msg, int flags)
 }
 
 #ifdef CONFIG_USERSPACE
-static inline ssize_t z_vrfy_zsock_sendmsg(int sock,
-					   const struct msghdr *msg,
-					   int flags)
+/* Free the buffers of a message copied from user memory, the first
+ * @p iovlen vectors of which were allocated.
+ */
+static void msghdr_copy_free(struct msghdr *msg_copy, size_t iovlen)
 {
-	struct msghdr msg_copy;
-	size_t i;
-	int ret;
+	k_free(msg_copy->msg_name);
+	k_free(msg_copy->msg_control);
 
-	K_OOPS(k_usermode_from_copy(&msg_copy, (void *)msg, sizeof(msg_copy)));
+	if (msg_copy->msg_iov != NULL) {
+		for (size_t i = 0; i < iovlen; i++) {
+			k_free(msg_copy->msg_iov[i].iov_base);
+		}
+
+		k_free(msg_copy->msg_iov);
+	}
+}
+
+/* Copy the buffers of the message to send @p msg from user memory into
+ * @p msg_copy, which holds a copy of its header. On failure nothing is left
+ * allocated, and -1 is returned with errno set.
+ */
+static int sendmsg_copy_from_user(struct msghdr *msg_copy,
+				  const struct msghdr *msg)
+{
+	size_t iovlen = msg_copy->msg_iovlen;
+	size_t i;
 
-	msg_copy.msg_name = NULL;
-	msg_copy.msg_control = NULL;
+	msg_copy->msg_name = NULL;
+	msg_copy->msg_control = NULL;
 
-	msg_copy.msg_iov = k_usermode_alloc_from_copy(msg->msg_iov,
-				       msg->msg_iovlen * sizeof(struct iovec));
-	if (!msg_copy.msg_iov) {
+	msg_copy->msg_iov = k_usermode_alloc_from_copy(msg->msg_iov,
+				       iovlen * sizeof(struct iovec));
+	if (!msg_copy->msg_iov) {
 		errno = ENOMEM;
-		goto fail;
+		return -1;
 	}
 
-	for (i = 0; i < msg->msg_iovlen; i++) {
-		msg_copy.msg_iov[i].iov_base =
+	/* Clear the pointers in the copy so that if the allocation in the
+	 * next loop fails, we do not try to free non allocated memory.
+	 */
+	memset(msg_copy->msg_iov, 0, iovlen * sizeof(struct iovec));
+
+	for (i = 0; i < iovlen; i++) {
+		msg_copy->msg_iov[i].iov_base =
 			k_usermode_alloc_from_copy(msg->msg_iov[i].iov_base,
 					       msg->msg_iov[i].iov_len);
-		if (!msg_copy.msg_iov[i].iov_base) {
+		if (!msg_copy->msg_iov[i].iov_base) {
 			errno = ENOMEM;
 			goto fail;
 		}
 
-		msg_copy.msg_iov[i].iov_len = msg->msg_iov[i].iov_len;
+		msg_copy->msg_iov[i].iov_len = msg->msg_iov[i].iov_len;
 	}
 
-	if (msg->msg_namelen > 0) {
-		msg_copy.msg_name = k_usermode_alloc_from_copy(msg->msg_name,
-							   msg->msg_namelen);
-		if (!msg_copy.msg_name) {
+	if (msg_copy->msg_namelen > 0) {
+		msg_copy->msg_name = k_usermode_alloc_from_copy(msg->msg_name,
+							    msg_copy->msg_namelen);
+		if (!msg_copy->msg_name) {
 			errno = ENOMEM;
 			goto fail;
 		}
 	}
 
-	if (msg->msg_controllen > 0) {
-		msg_copy.msg_control = k_usermode_alloc_from_copy(msg->msg_control,
-							  msg->msg_controllen);
-		if (!msg_copy.msg_control) {
+	if (msg_copy->msg_controllen > 0) {
+		msg_copy->msg_control = k_usermode_alloc_from_copy(msg->msg_control,
+							   msg_copy->msg_controllen);
+		if (!msg_copy->msg_control) {
 			errno = ENOMEM;
 			goto fail;
 		}
 	}
 
-	ret = z_impl_zsock_sendmsg(sock, (const struct msghdr *)&msg_copy,
-				   flags);
+	return 0;
 
-	k_free(msg_copy.msg_name);
-	k_free(msg_copy.msg_control);
-
-	for (i = 0; i < msg_copy.msg_iovlen; i++) {
-		k_free(msg_copy.msg_iov[i].iov_base);
-	}
+fail:
+	msghdr_copy_free(msg_copy, iovlen);
 
-	k_free(msg_copy.msg_iov);
+	return -1;
+}
 
-	return ret;
+static inline ssize_t z_vrfy_zsock_sendmsg(int sock,
+					   const struct msghdr *msg,
+					   int flags)
+{
+	struct msghdr msg_copy;
+	int ret;
 
-fail:
-	if (msg_copy.msg_name) {
-		k_free(msg_copy.msg_name);
-	}
+	K_OOPS(k_usermode_from_copy(&msg_copy, (void *)msg, sizeof(msg_copy)));
 
-	if (msg_copy.msg_control) {
-		k_free(msg_copy.msg_control);
+	if (sendmsg_copy_from_user(&msg_copy, msg) < 0) {
+		return -1;
 	}
 
-	if (msg_copy.msg_iov) {
-		for (i = 0; i < msg_copy.msg_iovlen; i++) {
-			if (msg_copy.msg_iov[i].iov_base) {
-				k_free(msg_copy.msg_iov[i].iov_base);
-			}
-		}
+	ret = z_impl_zsock_sendmsg(sock, (const struct msghdr *)&msg_copy,
+				   flags);
 
-		k_free(msg_copy.msg_iov);
-	}
+	msghdr_copy_free(&msg_copy, msg_copy.msg_iovlen);
 
-	return -1;
+	return ret;
 }
 #include <zephyr/syscalls/zsock_sendmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
@@ -541,42 +557,35 @@ ssize_t z_impl_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
 }
 
 #ifdef CONFIG_USERSPACE
-ssize_t z_vrfy_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
+/* Allocate the buffers of the message to receive @p msg into @p msg_copy,
+ * which holds a copy of its header with @p iovlen vectors. On failure
+ * nothing is left allocated, and -1 is returned with errno set.
+ */
+static int recvmsg_copy_from_user(struct msghdr *msg_copy,
+				  const struct msghdr *msg, size_t iovlen)
 {
-	struct msghdr msg_copy;
-	size_t iovlen;
 	size_t i;
-	int ret;
-
-	if (msg == NULL) {
-		errno = EINVAL;
-		return -1;
-	}
 
-	if (msg->msg_iov == NULL) {
+	if (msg_copy->msg_iov == NULL) {
 		errno = ENOMEM;
 		return -1;
 	}
 
-	K_OOPS(k_usermode_from_copy(&msg_copy, (void *)msg, sizeof(msg_copy)));
-
-	k_usermode_from_copy(&iovlen, &msg->msg_iovlen, sizeof(iovlen));
+	msg_copy->msg_name = NULL;
+	msg_copy->msg_control = NULL;
 
-	msg_copy.msg_name = NULL;
-	msg_copy.msg_control = NULL;
-
-	msg_copy.msg_iov = k_usermode_alloc_from_copy(msg->msg_iov,
-				       msg->msg_iovlen * sizeof(struct iovec));
-	if (!msg_copy.msg_iov) {
+	msg_copy->msg_iov = k_usermode_alloc_from_copy(msg->msg_iov,
+				       iovlen * sizeof(struct iovec));
+	if (!msg_copy->msg_iov) {
 		errno = ENOMEM;
-		goto fail;
+		return -1;
 	}
 
 	/* Clear the pointers in the copy so that if the allocation in the
 	 * next loop fails, we do not try to free non allocated memory
 	 * in fail branch.
 	 */
-	memset(msg_copy.msg_iov, 0, msg->msg_iovlen * sizeof(struct iovec));
+	memset(msg_copy->msg_iov, 0, iovlen * sizeof(struct iovec));
 
 	for (i = 0; i < iovlen; i++) {
 		/* TODO: In practice we do not need to copy the actual data
@@ -585,129 +594,394 @@ ssize_t z_vrfy_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
 		 * relevant malloc function here ourselves). So just use
 		 * the copying variant for now.
 		 */
-		msg_copy.msg_iov[i].iov_base =
+		msg_copy->msg_iov[i].iov_base =
 			k_usermode_alloc_from_copy(msg->msg_iov[i].iov_base,
 						   msg->msg_iov[i].iov_len);
-		if (!msg_copy.msg_iov[i].iov_base) {
+		if (!msg_copy->msg_iov[i].iov_base) {
 			errno = ENOMEM;
 			goto fail;
 		}
 
-		msg_copy.msg_iov[i].iov_len = msg->msg_iov[i].iov_len;
+		msg_copy->msg_iov[i].iov_len = msg->msg_iov[i].iov_len;
 	}
 
-	if (msg->msg_namelen > 0) {
+	if (msg_copy->msg_namelen > 0) {
 		if (msg->msg_name == NULL) {
 			errno = EINVAL;
 			goto fail;
 		}
 
-		msg_copy.msg_name = k_usermode_alloc_from_copy(msg->msg_name,
-							   msg->msg_namelen);
-		if (msg_copy.msg_name == NULL) {
+		msg_copy->msg_name = k_usermode_alloc_from_copy(msg->msg_name,
+							    msg_copy->msg_namelen);
+		if (msg_copy->msg_name == NULL) {
 			errno = ENOMEM;
 			goto fail;
 		}
 	}
 
-	if (msg->msg_controllen > 0) {
+	if (msg_copy->msg_controllen > 0) {
 		if (msg->msg_control == NULL) {
 			errno = EINVAL;
 			goto fail;
 		}
 
-		msg_copy.msg_control =
+		msg_copy->msg_control =
 			k_usermode_alloc_from_copy(msg->msg_control,
-						   msg->msg_controllen);
-		if (msg_copy.msg_control == NULL) {
+						   msg_copy->msg_controllen);
+		if (msg_copy->msg_control == NULL) {
 			errno = ENOMEM;
 			goto fail;
 		}
 	}
 
+	return 0;
+
+fail:
+	msghdr_copy_free(msg_copy, iovlen);
+
+	return -1;
+}
+
+/* Copy what was received in @p msg_copy back to the user message @p msg,
+ * which had @p iovlen vectors.
+ */
+static void recvmsg_copy_to_user(struct msghdr *msg,
+				 const struct msghdr *msg_copy, size_t iovlen)
+{
+	size_t i;
+
+	if (msg->msg_namelen > 0 && msg->msg_name != NULL) {
+		K_OOPS(k_usermode_to_copy(msg->msg_name,
+					  msg_copy->msg_name,
+					  msg_copy->msg_namelen));
+		K_OOPS(k_usermode_to_copy(&msg->msg_namelen,
+					  &msg_copy->msg_namelen,
+					  sizeof(msg->msg_namelen)));
+	}
+
+	if (msg->msg_controllen > 0 &&
+	    msg->msg_control != NULL) {
+		K_OOPS(k_usermode_to_copy(msg->msg_control,
+					  msg_copy->msg_control,
+					  msg_copy->msg_controllen));
+
+		msg->msg_controllen = msg_copy->msg_controllen;
+	} else {
+		msg->msg_controllen = 0U;
+	}
+
+	k_usermode_to_copy(&msg->msg_iovlen,
+			   &msg_copy->msg_iovlen,
+			   sizeof(msg->msg_iovlen));
+
+	/* The new iovlen cannot be bigger than the original one */
+	NET_ASSERT(msg_copy->msg_iovlen <= iovlen);
+
+	for (i = 0; i < iovlen; i++) {
+		if (i < msg_copy->msg_iovlen) {
+			/* Nothing to copy for an empty datagram */
+			if (msg_copy->msg_iov[i].iov_len > 0U) {
+				K_OOPS(k_usermode_to_copy(msg->msg_iov[i].iov_base,
+							  msg_copy->msg_iov[i].iov_base,
+							  msg_copy->msg_iov[i].iov_len));
+			}
+
+			K_OOPS(k_usermode_to_copy(&msg->msg_iov[i].iov_len,
+						  &msg_copy->msg_iov[i].iov_len,
+						  sizeof(msg->msg_iov[i].iov_len)));
+		} else {
+			/* Clear out those vectors that we could not populate */
+			msg->msg_iov[i].iov_len = 0;
+		}
+	}
+
+	k_usermode_to_copy(&msg->msg_flags,
+			   &msg_copy->msg_flags,
+			   sizeof(msg->msg_flags));
+}
+
+ssize_t z_vrfy_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
+{
+	struct msghdr msg_copy;
+	size_t iovlen;
+	int ret;
+
+	if (msg == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	K_OOPS(k_usermode_from_copy(&msg_copy, (void *)msg, sizeof(msg_copy)));
+
+	/* Free according to the original iovlen, which the receive may lower */
+	iovlen = msg_copy.msg_iovlen;
+
+	if (recvmsg_copy_from_user(&msg_copy, msg, iovlen) < 0) {
+		return -1;
+	}
+
 	ret = z_impl_zsock_recvmsg(sock, &msg_copy, flags);
 
 	/* Do not copy anything back if there was an error or nothing was
 	 * received.
 	 */
 	if (ret > 0) {
-		if (msg->msg_namelen > 0 && msg->msg_name != NULL) {
-			K_OOPS(k_usermode_to_copy(msg->msg_name,
-						  msg_copy.msg_name,
-						  msg_copy.msg_namelen));
-		}
+		recvmsg_copy_to_user(msg, &msg_copy, iovlen);
+	}
 
-		if (msg->msg_controllen > 0 &&
-		    msg->msg_control != NULL) {
-			K_OOPS(k_usermode_to_copy(msg->msg_control,
-						  msg_copy.msg_control,
-						  msg_copy.msg_controllen));
+	msghdr_copy_free(&msg_copy, iovlen);
 
-			msg->msg_controllen = msg_copy.msg_controllen;
-		} else {
-			msg->msg_controllen = 0U;
-		}
+	return ret;
+}
+#include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
 
-		k_usermode_to_copy(&msg->msg_iovlen,
-				   &msg_copy.msg_iovlen,
-				   sizeof(msg->msg_iovlen));
+int z_impl_zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	unsigned int sent;
+	ssize_t ret = 0;
+	void *obj;
 
-		/* The new iovlen cannot be bigger than the original one */
-		NET_ASSERT(msg_copy.msg_iovlen <= iovlen);
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
 
-		for (i = 0; i < iovlen; i++) {
-			if (i < msg_copy.msg_iovlen) {
-				K_OOPS(k_usermode_to_copy(msg->msg_iov[i].iov_base,
-							  msg_copy.msg_iov[i].iov_base,
-							  msg_copy.msg_iov[i].iov_len));
-				K_OOPS(k_usermode_to_copy(&msg->msg_iov[i].iov_len,
-							  &msg_copy.msg_iov[i].iov_len,
-							  sizeof(msg->msg_iov[i].iov_len)));
-			} else {
-				/* Clear out those vectors that we could not populate */
-				msg->msg_iov[i].iov_len = 0;
-			}
+	if (vtable->sendmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	/* Unlike VTABLE_CALL(), keep the socket locked for the whole batch */
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (sent = 0U; sent < vlen; sent++) {
+		struct msghdr *msg = &msgvec[sent].msg_hdr;
+
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, sendmsg, sock, msg, flags);
+
+		ret = vtable->sendmsg(obj, msg, flags);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, sendmsg, sock,
+					       ret < 0 ? -errno : ret);
+
+		if (ret < 0) {
+			break;
 		}
 
-		k_usermode_to_copy(&msg->msg_flags,
-				   &msg_copy.msg_flags,
-				   sizeof(msg->msg_flags));
+		msgvec[sent].msg_len = ret;
+		sock_obj_core_update_send_stats(sock, ret);
 	}
 
-	k_free(msg_copy.msg_name);
-	k_free(msg_copy.msg_control);
+	k_mutex_unlock(lock);
 
-	/* Note that we need to free according to original iovlen */
-	for (i = 0; i < iovlen; i++) {
-		k_free(msg_copy.msg_iov[i].iov_base);
+	/* An error after the first message is left for the next call */
+	return sent > 0U ? (int)sent : (int)ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	struct mmsghdr *msgvec_copy;
+	unsigned int copied;
+	int ret = -1;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen, sizeof(struct mmsghdr)));
+
+	if (vlen == 0U) {
+		return z_impl_zsock_sendmmsg(sock, NULL, 0U, flags);
+	}
+
+	msgvec_copy = k_usermode_alloc_from_copy(msgvec, vlen * sizeof(struct mmsghdr));
+	if (msgvec_copy == NULL) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	/* Copy every message in first, so that the batch is sent with the
+	 * socket locked once, as from kernel mode.
+	 */
+	for (copied = 0U; copied < vlen; copied++) {
+		if (sendmsg_copy_from_user(&msgvec_copy[copied].msg_hdr,
+					   &msgvec[copied].msg_hdr) < 0) {
+			goto out;
+		}
+	}
+
+	ret = z_impl_zsock_sendmmsg(sock, msgvec_copy, vlen, flags);
+
+	for (int i = 0; i < ret; i++) {
+		K_OOPS(k_usermode_to_copy(&msgvec[i].msg_len, &msgvec_copy[i].msg_len,
+					  sizeof(msgvec[i].msg_len)));
+	}
+
+out:
+	for (unsigned int i = 0U; i < copied; i++) {
+		msghdr_copy_free(&msgvec_copy[i].msg_hdr,
+				 msgvec_copy[i].msg_hdr.msg_iovlen);
 	}
 
-	k_free(msg_copy.msg_iov);
+	k_free(msgvec_copy);
 
 	return ret;
+}
+#include <zephyr/syscalls/zsock_sendmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
 
-fail:
-	if (msg_copy.msg_name) {
-		k_free(msg_copy.msg_name);
+/* The timeout of recvmmsg() ends the batch, it does not bound the waits */
+static int recvmmsg_end(const struct timespec *timeout, k_timepoint_t *end)
+{
+	if (timeout == NULL) {
+		*end = sys_timepoint_calc(K_FOREVER);
+		return 0;
 	}
 
-	if (msg_copy.msg_control) {
-		k_free(msg_copy.msg_control);
+	if (timeout->tv_sec < 0 || !timespec_is_valid(timeout)) {
+		errno = EINVAL;
+		return -1;
 	}
 
-	if (msg_copy.msg_iov) {
-		for (i = 0; i < msg_copy.msg_iovlen; i++) {
-			if (msg_copy.msg_iov[i].iov_base) {
-				k_free(msg_copy.msg_iov[i].iov_base);
-			}
+	*end = sys_timepoint_calc(timespec_to_timeout(timeout));
+
+	return 0;
+}
+
+int z_impl_zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags, struct timespec *timeout)
+{
+	const struct socket_op_vtable *vtable;
+	int msg_flags = flags & ~ZSOCK_MSG_WAITFORONE;
+	unsigned int received = 0U;
+	struct k_mutex *lock;
+	k_timepoint_t end;
+	ssize_t ret = 0;
+	void *obj;
+
+	if (recvmmsg_end(timeout, &end) < 0) {
+		return -1;
+	}
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->recvmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	/* Blocking receives release the lock while they wait */
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	while (received < vlen) {
+		struct msghdr *msg = &msgvec[received].msg_hdr;
+
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, recvmsg, sock, msg, msg_flags);
+
+		ret = vtable->recvmsg(obj, msg, msg_flags);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, recvmsg, sock, msg,
+					       ret < 0 ? -errno : ret);
+
+		if (ret < 0) {
+			break;
+		}
+
+		msgvec[received].msg_len = ret;
+		received++;
+		sock_obj_core_update_recv_stats(sock, ret);
+
+		if ((flags & ZSOCK_MSG_WAITFORONE) != 0) {
+			msg_flags |= ZSOCK_MSG_DONTWAIT;
 		}
 
-		k_free(msg_copy.msg_iov);
+		if (sys_timepoint_expired(end)) {
+			break;
+		}
 	}
 
-	return -1;
+	k_mutex_unlock(lock);
+
+	/* An error after the first message is left for the next call */
+	return received > 0U ? (int)received : (int)ret;
 }
-#include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags,
+					struct timespec *timeout)
+{
+	struct mmsghdr *msgvec_copy;
+	struct timespec timeout_copy;
+	unsigned int copied;
+	size_t *iovlens;
+	int ret = -1;
+
+	if (timeout != NULL) {
+		K_OOPS(k_usermode_from_copy(&timeout_copy, timeout,
+					    sizeof(timeout_copy)));
+	}
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen, sizeof(struct mmsghdr)));
+
+	if (vlen == 0U) {
+		return z_impl_zsock_recvmmsg(sock, NULL, 0U, flags,
+					     timeout != NULL ? &timeout_copy : NULL);
+	}
+
+	msgvec_copy = k_usermode_alloc_from_copy(msgvec, vlen * sizeof(struct mmsghdr));
+	iovlens = k_malloc(vlen * sizeof(size_t));
+	if (msgvec_copy == NULL || iovlens == NULL) {
+		k_free(msgvec_copy);
+		k_free(iovlens);
+		errno = ENOMEM;
+		return -1;
+	}
+
+	/* Set up every message first, so that the batch is received with the
+	 * socket locked once, as from kernel mode. Receives lower msg_iovlen,
+	 * so the original one is kept for copying back and freeing.
+	 */
+	for (copied = 0U; copied < vlen; copied++) {
+		iovlens[copied] = msgvec_copy[copied].msg_hdr.msg_iovlen;
+
+		if (recvmsg_copy_from_user(&msgvec_copy[copied].msg_hdr,
+					   &msgvec[copied].msg_hdr,
+					   iovlens[copied]) < 0) {
+			goto out;
+		}
+	}
+
+	ret = z_impl_zsock_recvmmsg(sock, msgvec_copy, vlen, flags,
+				    timeout != NULL ? &timeout_copy : NULL);
+
+	for (int i = 0; i < ret; i++) {
+		/* Zero-length datagrams still have a source address and flags */
+		recvmsg_copy_to_user(&msgvec[i].msg_hdr,
+				     &msgvec_copy[i].msg_hdr, iovlens[i]);
+
+		K_OOPS(k_usermode_to_copy(&msgvec[i].msg_len, &msgvec_copy[i].msg_len,
+					  sizeof(msgvec[i].msg_len)));
+	}
+
+out:
+	for (unsigned int i = 0U; i < copied; i++) {
+		msghdr_copy_free(&msgvec_copy[i].msg_hdr, iovlens[i]);
+	}
+
+	k_free(iovlens);
+	k_free(msgvec_copy);
+
+	return ret;
+}
+#include <zephyr/syscalls/zsock_recvmmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
 /* As this is limited function, we don't follow POSIX signature, with
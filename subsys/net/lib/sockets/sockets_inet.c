@@ -1530,6 +1530,287 @@ ssize_t zsock_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
 	return -1;
 }
 
+/* Point the iovecs of msg at the data of pkt from its cursor on, one per
+ * fragment, instead of copying it. Returns the number of bytes lent.
+ */
+static size_t zsock_lend_pkt_data(struct net_pkt *pkt, struct msghdr *msg,
+				  size_t max_len)
+{
+	struct net_buf *buf = pkt->cursor.buf;
+	uint8_t *pos = pkt->cursor.pos;
+	size_t lent = 0;
+	size_t iovec = 0;
+
+	while (buf != NULL && iovec < msg->msg_iovlen && lent < max_len) {
+		size_t len = MIN(buf->len - (pos - buf->data), max_len - lent);
+
+		if (len > 0) {
+			msg->msg_iov[iovec].iov_base = pos;
+			msg->msg_iov[iovec].iov_len = len;
+			iovec++;
+			lent += len;
+		}
+
+		buf = buf->frags;
+		if (buf != NULL) {
+			pos = buf->data;
+		}
+	}
+
+	msg->msg_iovlen = iovec;
+
+	return lent;
+}
+
+static ssize_t zsock_recv_dgram_zc(struct net_context *ctx, struct msghdr *msg,
+				   int flags, struct zsock_rx_loan *loan)
+{
+	k_timeout_t timeout = K_FOREVER;
+	struct net_pkt *pkt;
+	size_t pkt_len;
+	size_t len;
+	int ret;
+
+	if (!(flags & ZSOCK_MSG_DONTWAIT) && !sock_is_nonblock(ctx)) {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+
+		ret = zsock_wait_data(ctx, &timeout);
+		if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	pkt = k_fifo_get(&ctx->recv_q, K_NO_WAIT);
+	if (pkt == NULL) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	if (msg->msg_name != NULL) {
+		struct sockaddr *src_addr = msg->msg_name;
+
+		if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
+		    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
+			ret = sock_get_offload_pkt_src_addr(pkt, ctx, src_addr,
+							    msg->msg_namelen);
+		} else {
+			ret = sock_get_pkt_src_addr(ctx, pkt, src_addr,
+						    msg->msg_namelen);
+		}
+
+		if (ret == 0 && src_addr->sa_family == AF_INET) {
+			msg->msg_namelen = sizeof(struct sockaddr_in);
+		} else if (ret == 0 && src_addr->sa_family == AF_INET6) {
+			msg->msg_namelen = sizeof(struct sockaddr_in6);
+		} else {
+			errno = ret < 0 ? -ret : ENOTSUP;
+			net_pkt_unref(pkt);
+			return -1;
+		}
+	}
+
+	pkt_len = net_pkt_remaining_data(pkt);
+	len = zsock_lend_pkt_data(pkt, msg, pkt_len);
+	if (len < pkt_len) {
+		msg->msg_flags |= ZSOCK_MSG_TRUNC;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+	    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+		net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+	}
+
+	/* The reference of the receive queue goes to the loan */
+	loan->pkt = pkt;
+	loan->len = len;
+
+	return len;
+}
+
+static ssize_t zsock_recv_stream_zc(struct net_context *ctx, struct msghdr *msg,
+				    int flags, struct zsock_rx_loan *loan)
+{
+	k_timeout_t timeout = K_FOREVER;
+	struct net_pkt *pkt;
+	k_timepoint_t end;
+	size_t pkt_len;
+	size_t len;
+	int ret;
+
+	if (net_context_get_state(ctx) != NET_CONTEXT_CONNECTED) {
+		errno = ENOTCONN;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+	}
+
+	for (end = sys_timepoint_calc(timeout); ; timeout = sys_timepoint_timeout(end)) {
+		if (sock_is_error(ctx)) {
+			errno = POINTER_TO_INT(ctx->user_data);
+			return -1;
+		}
+
+		if (sock_is_eof(ctx)) {
+			return 0;
+		}
+
+		pkt = k_fifo_peek_head(&ctx->recv_q);
+		if (pkt != NULL) {
+			pkt_len = net_pkt_remaining_data(pkt);
+			if (pkt_len > 0) {
+				break;
+			}
+
+			/* Nothing left to lend, this may only mark the end of stream */
+			pkt = k_fifo_get(&ctx->recv_q, K_NO_WAIT);
+			if (net_pkt_eof(pkt)) {
+				sock_set_eof(ctx);
+			}
+
+			net_pkt_unref(pkt);
+			continue;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			errno = EAGAIN;
+			return -1;
+		}
+
+		ret = zsock_wait_data(ctx, &timeout);
+		if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	len = zsock_lend_pkt_data(pkt, msg, pkt_len);
+	if (len == pkt_len) {
+		/* The reference of the receive queue goes to the loan */
+		pkt = k_fifo_get(&ctx->recv_q, K_NO_WAIT);
+		if (net_pkt_eof(pkt)) {
+			sock_set_eof(ctx);
+		}
+
+		if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+		    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+			net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+		}
+	} else {
+		/* Leave the rest of the data queued, past what is lent */
+		net_pkt_ref(pkt);
+		net_pkt_skip(pkt, len);
+	}
+
+	loan->pkt = pkt;
+	loan->len = len;
+
+	return len;
+}
+
+ssize_t zsock_recvmsg_zc(int sock, struct msghdr *msg, int flags,
+			 struct zsock_rx_loan *loan)
+{
+	const struct fd_op_vtable *vtable;
+	struct net_context *ctx;
+	struct k_mutex *lock;
+	ssize_t ret;
+
+	if (msg == NULL || loan == NULL || (flags & ~ZSOCK_MSG_DONTWAIT) != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (msg->msg_iov == NULL || msg->msg_iovlen < 1) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	ctx = zvfs_get_fd_obj_and_vtable(sock, &vtable, &lock);
+	if (ctx == NULL) {
+		return -1;
+	}
+
+	/* Other socket implementations do not queue the packets received */
+	if (vtable != (const struct fd_op_vtable *)&sock_fd_op_vtable) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	memset(loan, 0, sizeof(*loan));
+	msg->msg_flags = 0;
+	msg->msg_controllen = 0U;
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	if (!net_context_is_used(ctx)) {
+		errno = EBADF;
+		ret = -1;
+	} else if (net_context_get_type(ctx) == SOCK_DGRAM ||
+		   net_context_get_type(ctx) == SOCK_RAW) {
+		ret = zsock_recv_dgram_zc(ctx, msg, flags, loan);
+	} else if (net_context_get_type(ctx) == SOCK_STREAM) {
+		ret = zsock_recv_stream_zc(ctx, msg, flags, loan);
+	} else {
+		errno = ENOTSUP;
+		ret = -1;
+	}
+
+	if (loan->pkt != NULL) {
+		/* Keep the context around until the data is given back */
+		net_context_ref(ctx);
+		loan->ctx = ctx;
+	}
+
+	k_mutex_unlock(lock);
+
+	if (ret > 0) {
+		sock_obj_core_update_recv_stats(sock, ret);
+	}
+
+	return ret;
+}
+
+int zsock_recvmsg_zc_release(struct zsock_rx_loan *loan)
+{
+	if (loan == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (loan->pkt == NULL) {
+		return 0;
+	}
+
+	/* Unlike zsock_recv_stream(), the window only reopens once the
+	 * buffers of the data are available again. If the socket was closed
+	 * meanwhile, the connection may already be released and there is no
+	 * window left to update.
+	 */
+#if defined(CONFIG_NET_TCP)
+	if (net_context_get_type(loan->ctx) == SOCK_STREAM) {
+		(void)k_mutex_lock(&loan->ctx->lock, K_FOREVER);
+
+		if (net_context_get_state(loan->ctx) == NET_CONTEXT_CONNECTED &&
+		    loan->ctx->tcp != NULL) {
+			(void)net_context_update_recv_wnd(loan->ctx, loan->len);
+		}
+
+		k_mutex_unlock(&loan->ctx->lock);
+	}
+#endif /* CONFIG_NET_TCP */
+
+	net_pkt_unref(loan->pkt);
+	net_context_unref(loan->ctx);
+	memset(loan, 0, sizeof(*loan));
+
+	return 0;
+}
+
 static int zsock_poll_prepare_ctx(struct net_context *ctx,
 				  struct zsock_pollfd *pfd,
 				  struct k_poll_event **pev,
@@ -1897,6 +2178,20 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 			ret = net_tcp_get_option(ctx, TCP_OPT_NODELAY, optval, optlen);
 			return ret;
 
+		case TCP_CONGESTION:
+			if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+				ret = net_tcp_get_option(ctx, TCP_OPT_CONGESTION,
+							 optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+
 		case TCP_KEEPIDLE:
 			__fallthrough;
 		case TCP_KEEPINTVL:
@@ -1919,6 +2214,26 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 
 		break;
 
+	case IPPROTO_UDP:
+		switch (optname) {
+		case UDP_SEGMENT:
+			if (IS_ENABLED(CONFIG_NET_CONTEXT_UDP_SEGMENT)) {
+				ret = net_context_get_option(ctx,
+							     NET_OPT_UDP_SEGMENT,
+							     optval, optlen);
+				if (ret < 0) {
+					errno  = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+		}
+
+		break;
+
 	case IPPROTO_IP:
 		switch (optname) {
 		case IP_TOS:
@@ -2528,6 +2843,20 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 						 TCP_OPT_NODELAY, optval, optlen);
 			return ret;
 
+		case TCP_CONGESTION:
+			if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+				ret = net_tcp_set_option(ctx, TCP_OPT_CONGESTION,
+							 optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+
 		case TCP_KEEPIDLE:
 			__fallthrough;
 		case TCP_KEEPINTVL:
@@ -2549,6 +2878,26 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 		}
 		break;
 
+	case IPPROTO_UDP:
+		switch (optname) {
+		case UDP_SEGMENT:
+			if (IS_ENABLED(CONFIG_NET_CONTEXT_UDP_SEGMENT)) {
+				ret = net_context_set_option(ctx,
+							     NET_OPT_UDP_SEGMENT,
+							     optval, optlen);
+				if (ret < 0) {
+					errno  = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+		}
+
+		break;
+
 	case IPPROTO_IP:
 		switch (optname) {
 		case IP_TOS:
@@ -1003,6 +1003,26 @@ static int shell_cmd_upload(const struct shell *sh, size_t argc,
 			opt_cnt += 1;
 			break;
 
+		case 'b': {
+			int batch = parse_arg(&i, argc, argv);
+
+			if (!is_udp) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "TCP does not support -b option\n");
+				return -ENOEXEC;
+			}
+
+			if (batch < 1 || batch > CONFIG_NET_ZPERF_UDP_BATCH_MAX) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			param.options.batch = batch;
+			opt_cnt += 2;
+			break;
+		}
+
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		case 't':
 			param.options.thread_priority = parse_arg(&i, argc, argv);
@@ -1256,6 +1276,26 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 			opt_cnt += 1;
 			break;
 
+		case 'b': {
+			int batch = parse_arg(&i, argc, argv);
+
+			if (!is_udp) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "TCP does not support -b option\n");
+				return -ENOEXEC;
+			}
+
+			if (batch < 1 || batch > CONFIG_NET_ZPERF_UDP_BATCH_MAX) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			param.options.batch = batch;
+			opt_cnt += 2;
+			break;
+		}
+
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		case 't':
 			param.options.thread_priority = parse_arg(&i, argc, argv);
@@ -1971,7 +2011,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 	SHELL_CMD(upload, NULL,
 		  "[<options>] <dest ip> [<dest port> <duration> <packet size>[K] "
 							"<baud rate>[K|M]]\n"
-		  "<options>     command options (optional): [-S tos -a]\n"
+		  "<options>     command options (optional): [-S tos -a -b count]\n"
 		  "<dest ip>     IP destination\n"
 		  "<dest port>   port destination\n"
 		  "<duration>    of the test in seconds "
@@ -1984,6 +2024,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 		  "Available options:\n"
 		  "-S tos: Specify IPv4/6 type of service\n"
 		  "-a: Asynchronous call (shell will not block for the upload)\n"
+		  "-b count: Send the datagrams in batches of count, up to "
+		  STRINGIFY(CONFIG_NET_ZPERF_UDP_BATCH_MAX) "\n"
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		  "-t: Specify custom thread priority\n"
 		  "-w: Wait for start signal before starting the tests\n"
@@ -1993,11 +2035,12 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
 		  "-I: Specify host interface name\n"
 		  "Example: udp upload 192.0.2.2 1111 1 1K 1M\n"
+		  "Example: udp upload -b 16 192.0.2.2 1111 1 1K 10M\n"
 		  "Example: udp upload 2001:db8::2\n",
 		  cmd_udp_upload),
 	SHELL_CMD(upload2, NULL,
 		  "[<options>] v6|v4 [<duration> <packet size>[K] <baud rate>[K|M]]\n"
-		  "<options>     command options (optional): [-S tos -a]\n"
+		  "<options>     command options (optional): [-S tos -a -b count]\n"
 		  "<v6|v4>:      Use either IPv6 or IPv4\n"
 		  "<duration>    of the test in seconds "
 							"(default " DEF_DURATION_SECONDS_STR ")\n"
@@ -2009,6 +2052,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 		  "Available options:\n"
 		  "-S tos: Specify IPv4/6 type of service\n"
 		  "-a: Asynchronous call (shell will not block for the upload)\n"
+		  "-b count: Send the datagrams in batches of count, up to "
+		  STRINGIFY(CONFIG_NET_ZPERF_UDP_BATCH_MAX) "\n"
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		  "-t: Specify custom thread priority\n"
 		  "-w: Wait for start signal before starting the tests\n"
@@ -19,6 +19,13 @@ static uint8_t sample_packet[sizeof(struct zperf_udp_datagram) +
 			     sizeof(struct zperf_client_hdr_v1) +
 			     PACKET_SIZE_MAX];
 
+#if CONFIG_NET_ZPERF_UDP_BATCH_MAX > 1
+/* Datagrams of a batch follow each other, every packet size bytes */
+static uint8_t batch_packets[CONFIG_NET_ZPERF_UDP_BATCH_MAX * PACKET_SIZE_MAX];
+static struct iovec batch_iov[CONFIG_NET_ZPERF_UDP_BATCH_MAX];
+static struct mmsghdr batch_msgs[CONFIG_NET_ZPERF_UDP_BATCH_MAX];
+#endif
+
 #if !defined(CONFIG_ZPERF_SESSION_PER_THREAD)
 static struct zperf_async_upload_context udp_async_upload_ctx;
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
@@ -146,6 +153,73 @@ static inline int zperf_upload_fin(int sock,
 	return 0;
 }
 
+static int udp_fill_packet(uint8_t *packet, uint32_t packet_size, uint32_t id,
+			   uint64_t usecs64, int port,
+			   const struct zperf_upload_params *param,
+			   uint64_t data_offset)
+{
+	size_t header_size =
+		sizeof(struct zperf_udp_datagram) + sizeof(struct zperf_client_hdr_v1);
+	struct zperf_udp_datagram *datagram;
+	struct zperf_client_hdr_v1 *hdr;
+	int ret;
+
+	/* Fill the packet header */
+	datagram = (struct zperf_udp_datagram *)packet;
+
+	datagram->id = htonl(id);
+	datagram->tv_sec = htonl(usecs64 / USEC_PER_SEC);
+	datagram->tv_usec = htonl(usecs64 % USEC_PER_SEC);
+
+	hdr = (struct zperf_client_hdr_v1 *)(packet + sizeof(*datagram));
+	hdr->flags = 0;
+	hdr->num_of_threads = htonl(1);
+	hdr->port = htonl(port);
+	hdr->buffer_len = sizeof(sample_packet) -
+		sizeof(*datagram) - sizeof(*hdr);
+	hdr->bandwidth = htonl(param->rate_kbps);
+	hdr->num_of_bytes = htonl(packet_size);
+
+	/* Load custom data payload if requested */
+	if (param->data_loader != NULL) {
+		ret = param->data_loader(param->data_loader_ctx, data_offset,
+			packet + header_size, packet_size - header_size);
+		if (ret < 0) {
+			NET_ERR("Failed to load data for offset %llu", data_offset);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+/* Send a batch of datagrams in a single call, returning how many were sent */
+static int udp_send_packets(int sock, uint8_t *packets, uint32_t packet_size,
+			    uint32_t batch, bool segment)
+{
+	int ret;
+
+#if CONFIG_NET_ZPERF_UDP_BATCH_MAX > 1
+	if (batch > 1 && !segment) {
+		for (uint32_t i = 0; i < batch; i++) {
+			batch_iov[i].iov_base = packets + i * packet_size;
+			batch_iov[i].iov_len = packet_size;
+			batch_msgs[i].msg_hdr = (struct msghdr) {
+				.msg_iov = &batch_iov[i],
+				.msg_iovlen = 1,
+			};
+		}
+
+		return zsock_sendmmsg(sock, batch_msgs, batch, 0);
+	}
+#endif
+
+	/* With UDP_SEGMENT, the stack splits the buffer in datagrams */
+	ret = zsock_send(sock, packets, packet_size * batch, 0);
+
+	return ret < 0 ? ret : DIV_ROUND_UP(ret, packet_size);
+}
+
 static int udp_upload(int sock, int port,
 		      const struct zperf_upload_params *param,
 		      struct zperf_results *results)
@@ -155,10 +229,13 @@ static int udp_upload(int sock, int port,
 	uint32_t duration_in_ms = param->duration_ms;
 	uint32_t packet_size = param->packet_size;
 	uint32_t rate_in_kbps = param->rate_kbps;
-	uint32_t packet_duration_us = zperf_packet_duration(packet_size, rate_in_kbps);
-	uint32_t packet_duration = k_us_to_ticks_ceil32(packet_duration_us);
-	uint32_t delay = packet_duration;
+	uint32_t batch = MAX(param->options.batch, 1U);
+	uint32_t packet_duration_us;
+	uint32_t packet_duration;
+	uint32_t delay;
+	uint8_t *packets = sample_packet;
 	uint64_t data_offset = 0U;
+	bool segment = false;
 	uint32_t nb_packets = 0U;
 	uint64_t usecs64;
 	int64_t start_time, end_time;
@@ -175,6 +252,27 @@ static int udp_upload(int sock, int port,
 		packet_size = header_size;
 	}
 
+#if CONFIG_NET_ZPERF_UDP_BATCH_MAX > 1
+	if (batch > 1) {
+		int segment_size = packet_size;
+
+		packets = batch_packets;
+		batch = MIN(batch, CONFIG_NET_ZPERF_UDP_BATCH_MAX);
+		(void)memset(batch_packets, 'z', sizeof(batch_packets));
+
+		/* Let the stack split the batch if it can, use sendmmsg otherwise */
+		segment = zsock_setsockopt(sock, IPPROTO_UDP, UDP_SEGMENT, &segment_size,
+					   sizeof(segment_size)) == 0;
+	}
+#else
+	batch = 1;
+#endif
+
+	/* A batch is sent every time the rate allows for its datagrams */
+	packet_duration_us = zperf_packet_duration(packet_size * batch, rate_in_kbps);
+	packet_duration = k_us_to_ticks_ceil32(packet_duration_us);
+	delay = packet_duration;
+
 	/* Start the loop */
 	start_time = k_uptime_ticks();
 	last_loop_time = start_time;
@@ -188,9 +286,6 @@ static int udp_upload(int sock, int port,
 	(void)memset(sample_packet, 'z', sizeof(sample_packet));
 
 	do {
-		struct zperf_udp_datagram *datagram;
-		struct zperf_client_hdr_v1 *hdr;
-		uint32_t secs, usecs;
 		int64_t loop_time;
 		int32_t adjust;
 
@@ -216,46 +311,27 @@ static int udp_upload(int sock, int port,
 		last_loop_time = loop_time;
 
 		usecs64 = param->unix_offset_us + k_ticks_to_us_floor64(loop_time - start_time);
-		secs = usecs64 / USEC_PER_SEC;
-		usecs = usecs64 % USEC_PER_SEC;
-
-		/* Fill the packet header */
-		datagram = (struct zperf_udp_datagram *)sample_packet;
-
-		datagram->id = htonl(nb_packets);
-		datagram->tv_sec = htonl(secs);
-		datagram->tv_usec = htonl(usecs);
 
-		hdr = (struct zperf_client_hdr_v1 *)(sample_packet +
-						     sizeof(*datagram));
-		hdr->flags = 0;
-		hdr->num_of_threads = htonl(1);
-		hdr->port = htonl(port);
-		hdr->buffer_len = sizeof(sample_packet) -
-			sizeof(*datagram) - sizeof(*hdr);
-		hdr->bandwidth = htonl(rate_in_kbps);
-		hdr->num_of_bytes = htonl(packet_size);
-
-		/* Load custom data payload if requested */
-		if (param->data_loader != NULL) {
-			ret = param->data_loader(param->data_loader_ctx, data_offset,
-				sample_packet + header_size, packet_size - header_size);
+		for (uint32_t i = 0; i < batch; i++) {
+			ret = udp_fill_packet(packets + i * packet_size, packet_size,
+					      nb_packets + i, usecs64, port, param,
+					      data_offset);
 			if (ret < 0) {
-				NET_ERR("Failed to load data for offset %llu", data_offset);
 				return ret;
 			}
+
+			data_offset += packet_size - header_size;
 		}
-		data_offset += packet_size - header_size;
 
-		/* Send the packet */
-		ret = zsock_send(sock, sample_packet, packet_size, 0);
+		/* Send the packets */
+		ret = udp_send_packets(sock, packets, packet_size, batch, segment);
 		if (ret < 0) {
 			NET_ERR("Failed to send the packet (%d)", errno);
 			return -errno;
-		} else {
-			nb_packets++;
 		}
 
+		nb_packets += ret;
+
 		if (IS_ENABLED(CONFIG_NET_ZPERF_LOG_LEVEL_DBG)) {
 			if (print_time >= loop_time) {
 				NET_DBG("nb_packets=%u\tdelay=%u\tadjust=%d",
@@ -0,0 +1,56 @@
+/*
+ *  Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ *  SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+
+#include "board_soc.h"
+
+/*
+ * On native_sim interrupts are handled on the host stack of the interrupted
+ * thread, so the frames of the interrupted code directly follow the frame of
+ * posix_irq_handler(), whose return address is where the code got interrupted.
+ *
+ * stack frame in memory:
+ * (addresses growth up)
+ *  ....
+ *  ra
+ *  fp (next) <- fp (curr)
+ *  ....
+ */
+size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size)
+{
+	void **fp = posix_irq_frame;
+	size_t idx = 0;
+
+	if (size < 1U || fp == NULL) {
+		return 0;
+	}
+
+	while (fp != NULL) {
+		if (idx >= size) {
+			return 0;
+		}
+
+		if (fp[1] == NULL) {
+			break;
+		}
+
+		buf[idx++] = (uintptr_t)fp[1];
+		void **new_fp = (void **)fp[0];
+
+		/*
+		 * anti-infinity-loop if
+		 * new_fp can't be smaller than fp, cause the stack is growing down
+		 * and trace moves deeper into the stack
+		 */
+		if (new_fp <= fp) {
+			break;
+		}
+		fp = new_fp;
+	}
+
+	return idx;
+}
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/profiling/sampler.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/spsc_pbuf.h>
+#include <zephyr/tracing/tracing_format.h>
+
+size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size);
+
+/* A sample is the interrupted thread followed by its call stack */
+#define SAMPLE_MAX_WORDS (1 + CONFIG_PROFILING_SAMPLER_STACK_DEPTH)
+
+/*
+ * Deepest call stack which can be unwound. The stack trace backends fail on
+ * deeper stacks, so they unwind into a buffer of this size, of which only the
+ * innermost CONFIG_PROFILING_SAMPLER_STACK_DEPTH frames are kept.
+ */
+#define UNWIND_MAX_WORDS 128
+
+BUILD_ASSERT(CONFIG_PROFILING_SAMPLER_STACK_DEPTH <= UNWIND_MAX_WORDS);
+
+/* Set in the thread word of samples whose call stack got truncated, threads
+ * being at least word aligned
+ */
+#define SAMPLE_TRUNCATED BIT(0)
+
+/*
+ * "sample", then a separator and up to two hex digits per byte for each word,
+ * and a " ..." marker for truncated samples
+ */
+#define LINE_MAX_LEN (sizeof("sample ...\n") + SAMPLE_MAX_WORDS * (1 + 2 * sizeof(uintptr_t)))
+
+static uint32_t sampler_mem[CONFIG_PROFILING_SAMPLER_BUFFER_SIZE / sizeof(uint32_t)];
+static struct spsc_pbuf *sampler_pb;
+static atomic_t sampler_dropped;
+static bool sampler_running;
+
+static void sampler_tick(struct k_timer *timer);
+static void sampler_flush_handler(struct k_work *work);
+
+static K_TIMER_DEFINE(sampler_timer, sampler_tick, NULL);
+static K_WORK_DELAYABLE_DEFINE(sampler_flush_work, sampler_flush_handler);
+static K_MUTEX_DEFINE(sampler_lock);
+
+/*
+ * Timer expiry functions run from the system timer interrupt, so the stack
+ * trace backend unwinds the code interrupted by it. The ISR is the only
+ * producer of the packet buffer, which needs no locking for that.
+ */
+static void sampler_tick(struct k_timer *timer)
+{
+	static uintptr_t sample[1 + UNWIND_MAX_WORDS];
+	size_t depth;
+
+	ARG_UNUSED(timer);
+
+	depth = arch_perf_current_stack_trace(sample + 1, UNWIND_MAX_WORDS);
+	if (depth == 0) {
+		atomic_inc(&sampler_dropped);
+		return;
+	}
+
+	sample[0] = (uintptr_t)k_current_get();
+
+	/* Keep the innermost frames, where the time is spent */
+	if (depth > CONFIG_PROFILING_SAMPLER_STACK_DEPTH) {
+		depth = CONFIG_PROFILING_SAMPLER_STACK_DEPTH;
+		sample[0] |= SAMPLE_TRUNCATED;
+	}
+
+	if (spsc_pbuf_write(sampler_pb, (const char *)sample,
+			    (1 + depth) * sizeof(uintptr_t)) < 0) {
+		atomic_inc(&sampler_dropped);
+	}
+}
+
+#if defined(CONFIG_THREAD_NAME) && defined(CONFIG_THREAD_MONITOR)
+static void sampler_write_thread(const struct k_thread *thread, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	tracing_format_string("thread %lx %s\n", (unsigned long)(uintptr_t)thread,
+			      k_thread_name_get((k_tid_t)thread));
+}
+#endif
+
+static void sampler_write_threads(void)
+{
+#if defined(CONFIG_THREAD_NAME) && defined(CONFIG_THREAD_MONITOR)
+	k_thread_foreach_unlocked(sampler_write_thread, NULL);
+#endif
+}
+
+static void sampler_write_sample(const char *data, uint16_t len)
+{
+	static uintptr_t sample[SAMPLE_MAX_WORDS];
+	static char line[LINE_MAX_LEN];
+	size_t words = MIN(len / sizeof(uintptr_t), SAMPLE_MAX_WORDS);
+	bool truncated;
+	int pos;
+
+	/* Packets are only guaranteed to be 32-bit aligned */
+	(void)memcpy(sample, data, words * sizeof(uintptr_t));
+
+	truncated = (sample[0] & SAMPLE_TRUNCATED) != 0U;
+	sample[0] &= ~SAMPLE_TRUNCATED;
+
+	pos = snprintk(line, sizeof(line), "sample");
+	for (size_t i = 0; i < words; i++) {
+		pos += snprintk(line + pos, sizeof(line) - pos, " %lx",
+				(unsigned long)sample[i]);
+	}
+	if (truncated) {
+		pos += snprintk(line + pos, sizeof(line) - pos, " ...");
+	}
+	line[pos++] = '\n';
+
+	tracing_format_raw_data((uint8_t *)line, pos);
+}
+
+void profiling_sampler_flush(void)
+{
+	atomic_val_t dropped;
+	bool first = true;
+	uint16_t len;
+	char *data;
+
+	k_mutex_lock(&sampler_lock, K_FOREVER);
+
+	while ((len = spsc_pbuf_claim(sampler_pb, &data)) > 0) {
+		/* Names of the threads, for the samples to come */
+		if (first) {
+			sampler_write_threads();
+			first = false;
+		}
+		sampler_write_sample(data, len);
+		spsc_pbuf_free(sampler_pb, len);
+	}
+
+	dropped = atomic_clear(&sampler_dropped);
+	if (dropped != 0) {
+		tracing_format_string("dropped %lu\n", (unsigned long)dropped);
+	}
+
+	k_mutex_unlock(&sampler_lock);
+}
+
+static void sampler_flush_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+
+	profiling_sampler_flush();
+
+	k_mutex_lock(&sampler_lock, K_FOREVER);
+	if (sampler_running) {
+		k_work_schedule(dwork, K_MSEC(CONFIG_PROFILING_SAMPLER_FLUSH_INTERVAL));
+	}
+	k_mutex_unlock(&sampler_lock);
+}
+
+int profiling_sampler_start(uint32_t frequency)
+{
+	k_timeout_t period;
+	int ret = 0;
+
+	if (frequency == 0U) {
+		return -EINVAL;
+	}
+
+	period = K_NSEC(NSEC_PER_SEC / frequency);
+
+	k_mutex_lock(&sampler_lock, K_FOREVER);
+
+	if (sampler_running) {
+		ret = -EALREADY;
+	} else {
+		sampler_running = true;
+		k_timer_start(&sampler_timer, period, period);
+		k_work_schedule(&sampler_flush_work,
+				K_MSEC(CONFIG_PROFILING_SAMPLER_FLUSH_INTERVAL));
+	}
+
+	k_mutex_unlock(&sampler_lock);
+
+	return ret;
+}
+
+int profiling_sampler_stop(void)
+{
+	k_mutex_lock(&sampler_lock, K_FOREVER);
+
+	if (!sampler_running) {
+		k_mutex_unlock(&sampler_lock);
+		return -EALREADY;
+	}
+
+	k_timer_stop(&sampler_timer);
+	sampler_running = false;
+	(void)k_work_cancel_delayable(&sampler_flush_work);
+
+	k_mutex_unlock(&sampler_lock);
+
+	profiling_sampler_flush();
+
+	return 0;
+}
+
+static int sampler_init(void)
+{
+	sampler_pb = spsc_pbuf_init(sampler_mem, sizeof(sampler_mem), 0);
+	if (sampler_pb == NULL) {
+		return -EINVAL;
+	}
+
+	if (IS_ENABLED(CONFIG_PROFILING_SAMPLER_AUTOSTART)) {
+		return profiling_sampler_start(CONFIG_PROFILING_SAMPLER_FREQUENCY);
+	}
+
+	return 0;
+}
+
+/* After the tracing backend is initialized */
+SYS_INIT(sampler_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
@@ -193,6 +193,9 @@
 	sys_trace_k_queue_get_blocking(queue, timeout)
 #define sys_port_trace_k_queue_get_exit(queue, timeout, ret)                                       \
 	sys_trace_k_queue_get_exit(queue, timeout, ret)
+#define sys_port_trace_k_queue_get_batch_enter(queue, timeout)
+#define sys_port_trace_k_queue_get_batch_blocking(queue, timeout)
+#define sys_port_trace_k_queue_get_batch_exit(queue, timeout, ret)
 #define sys_port_trace_k_queue_remove_enter(queue) sys_trace_k_queue_remove_enter(queue, data)
 #define sys_port_trace_k_queue_remove_exit(queue, ret)                                             \
 	sys_trace_k_queue_remove_exit(queue, data, ret)
@@ -239,6 +242,9 @@
 #define sys_port_trace_k_fifo_get_exit(fifo, timeout, ret)                                         \
 	sys_trace_k_fifo_get_exit(fifo, timeout, ret)
 
+#define sys_port_trace_k_fifo_get_batch_enter(fifo, timeout)
+#define sys_port_trace_k_fifo_get_batch_exit(fifo, timeout, ret)
+
 #define sys_port_trace_k_fifo_peek_head_enter(fifo) sys_trace_k_fifo_peek_head_enter(fifo)
 
 #define sys_port_trace_k_fifo_peek_head_exit(fifo, ret) sys_trace_k_fifo_peek_head_exit(fifo, ret)
@@ -267,6 +273,9 @@
 #define sys_port_trace_k_lifo_get_exit(lifo, timeout, ret)                                         \
 	sys_trace_k_lifo_get_exit(lifo, timeout, ret)
 
+#define sys_port_trace_k_lifo_get_batch_enter(lifo, timeout)
+#define sys_port_trace_k_lifo_get_batch_exit(lifo, timeout, ret)
+
 /* Stack */
 #define sys_port_trace_k_stack_init(stack) sys_trace_k_stack_init(stack, buffer, num_entries)
 
@@ -320,6 +329,14 @@
 	sys_trace_k_msgq_get_exit(msgq, data, timeout, ret)
 #define sys_port_trace_k_msgq_peek(msgq, ret) sys_trace_k_msgq_peek(msgq, data, ret)
 #define sys_port_trace_k_msgq_purge(msgq) sys_trace_k_msgq_purge(msgq)
+#define sys_port_trace_k_msgq_alloc_put_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_alloc_put_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_alloc_put_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_commit(msgq, ret)
+#define sys_port_trace_k_msgq_claim_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_claim_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_claim_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_finish(msgq, ret)
 
 #define sys_port_trace_k_mbox_init(mbox) sys_trace_k_mbox_init(mbox)
 #define sys_port_trace_k_mbox_message_put_enter(mbox, timeout)                                     \
@@ -359,6 +376,16 @@
 	sys_trace_k_pipe_read_blocking(pipe, timeout)
 #define sys_port_trace_k_pipe_read_exit(pipe, ret) \
 	sys_trace_k_pipe_read_exit(pipe, ret)
+#define sys_port_trace_k_pipe_writev_enter(pipe, iov, iovcnt, timeout)
+#define sys_port_trace_k_pipe_writev_exit(pipe, ret)
+#define sys_port_trace_k_pipe_readv_enter(pipe, iov, iovcnt, timeout)
+#define sys_port_trace_k_pipe_readv_exit(pipe, ret)
+#define sys_port_trace_k_pipe_write_claim_enter(pipe, len, timeout)
+#define sys_port_trace_k_pipe_write_claim_exit(pipe, ret)
+#define sys_port_trace_k_pipe_write_commit(pipe, len, ret)
+#define sys_port_trace_k_pipe_read_claim_enter(pipe, len, timeout)
+#define sys_port_trace_k_pipe_read_claim_exit(pipe, ret)
+#define sys_port_trace_k_pipe_read_finish(pipe, len, ret)
 
 #define sys_port_trace_k_pipe_cleanup_enter(pipe) sys_trace_k_pipe_cleanup_enter(pipe)
 #define sys_port_trace_k_pipe_cleanup_exit(pipe, ret) sys_trace_k_pipe_cleanup_exit(pipe, ret)
@@ -250,6 +250,9 @@ void sys_trace_gpio_fire_callback_user(const struct device *port, struct gpio_ca
 #define sys_port_trace_k_queue_get_enter(queue, timeout)
 #define sys_port_trace_k_queue_get_blocking(queue, timeout)
 #define sys_port_trace_k_queue_get_exit(queue, timeout, ret)
+#define sys_port_trace_k_queue_get_batch_enter(queue, timeout)
+#define sys_port_trace_k_queue_get_batch_blocking(queue, timeout)
+#define sys_port_trace_k_queue_get_batch_exit(queue, timeout, ret)
 #define sys_port_trace_k_queue_remove_enter(queue)
 #define sys_port_trace_k_queue_remove_exit(queue, ret)
 #define sys_port_trace_k_queue_unique_append_enter(queue)
@@ -271,6 +274,8 @@ void sys_trace_gpio_fire_callback_user(const struct device *port, struct gpio_ca
 #define sys_port_trace_k_fifo_put_slist_exit(fifo, list)
 #define sys_port_trace_k_fifo_get_enter(fifo, timeout)
 #define sys_port_trace_k_fifo_get_exit(fifo, timeout, ret)
+#define sys_port_trace_k_fifo_get_batch_enter(fifo, timeout)
+#define sys_port_trace_k_fifo_get_batch_exit(fifo, timeout, ret)
 #define sys_port_trace_k_fifo_peek_head_enter(fifo)
 #define sys_port_trace_k_fifo_peek_head_exit(fifo, ret)
 #define sys_port_trace_k_fifo_peek_tail_enter(fifo)
@@ -284,6 +289,8 @@ void sys_trace_gpio_fire_callback_user(const struct device *port, struct gpio_ca
 #define sys_port_trace_k_lifo_alloc_put_exit(lifo, data, ret)
 #define sys_port_trace_k_lifo_get_enter(lifo, timeout)
 #define sys_port_trace_k_lifo_get_exit(lifo, timeout, ret)
+#define sys_port_trace_k_lifo_get_batch_enter(lifo, timeout)
+#define sys_port_trace_k_lifo_get_batch_exit(lifo, timeout, ret)
 
 #define sys_port_trace_k_stack_init(stack)
 #define sys_port_trace_k_stack_alloc_init_enter(stack)
@@ -309,6 +316,14 @@ void sys_trace_gpio_fire_callback_user(const struct device *port, struct gpio_ca
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)
 #define sys_port_trace_k_msgq_peek(msgq, ret)
 #define sys_port_trace_k_msgq_purge(msgq)
+#define sys_port_trace_k_msgq_alloc_put_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_alloc_put_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_alloc_put_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_commit(msgq, ret)
+#define sys_port_trace_k_msgq_claim_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_claim_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_claim_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_finish(msgq, ret)
 
 #define sys_port_trace_k_mbox_init(mbox)
 #define sys_port_trace_k_mbox_message_put_enter(mbox, timeout)
@@ -334,6 +349,16 @@ void sys_trace_gpio_fire_callback_user(const struct device *port, struct gpio_ca
 #define sys_port_trace_k_pipe_read_enter(pipe, data, len, timeout)
 #define sys_port_trace_k_pipe_read_blocking(pipe, timeout)
 #define sys_port_trace_k_pipe_read_exit(pipe, ret)
+#define sys_port_trace_k_pipe_writev_enter(pipe, iov, iovcnt, timeout)
+#define sys_port_trace_k_pipe_writev_exit(pipe, ret)
+#define sys_port_trace_k_pipe_readv_enter(pipe, iov, iovcnt, timeout)
+#define sys_port_trace_k_pipe_readv_exit(pipe, ret)
+#define sys_port_trace_k_pipe_write_claim_enter(pipe, len, timeout)
+#define sys_port_trace_k_pipe_write_claim_exit(pipe, ret)
+#define sys_port_trace_k_pipe_write_commit(pipe, len, ret)
+#define sys_port_trace_k_pipe_read_claim_enter(pipe, len, timeout)
+#define sys_port_trace_k_pipe_read_claim_exit(pipe, ret)
+#define sys_port_trace_k_pipe_read_finish(pipe, len, ret)
 
 #define sys_port_trace_k_pipe_cleanup_enter(pipe)
 #define sys_port_trace_k_pipe_cleanup_exit(pipe, ret)
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __BENCHMARK_KERNEL_BENCH_H
+#define __BENCHMARK_KERNEL_BENCH_H
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+
+/* Worker threads run at BENCH_PRIO, the main thread below them */
+#define BENCH_PRIO       K_PRIO_PREEMPT(5)
+#ifdef CONFIG_BENCHMARK_POLL
+/* zvfs_poll() prepares an event per fd on the stack of the polling thread */
+#define BENCH_STACK_SIZE (4096 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#else
+#define BENCH_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#endif
+
+/**
+ * @brief A benchmark run by the harness
+ *
+ * For every thread count, the harness calls @a setup, starts that many
+ * threads running @a worker at BENCH_PRIO, and waits for them to exit.
+ * Each worker is told its index, the thread count, and how many times to
+ * measure the operation, and records a sample for every measurement.
+ */
+struct bench_case {
+	/** Short name identifying the benchmark in the results */
+	const char *name;
+	/** What each sample measures */
+	const char *desc;
+	/** Prepares the objects used by the workers, may be NULL */
+	void (*setup)(unsigned int nthreads);
+	/** Thread entry measuring the operation */
+	void (*worker)(unsigned int id, unsigned int nthreads, unsigned int iters);
+	/** Highest thread count to run with, 0 for no limit */
+	unsigned int max_threads;
+};
+
+/**
+ * @brief Record the duration of one operation
+ *
+ * Samples beyond CONFIG_BENCHMARK_NUM_SAMPLES are dropped.
+ */
+void bench_record(timing_t start, timing_t end);
+
+/**
+ * @brief Mark the start of a hand-off to another thread
+ *
+ * The thread taking over calls bench_handoff_end() to record the time
+ * elapsed since the last call of bench_handoff_begin() by any thread.
+ */
+void bench_handoff_begin(void);
+
+/** @brief Record the time elapsed since the last bench_handoff_begin() */
+void bench_handoff_end(void);
+
+extern const struct bench_case bench_ctx_switch;
+extern const struct bench_case bench_sem;
+extern const struct bench_case bench_mutex;
+extern const struct bench_case bench_mutex_hold;
+extern const struct bench_case bench_msgq;
+extern const struct bench_case bench_pipe;
+extern const struct bench_case bench_events;
+extern const struct bench_case bench_workq;
+extern const struct bench_case bench_timer_arm;
+extern const struct bench_case bench_timer_expire;
+extern const struct bench_case bench_heap;
+extern const struct bench_case bench_heap_small;
+extern const struct bench_case bench_heap_stress;
+extern const struct bench_case bench_net_conn_connected;
+extern const struct bench_case bench_net_conn_listening;
+extern const struct bench_case bench_poll;
+
+#endif
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measures the switch between threads of equal priority yielding to each
+ * other. With a single thread k_yield() returns without switching.
+ */
+
+#include "bench.h"
+
+static void worker(unsigned int id, unsigned int nthreads, unsigned int iters)
+{
+	ARG_UNUSED(id);
+	ARG_UNUSED(nthreads);
+
+	for (unsigned int i = 0; i < iters; i++) {
+		bench_handoff_begin();
+		k_yield();
+		bench_handoff_end();
+	}
+}
+
+const struct bench_case bench_ctx_switch = {
+	.name = "ctx_switch",
+	.desc = "k_yield() in one thread until the next one runs",
+	.worker = worker,
+};
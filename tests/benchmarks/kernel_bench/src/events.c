@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Passes a token around a ring of threads sharing one event object,
+ * each waiting for its own event and posting the event of the next one.
+ * All other threads wait on the same object.
+ */
+
+#include "bench.h"
+
+static struct k_event event;
+
+static void setup(unsigned int nthreads)
+{
+	ARG_UNUSED(nthreads);
+
+	k_event_init(&event);
+	k_event_post(&event, BIT(0));
+}
+
+static void worker(unsigned int id, unsigned int nthreads, unsigned int iters)
+{
+	for (unsigned int i = 0; i < iters; i++) {
+		k_event_wait(&event, BIT(id), false, K_FOREVER);
+		bench_handoff_end();
+
+		k_event_clear(&event, BIT(id));
+
+		bench_handoff_begin();
+		k_event_post(&event, BIT((id + 1) % nthreads));
+	}
+}
+
+const struct bench_case bench_events = {
+	.name = "events",
+	.desc = "k_event_post() in one thread until k_event_wait() returns in the next",
+	.setup = setup,
+	.worker = worker,
+};
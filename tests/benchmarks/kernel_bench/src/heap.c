@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Threads allocate blocks of varying sizes from a shared heap, each
+ * keeping a few of them allocated so that the heap is fragmented. They
+ * yield to each other after every allocation.
+ */
+
+#include "bench.h"
+
+#define BLOCKS_PER_THREAD 4
+#define MIN_BLOCK_SIZE    16
+#define MAX_BLOCK_SIZE    256
+
+K_HEAP_DEFINE(bench_frag_heap, CONFIG_BENCHMARK_MAX_THREADS * BLOCKS_PER_THREAD *
+			       (MAX_BLOCK_SIZE + 32) + 1024);
+
+static void worker(unsigned int id, unsigned int nthreads, unsigned int iters)
+{
+	void *blocks[BLOCKS_PER_THREAD] = { NULL };
+	uint32_t seed = id + 1U;
+	timing_t start;
+	timing_t end;
+	size_t size;
+	void *block;
+
+	ARG_UNUSED(nthreads);
+
+	for (unsigned int i = 0; i < iters; i++) {
+		/* Linear congruential generator, good enough for block sizes */
+		seed = seed * 1103515245U + 12345U;
+		size = MIN_BLOCK_SIZE + (seed >> 16) % (MAX_BLOCK_SIZE - MIN_BLOCK_SIZE);
+
+		if (blocks[i % BLOCKS_PER_THREAD] != NULL) {
+			k_heap_free(&bench_frag_heap, blocks[i % BLOCKS_PER_THREAD]);
+		}
+
+		start = timing_counter_get();
+		block = k_heap_alloc(&bench_frag_heap, size, K_NO_WAIT);
+		end = timing_counter_get();
+
+		if (block != NULL) {
+			bench_record(start, end);
+		}
+		blocks[i % BLOCKS_PER_THREAD] = block;
+
+		k_yield();
+	}
+
+	for (unsigned int i = 0; i < BLOCKS_PER_THREAD; i++) {
+		if (blocks[i] != NULL) {
+			k_heap_free(&bench_frag_heap, blocks[i]);
+		}
+	}
+}
+
+const struct bench_case bench_heap = {
+	.name = "heap",
+	.desc = "k_heap_alloc() of 16 to 256 bytes from a fragmented heap",
+	.worker = worker,
+};
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Threads allocate and free small blocks from a shared heap as fast as
+ * they can, each keeping a few of them allocated, so that on SMP every
+ * CPU works on the heap at the same time.
+ */
+
+#include "bench.h"
+
+#define LIVE_BLOCKS    16
+#define MAX_BLOCK_SIZE 128
+
+K_HEAP_DEFINE(bench_small_heap, CONFIG_BENCHMARK_MAX_THREADS * LIVE_BLOCKS *
+				(MAX_BLOCK_SIZE + 32) + 4096);
+
+static void worker(unsigned int id, unsigned int nthreads, unsigned int iters)
+{
+	void *live[LIVE_BLOCKS] = { NULL };
+	uint32_t seed = id + 1U;
+	unsigned int slot;
+	timing_t start;
+	timing_t end;
+	size_t size;
+
+	ARG_UNUSED(nthreads);
+
+	for (unsigned int i = 0; i < iters; i++) {
+		seed = seed * 1103515245U + 12345U;
+		size = 1U + (seed >> 16) % MAX_BLOCK_SIZE;
+		slot = i % LIVE_BLOCKS;
+
+		start = timing_counter_get();
+		k_heap_free(&bench_small_heap, live[slot]);
+		live[slot] = k_heap_alloc(&bench_small_heap, size, K_NO_WAIT);
+		end = timing_counter_get();
+
+		if (live[slot] != NULL) {
+			bench_record(start, end);
+		}
+	}
+
+	for (slot = 0; slot < LIVE_BLOCKS; slot++) {
+		k_heap_free(&bench_small_heap, live[slot]);
+	}
+}
+
+const struct bench_case bench_heap_small = {
+	.name = "heap_small",
+	.desc = "k_heap_free() then k_heap_alloc() of 1 to 128 bytes, without yielding",
+	.worker = worker,
+};
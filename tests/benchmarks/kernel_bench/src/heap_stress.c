@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Runs the sys_heap_stress() workload on a k_heap: blocks of power law
+ * distributed sizes are allocated and freed at random, keeping the heap
+ * about half full. Every successful allocation and every free is
+ * measured.
+ */
+
+#include <zephyr/sys/sys_heap.h>
+
+#include "bench.h"
+
+#define STRESS_HEAP_SIZE 65536
+#define STRESS_BLOCKS    256
+
+K_HEAP_DEFINE(bench_stress_heap, STRESS_HEAP_SIZE);
+
+/* Same layout as the records sys_heap_stress() keeps of live blocks */
+struct stress_block {
+	void *ptr;
+	size_t sz;
+};
+
+static struct stress_block scratch[STRESS_BLOCKS];
+
+static void *stress_alloc(void *arg, size_t bytes)
+{
+	timing_t start;
+	timing_t end;
+	void *block;
+
+	start = timing_counter_get();
+	block = k_heap_alloc(arg, bytes, K_NO_WAIT);
+	end = timing_counter_get();
+
+	if (block != NULL) {
+		bench_record(start, end);
+	}
+
+	return block;
+}
+
+static void stress_free(void *arg, void *p)
+{
+	timing_t start;
+	timing_t end;
+
+	start = timing_counter_get();
+	k_heap_free(arg, p);
+	end = timing_counter_get();
+
+	bench_record(start, end);
+}
+
+static void worker(unsigned int id, unsigned int nthreads, unsigned int iters)
+{
+	struct z_heap_stress_result result;
+	uint32_t live;
+
+	ARG_UNUSED(id);
+	ARG_UNUSED(nthreads);
+
+	sys_heap_stress(stress_alloc, stress_free, &bench_stress_heap,
+			STRESS_HEAP_SIZE, iters, scratch, sizeof(scratch), 50,
+			&result);
+
+	/* Return the blocks it left allocated, which are the first ones
+	 * of the scratch area.
+	 */
+	live = result.successful_allocs - result.total_frees;
+	for (uint32_t i = 0; i < live; i++) {
+		k_heap_free(&bench_stress_heap, scratch[i].ptr);
+	}
+}
+
+const struct bench_case bench_heap_stress = {
+	.name = "heap_stress",
+	.desc = "k_heap_alloc() or k_heap_free() of the sys_heap_stress() workload",
+	.worker = worker,
+	/* sys_heap_stress() keeps its random state in a global */
+	.max_threads = 1,
+};
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Runs a set of kernel benchmarks at several thread counts and prints
+ * the distribution of the measured times in a machine readable format.
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#include "bench.h"
+
+#define MAIN_PRIO K_PRIO_PREEMPT(10)
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, CONFIG_BENCHMARK_MAX_THREADS,
+				   BENCH_STACK_SIZE);
+static struct k_thread threads[CONFIG_BENCHMARK_MAX_THREADS];
+
+static uint32_t samples[CONFIG_BENCHMARK_NUM_SAMPLES];
+static atomic_t num_samples;
+
+static timing_t handoff_start;
+static bool handoff_valid;
+
+struct bench_stats {
+	uint32_t count;
+	uint32_t min;
+	uint32_t mean;
+	uint32_t p50;
+	uint32_t p90;
+	uint32_t p99;
+	uint32_t max;
+};
+
+static const struct bench_case *const cases[] = {
+	&bench_ctx_switch,
+	&bench_sem,
+	&bench_mutex,
+	&bench_mutex_hold,
+	&bench_msgq,
+	&bench_pipe,
+	&bench_events,
+	&bench_workq,
+	&bench_timer_arm,
+	&bench_timer_expire,
+	&bench_heap,
+	&bench_heap_small,
+#ifdef CONFIG_BENCHMARK_HEAP_STRESS
+	&bench_heap_stress,
+#endif
+#ifdef CONFIG_BENCHMARK_NET_CONN
+	&bench_net_conn_connected,
+	&bench_net_conn_listening,
+#endif
+#ifdef CONFIG_BENCHMARK_POLL
+	&bench_poll,
+#endif
+};
+
+static bool first_result = true;
+
+void bench_record(timing_t start, timing_t end)
+{
+	atomic_val_t idx = atomic_inc(&num_samples);
+
+	if (idx < ARRAY_SIZE(samples)) {
+		samples[idx] = (uint32_t)timing_cycles_get(&start, &end);
+	}
+}
+
+void bench_handoff_begin(void)
+{
+	handoff_start = timing_counter_get();
+	handoff_valid = true;
+}
+
+void bench_handoff_end(void)
+{
+	timing_t end = timing_counter_get();
+
+	if (handoff_valid) {
+		bench_record(handoff_start, end);
+	}
+}
+
+static void worker_entry(void *p1, void *p2, void *p3)
+{
+	const struct bench_case *bc = p1;
+	unsigned int id = POINTER_TO_UINT(p2);
+	unsigned int nthreads = POINTER_TO_UINT(p3);
+
+	bc->worker(id, nthreads, CONFIG_BENCHMARK_NUM_SAMPLES / nthreads);
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+static uint32_t to_ns(uint64_t cycles)
+{
+	return (uint32_t)timing_cycles_to_ns(cycles);
+}
+
+static void compute_stats(struct bench_stats *stats)
+{
+	uint32_t count = MIN((uint32_t)atomic_get(&num_samples),
+			     (uint32_t)ARRAY_SIZE(samples));
+	uint64_t sum = 0;
+
+	*stats = (struct bench_stats){ .count = count };
+	if (count == 0U) {
+		return;
+	}
+
+	qsort(samples, count, sizeof(samples[0]), cmp_u32);
+
+	for (uint32_t i = 0; i < count; i++) {
+		sum += samples[i];
+	}
+
+	stats->min = to_ns(samples[0]);
+	stats->mean = to_ns(sum / count);
+	stats->p50 = to_ns(samples[(count - 1U) * 50U / 100U]);
+	stats->p90 = to_ns(samples[(count - 1U) * 90U / 100U]);
+	stats->p99 = to_ns(samples[(count - 1U) * 99U / 100U]);
+	stats->max = to_ns(samples[count - 1U]);
+}
+
+static void print_header(void)
+{
+	printk("Kernel benchmarks, all times in ns\n");
+
+	for (size_t i = 0; i < ARRAY_SIZE(cases); i++) {
+		printk("# %-13s %s\n", cases[i]->name, cases[i]->desc);
+	}
+
+#ifdef CONFIG_BENCHMARK_OUTPUT_JSON
+	printk("[\n");
+#else
+	printk("benchmark,threads,samples,min_ns,mean_ns,p50_ns,p90_ns,p99_ns,max_ns\n");
+#endif
+}
+
+static void print_footer(void)
+{
+#ifdef CONFIG_BENCHMARK_OUTPUT_JSON
+	printk("\n]\n");
+#endif
+}
+
+static void print_result(const struct bench_case *bc, unsigned int nthreads,
+			 const struct bench_stats *s)
+{
+#ifdef CONFIG_BENCHMARK_OUTPUT_JSON
+	printk("%s  {\"benchmark\": \"%s\", \"threads\": %u, \"samples\": %u, "
+	       "\"min_ns\": %u, \"mean_ns\": %u, \"p50_ns\": %u, \"p90_ns\": %u, "
+	       "\"p99_ns\": %u, \"max_ns\": %u}",
+	       first_result ? "" : ",\n", bc->name, nthreads, s->count,
+	       s->min, s->mean, s->p50, s->p90, s->p99, s->max);
+#else
+	printk("%s,%u,%u,%u,%u,%u,%u,%u,%u\n", bc->name, nthreads, s->count,
+	       s->min, s->mean, s->p50, s->p90, s->p99, s->max);
+#endif
+	first_result = false;
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s,%u,%u,%u,%u,%u,%u,%u,%u\n", bc->name, nthreads, s->count,
+	       s->min, s->mean, s->p50, s->p90, s->p99, s->max);
+#endif
+}
+
+static void run(const struct bench_case *bc, unsigned int nthreads)
+{
+	struct bench_stats stats;
+
+	atomic_clear(&num_samples);
+	handoff_valid = false;
+
+	if (bc->setup != NULL) {
+		bc->setup(nthreads);
+	}
+
+	for (unsigned int i = 0; i < nthreads; i++) {
+		k_thread_create(&threads[i], stacks[i], BENCH_STACK_SIZE,
+				worker_entry, (void *)bc, UINT_TO_POINTER(i),
+				UINT_TO_POINTER(nthreads), BENCH_PRIO, 0, K_FOREVER);
+	}
+
+	/* Let all workers start together */
+	k_sched_lock();
+	for (unsigned int i = 0; i < nthreads; i++) {
+		k_thread_start(&threads[i]);
+	}
+	k_sched_unlock();
+
+	for (unsigned int i = 0; i < nthreads; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	compute_stats(&stats);
+	print_result(bc, nthreads, &stats);
+}
+
+int main(void)
+{
+	timing_init();
+	timing_start();
+
+	k_thread_priority_set(k_current_get(), MAIN_PRIO);
+
+	print_header();
+
+	for (size_t i = 0; i < ARRAY_SIZE(cases); i++) {
+		for (unsigned int n = 1; n <= CONFIG_BENCHMARK_MAX_THREADS; n *= 2) {
+			if ((cases[i]->max_threads != 0U) && (n > cases[i]->max_threads)) {
+				break;
+			}
+			run(cases[i], n);
+		}
+	}
+
+	print_footer();
+
+	timing_stop();
+
+	TC_END_REPORT(TC_PASS);
+
+	return 0;
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Passes a message around a ring of threads, each reading from its own
+ * message queue and writing to the queue of the next one. The message
+ * carries the time it was sent.
+ */
+
+#include "bench.h"
+
+static struct k_msgq msgqs[CONFIG_BENCHMARK_MAX_THREADS];
+static char __aligned(sizeof(timing_t))
+	msgq_bufs[CONFIG_BENCHMARK_MAX_THREADS][sizeof(timing_t)];
+
+static void setup(unsigned int nthreads)
+{
+	timing_t start = timing_counter_get();
+
+	for (unsigned int i = 0; i < nthreads; i++) {
+		k_msgq_init(&msgqs[i], msgq_bufs[i], sizeof(timing_t), 1);
+	}
+
+	k_msgq_put(&msgqs[0], &start, K_NO_WAIT);
+}
+
+static void worker(unsigned int id, unsigned int nthreads, unsigned int iters)
+{
+	timing_t start;
+
+	for (unsigned int i = 0; i < iters; i++) {
+		k_msgq_get(&msgqs[id], &start, K_FOREVER);
+		if ((i != 0U) || (id != 0U)) {
+			bench_record(start, timing_counter_get());
+		}
+
+		start = timing_counter_get();
+		k_msgq_put(&msgqs[(id + 1) % nthreads], &start, K_FOREVER);
+	}
+}
+
+const struct bench_case bench_msgq = {
+	.name = "msgq",
+	.desc = "k_msgq_put() in one thread until k_msgq_get() returns in the next",
+	.setup = setup,
+	.worker = worker,
+};
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Threads take turns holding a mutex. Each yields while holding it, so
+ * that the others queue up on it.
+ */
+
+#include "bench.h"
+
+static struct k_mutex mutex;
+
+static void setup(unsigned int nthreads)
+{
+	ARG_UNUSED(nthreads);
+
+	k_mutex_init(&mutex);
+}
+
+static void worker(unsigned int id, unsigned int nthreads, unsigned int iters)
+{
+	ARG_UNUSED(id);
+	ARG_UNUSED(nthreads);
+
+	for (unsigned int i = 0; i < iters; i++) {
+		k_mutex_lock(&mutex, K_FOREVER);
+		bench_handoff_end();
+
+		k_yield();
+
+		bench_handoff_begin();
+		k_mutex_unlock(&mutex);
+	}
+}
+
+const struct bench_case bench_mutex = {
+	.name = "mutex",
+	.desc = "k_mutex_unlock() until the next k_mutex_lock() returns",
+	.setup = setup,
+	.worker = worker,
+};
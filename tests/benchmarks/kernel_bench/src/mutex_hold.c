@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Threads contend for a mutex which each holds for a short busy wait, so
+ * that on SMP the owner keeps running while the others try to lock it.
+ */
+
+#include "bench.h"
+
+static struct k_mutex mutex;
+
+static void setup(unsigned int nthreads)
+{
+	ARG_UNUSED(nthreads);
+
+	k_mutex_init(&mutex);
+}
+
+static void worker(unsigned int id, unsigned int nthreads, unsigned int iters)
+{
+	timing_t start;
+	timing_t end;
+
+	ARG_UNUSED(id);
+	ARG_UNUSED(nthreads);
+
+	for (unsigned int i = 0; i < iters; i++) {
+		start = timing_counter_get();
+		k_mutex_lock(&mutex, K_FOREVER);
+		end = timing_counter_get();
+
+		k_busy_wait(CONFIG_BENCHMARK_MUTEX_HOLD_US);
+		k_mutex_unlock(&mutex);
+
+		bench_record(start, end);
+
+		/* Give the other threads a chance to get the mutex */
+		k_busy_wait(1);
+	}
+}
+
+const struct bench_case bench_mutex_hold = {
+	.name = "mutex_hold",
+	.desc = "k_mutex_lock() of a mutex held for a busy wait",
+	.setup = setup,
+	.worker = worker,
+};
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Looks up the connection handler of a received UDP packet with
+ * net_conn_input(), among CONFIG_BENCHMARK_NET_CONNS registered handlers.
+ * The handlers leave the packet to the workers, which all reuse the same one,
+ * so that only the lookup is measured.
+ */
+
+#include <string.h>
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "connection.h"
+#include "bench.h"
+
+#define LOCAL_PORT       4242
+#define LISTEN_PORT      4243
+#define REMOTE_PORT_BASE 10000
+
+static struct net_conn_handle *handles[CONFIG_BENCHMARK_NET_CONNS];
+static bool registered;
+static struct net_pkt *pkt;
+
+static struct sockaddr_in local_addr = {
+	.sin_family = AF_INET,
+	.sin_addr = {{{192, 0, 2, 1}}},
+};
+
+static struct sockaddr_in remote_addr = {
+	.sin_family = AF_INET,
+	.sin_addr = {{{198, 51, 100, 1}}},
+};
+
+static struct net_ipv4_hdr ipv4_hdr;
+static struct net_udp_hdr connected_hdr;
+static struct net_udp_hdr listening_hdr;
+
+static void bench_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = {0x00, 0x00, 0x5e, 0x00, 0x53, 0x01};
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_ETHERNET);
+}
+
+static int bench_send(const struct device *dev, struct net_pkt *tx_pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(tx_pkt);
+
+	return 0;
+}
+
+static struct dummy_api bench_if_api = {
+	.iface_api.init = bench_iface_init,
+	.send = bench_send,
+};
+
+NET_DEVICE_INIT(net_conn_bench, "net_conn_bench", NULL, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &bench_if_api, DUMMY_L2,
+		NET_L2_GET_CTX_TYPE(DUMMY_L2), 127);
+
+static enum net_verdict bench_cb(struct net_conn *conn, struct net_pkt *rx_pkt,
+				 union net_ip_header *ip_hdr,
+				 union net_proto_header *proto_hdr,
+				 void *user_data)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(rx_pkt);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto_hdr);
+	ARG_UNUSED(user_data);
+
+	/* Leave the packet to the benchmark, which reuses it */
+	return NET_OK;
+}
+
+/*
+ * Register a listening handler, then connected ones which all share its
+ * local address, so that the listener is the least recently registered one.
+ * Both benchmarks use the same handlers, which are never unregistered.
+ */
+static void setup(unsigned int nthreads)
+{
+	int ret;
+
+	ARG_UNUSED(nthreads);
+
+	if (registered) {
+		return;
+	}
+
+	ret = net_conn_register(IPPROTO_UDP, SOCK_DGRAM, AF_INET, NULL,
+				(struct sockaddr *)&local_addr, 0, LISTEN_PORT,
+				NULL, bench_cb, NULL, &handles[0]);
+
+	for (unsigned int i = 1; (i < CONFIG_BENCHMARK_NET_CONNS) && (ret == 0); i++) {
+		ret = net_conn_register(IPPROTO_UDP, SOCK_DGRAM, AF_INET,
+					(struct sockaddr *)&remote_addr,
+					(struct sockaddr *)&local_addr,
+					REMOTE_PORT_BASE + i, LOCAL_PORT,
+					NULL, bench_cb, NULL, &handles[i]);
+	}
+
+	if (ret < 0) {
+		printk("Cannot register %u connection handlers (%d)\n",
+		       CONFIG_BENCHMARK_NET_CONNS, ret);
+		k_oops();
+	}
+
+	pkt = net_pkt_rx_alloc_on_iface(net_if_get_default(), K_FOREVER);
+	net_pkt_set_family(pkt, AF_INET);
+
+	ipv4_hdr.proto = IPPROTO_UDP;
+	memcpy(ipv4_hdr.src, &remote_addr.sin_addr, sizeof(ipv4_hdr.src));
+	memcpy(ipv4_hdr.dst, &local_addr.sin_addr, sizeof(ipv4_hdr.dst));
+
+	connected_hdr.src_port = htons(REMOTE_PORT_BASE + 1);
+	connected_hdr.dst_port = htons(LOCAL_PORT);
+	listening_hdr.src_port = htons(REMOTE_PORT_BASE);
+	listening_hdr.dst_port = htons(LISTEN_PORT);
+
+	registered = true;
+}
+
+static void lookup(struct net_udp_hdr *udp_hdr, unsigned int iters)
+{
+	union net_ip_header ip_hdr = {.ipv4 = &ipv4_hdr};
+	union net_proto_header proto_hdr = {.udp = udp_hdr};
+
+	for (unsigned int i = 0; i < iters; i++) {
+		timing_t start = timing_counter_get();
+
+		(void)net_conn_input(pkt, &ip_hdr, IPPROTO_UDP, &proto_hdr);
+		bench_record(start, timing_counter_get());
+	}
+}
+
+static void connected_worker(unsigned int id, unsigned int nthreads, unsigned int iters)
+{
+	ARG_UNUSED(id);
+	ARG_UNUSED(nthreads);
+
+	lookup(&connected_hdr, iters);
+}
+
+static void listening_worker(unsigned int id, unsigned int nthreads, unsigned int iters)
+{
+	ARG_UNUSED(id);
+	ARG_UNUSED(nthreads);
+
+	lookup(&listening_hdr, iters);
+}
+
+const struct bench_case bench_net_conn_connected = {
+	.name = "net_conn",
+	.desc = "net_conn_input() finding a connected UDP handler",
+	.setup = setup,
+	.worker = connected_worker,
+};
+
+const struct bench_case bench_net_conn_listening = {
+	.name = "net_listen",
+	.desc = "net_conn_input() finding a listening UDP handler",
+	.setup = setup,
+	.worker = listening_worker,
+};
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Passes a message around a ring of threads, each reading from its own
+ * pipe and writing to the pipe of the next one. The message carries the
+ * time it was sent.
+ */
+
+#include "bench.h"
+
+static struct k_pipe pipes[CONFIG_BENCHMARK_MAX_THREADS];
+static uint8_t pipe_bufs[CONFIG_BENCHMARK_MAX_THREADS][2 * sizeof(timing_t)];
+
+static void setup(unsigned int nthreads)
+{
+	timing_t start = timing_counter_get();
+
+	for (unsigned int i = 0; i < nthreads; i++) {
+		k_pipe_init(&pipes[i], pipe_bufs[i], sizeof(pipe_bufs[i]));
+	}
+
+	k_pipe_write(&pipes[0], (uint8_t *)&start, sizeof(start), K_NO_WAIT);
+}
+
+static void worker(unsigned int id, unsigned int nthreads, unsigned int iters)
+{
+	timing_t start;
+
+	for (unsigned int i = 0; i < iters; i++) {
+		k_pipe_read(&pipes[id], (uint8_t *)&start, sizeof(start), K_FOREVER);
+		if ((i != 0U) || (id != 0U)) {
+			bench_record(start, timing_counter_get());
+		}
+
+		start = timing_counter_get();
+		k_pipe_write(&pipes[(id + 1) % nthreads], (uint8_t *)&start,
+			     sizeof(start), K_FOREVER);
+	}
+}
+
+const struct bench_case bench_pipe = {
+	.name = "pipe",
+	.desc = "k_pipe_write() in one thread until k_pipe_read() returns in the next",
+	.setup = setup,
+	.worker = worker,
+};
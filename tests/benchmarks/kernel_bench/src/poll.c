@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Passes a token around a ring of threads, each waiting in zvfs_poll() on
+ * its own eventfd among CONFIG_BENCHMARK_POLL_FDS - 1 idle ones, and
+ * writing to the eventfd of the next one.
+ */
+
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/zvfs/eventfd.h>
+
+#include "bench.h"
+
+#define IDLE_FDS (CONFIG_BENCHMARK_POLL_FDS - 1)
+
+static int ring_fds[CONFIG_BENCHMARK_MAX_THREADS];
+static int idle_fds[IDLE_FDS];
+static bool opened;
+
+static void setup(unsigned int nthreads)
+{
+	zvfs_eventfd_t value;
+
+	if (!opened) {
+		for (unsigned int i = 0; i < ARRAY_SIZE(ring_fds); i++) {
+			ring_fds[i] = zvfs_eventfd(0, ZVFS_EFD_NONBLOCK);
+			__ASSERT_NO_MSG(ring_fds[i] >= 0);
+		}
+		for (unsigned int i = 0; i < ARRAY_SIZE(idle_fds); i++) {
+			idle_fds[i] = zvfs_eventfd(0, ZVFS_EFD_NONBLOCK);
+			__ASSERT_NO_MSG(idle_fds[i] >= 0);
+		}
+		opened = true;
+	}
+
+	/* The last thread of the previous run passed the token on */
+	for (unsigned int i = 0; i < ARRAY_SIZE(ring_fds); i++) {
+		(void)zvfs_eventfd_read(ring_fds[i], &value);
+	}
+
+	(void)zvfs_eventfd_write(ring_fds[0], 1);
+}
+
+static void worker(unsigned int id, unsigned int nthreads, unsigned int iters)
+{
+	struct zvfs_pollfd fds[CONFIG_BENCHMARK_POLL_FDS];
+	zvfs_eventfd_t value;
+
+	fds[0].fd = ring_fds[id];
+	fds[0].events = ZVFS_POLLIN;
+	for (unsigned int i = 0; i < IDLE_FDS; i++) {
+		fds[i + 1].fd = idle_fds[i];
+		fds[i + 1].events = ZVFS_POLLIN;
+	}
+
+	for (unsigned int i = 0; i < iters; i++) {
+		(void)zvfs_poll(fds, ARRAY_SIZE(fds), -1);
+		bench_handoff_end();
+
+		(void)zvfs_eventfd_read(ring_fds[id], &value);
+
+		bench_handoff_begin();
+		(void)zvfs_eventfd_write(ring_fds[(id + 1) % nthreads], 1);
+	}
+}
+
+const struct bench_case bench_poll = {
+	.name = "poll",
+	.desc = "eventfd write in one thread until zvfs_poll() returns in the next",
+	.setup = setup,
+	.worker = worker,
+};
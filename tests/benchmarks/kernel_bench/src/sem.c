@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Passes a token around a ring of threads, each waiting on its own
+ * semaphore and giving the semaphore of the next one.
+ */
+
+#include "bench.h"
+
+static struct k_sem sems[CONFIG_BENCHMARK_MAX_THREADS];
+
+static void setup(unsigned int nthreads)
+{
+	for (unsigned int i = 0; i < nthreads; i++) {
+		k_sem_init(&sems[i], 0, 1);
+	}
+
+	k_sem_give(&sems[0]);
+}
+
+static void worker(unsigned int id, unsigned int nthreads, unsigned int iters)
+{
+	for (unsigned int i = 0; i < iters; i++) {
+		k_sem_take(&sems[id], K_FOREVER);
+		bench_handoff_end();
+
+		bench_handoff_begin();
+		k_sem_give(&sems[(id + 1) % nthreads]);
+	}
+}
+
+const struct bench_case bench_sem = {
+	.name = "sem",
+	.desc = "k_sem_give() in one thread until k_sem_take() returns in the next",
+	.setup = setup,
+	.worker = worker,
+};
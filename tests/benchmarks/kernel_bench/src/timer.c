@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Each thread repeatedly arms its own timer to expire after one tick
+ * and waits for it, so that up to one timer per thread is pending.
+ */
+
+#include "bench.h"
+
+struct bench_timer {
+	struct k_timer timer;
+	timing_t expired;
+};
+
+static struct bench_timer timers[CONFIG_BENCHMARK_MAX_THREADS];
+
+static void expiry(struct k_timer *timer)
+{
+	struct bench_timer *bt = CONTAINER_OF(timer, struct bench_timer, timer);
+
+	bt->expired = timing_counter_get();
+}
+
+static void setup(unsigned int nthreads)
+{
+	for (unsigned int i = 0; i < nthreads; i++) {
+		k_timer_init(&timers[i].timer, expiry, NULL);
+	}
+}
+
+static void run_timer(unsigned int id, unsigned int iters, bool measure_arm)
+{
+	struct bench_timer *bt = &timers[id];
+	timing_t start;
+	timing_t end;
+
+	for (unsigned int i = 0; i < iters; i++) {
+		start = timing_counter_get();
+		k_timer_start(&bt->timer, K_TICKS(1), K_NO_WAIT);
+		end = timing_counter_get();
+
+		k_timer_status_sync(&bt->timer);
+
+		if (measure_arm) {
+			bench_record(start, end);
+		} else {
+			bench_record(bt->expired, timing_counter_get());
+		}
+	}
+}
+
+static void arm_worker(unsigned int id, unsigned int nthreads, unsigned int iters)
+{
+	ARG_UNUSED(nthreads);
+
+	run_timer(id, iters, true);
+}
+
+static void expire_worker(unsigned int id, unsigned int nthreads, unsigned int iters)
+{
+	ARG_UNUSED(nthreads);
+
+	run_timer(id, iters, false);
+}
+
+const struct bench_case bench_timer_arm = {
+	.name = "timer_arm",
+	.desc = "k_timer_start() of a one tick timer",
+	.setup = setup,
+	.worker = arm_worker,
+};
+
+const struct bench_case bench_timer_expire = {
+	.name = "timer_expire",
+	.desc = "Timer expiry function until k_timer_status_sync() returns",
+	.setup = setup,
+	.worker = expire_worker,
+};
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Threads submit work items to a shared work queue running at their
+ * priority, and wait for each item to be handled before submitting it
+ * again. The more threads, the longer the queue gets.
+ */
+
+#include "bench.h"
+
+struct bench_work {
+	struct k_work work;
+	struct k_sem done;
+	timing_t submitted;
+};
+
+static K_THREAD_STACK_DEFINE(workq_stack, BENCH_STACK_SIZE);
+static struct k_work_q workq;
+static struct bench_work works[CONFIG_BENCHMARK_MAX_THREADS];
+
+static void handler(struct k_work *work)
+{
+	struct bench_work *bw = CONTAINER_OF(work, struct bench_work, work);
+
+	bench_record(bw->submitted, timing_counter_get());
+	k_sem_give(&bw->done);
+}
+
+static void setup(unsigned int nthreads)
+{
+	static bool started;
+
+	if (!started) {
+		k_work_queue_start(&workq, workq_stack,
+				   K_THREAD_STACK_SIZEOF(workq_stack), BENCH_PRIO,
+				   NULL);
+		started = true;
+	}
+
+	for (unsigned int i = 0; i < nthreads; i++) {
+		k_work_init(&works[i].work, handler);
+		k_sem_init(&works[i].done, 0, 1);
+	}
+}
+
+static void worker(unsigned int id, unsigned int nthreads, unsigned int iters)
+{
+	struct bench_work *bw = &works[id];
+
+	ARG_UNUSED(nthreads);
+
+	for (unsigned int i = 0; i < iters; i++) {
+		bw->submitted = timing_counter_get();
+		k_work_submit_to_queue(&workq, &bw->work);
+		k_sem_take(&bw->done, K_FOREVER);
+	}
+}
+
+const struct bench_case bench_workq = {
+	.name = "workq",
+	.desc = "k_work_submit_to_queue() until the work handler runs",
+	.setup = setup,
+	.worker = worker,
+};
@@ -18,6 +18,8 @@
  *     k_fifo_put().
  *  7. Waking (and context switching to) a thread blocked on a FIFO via
  *     k_fifo_alloc_put().
+ *  8. Immediately removing a number of data items from a FIFO one by one
+ *     and in a single k_fifo_get_batch() call.
  */
 
 #include <zephyr/kernel.h>
@@ -31,6 +33,10 @@ static K_FIFO_DEFINE(fifo);
 
 BENCH_BMEM uintptr_t fifo_data[5];
 
+#define BATCH_SIZE 16
+
+static uintptr_t fifo_batch_data[BATCH_SIZE][2];
+
 static void fifo_put_get_thread_entry(void *p1, void *p2, void *p3)
 {
 	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
@@ -346,3 +352,88 @@ int fifo_blocking_ops(uint32_t num_iterations, uint32_t start_options,
 
 	return 0;
 }
+
+static void fifo_batch_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
+	timing_t start;
+	timing_t finish;
+	uint64_t single_sum = 0ULL;
+	uint64_t batch_sum = 0ULL;
+	void *data[BATCH_SIZE];
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		for (uint32_t j = 0; j < BATCH_SIZE; j++) {
+			k_fifo_put(&fifo, fifo_batch_data[j]);
+		}
+
+		start = timing_timestamp_get();
+
+		for (uint32_t j = 0; j < BATCH_SIZE; j++) {
+			data[j] = k_fifo_get(&fifo, K_NO_WAIT);
+		}
+
+		finish = timing_timestamp_get();
+
+		single_sum += timing_cycles_get(&start, &finish);
+
+		for (uint32_t j = 0; j < BATCH_SIZE; j++) {
+			k_fifo_put(&fifo, fifo_batch_data[j]);
+		}
+
+		start = timing_timestamp_get();
+
+		(void)k_fifo_get_batch(&fifo, data, BATCH_SIZE, K_NO_WAIT);
+
+		finish = timing_timestamp_get();
+
+		batch_sum += timing_cycles_get(&start, &finish);
+	}
+
+	timestamp.cycles = single_sum;
+	k_sem_take(&pause_sem, K_FOREVER);
+
+	timestamp.cycles = batch_sum;
+}
+
+int fifo_batch_ops(uint32_t num_iterations)
+{
+	int      priority;
+	uint64_t cycles;
+	char     description[120];
+
+	priority = k_thread_priority_get(k_current_get());
+
+	timing_start();
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			fifo_batch_thread_entry,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 1, 0, K_FOREVER);
+
+	k_thread_start(&start_thread);
+
+	/* Both averages are per data item */
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Get %u data items from FIFO one by one",
+		 "fifo.get.single.immediate.kernel", BATCH_SIZE);
+	cycles = timestamp.cycles;
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations * BATCH_SIZE, false, "");
+	k_sem_give(&pause_sem);
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Get %u data items from FIFO in a batch",
+		 "fifo.get.batch.immediate.kernel", BATCH_SIZE);
+	cycles = timestamp.cycles;
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations * BATCH_SIZE, false, "");
+
+	k_thread_join(&start_thread, K_FOREVER);
+
+	timing_stop();
+
+	return 0;
+}
@@ -55,6 +55,7 @@ extern int thread_ops(uint32_t num_iterations, uint32_t start_options,
 extern int fifo_ops(uint32_t num_iterations, uint32_t options);
 extern int fifo_blocking_ops(uint32_t num_iterations, uint32_t start_options,
 			     uint32_t alt_options);
+extern int fifo_batch_ops(uint32_t num_iterations);
 extern int lifo_ops(uint32_t num_iterations, uint32_t options);
 extern int lifo_blocking_ops(uint32_t num_iterations, uint32_t start_options,
 			     uint32_t alt_options);
@@ -140,6 +141,8 @@ static void test_thread(void *arg1, void *arg2, void *arg3)
 	fifo_blocking_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER, K_USER);
 #endif
 
+	fifo_batch_ops(CONFIG_BENCHMARK_NUM_ITERATIONS);
+
 
 	lifo_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, 0);
 #ifdef CONFIG_USERSPACE
@@ -20,6 +20,9 @@ static struct k_thread textra2;
 static K_THREAD_STACK_DEFINE(sreceiver, STACK_SIZE);
 static K_THREAD_STACK_DEFINE(sextra1, STACK_SIZE);
 static K_THREAD_STACK_DEFINE(sextra2, STACK_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(swake_one, 2, STACK_SIZE);
+
+static struct k_thread twake_one[2];
 
 static K_EVENT_DEFINE(test_event);
 static K_EVENT_DEFINE(sync_event);
@@ -28,6 +31,7 @@ static K_SEM_DEFINE(receiver_sem, 0, 1);
 static K_SEM_DEFINE(sync_sem, 0, 1);
 
 volatile static uint32_t test_events;
+static atomic_t wake_one_woken;
 
 static void entry_extra1(void *p1, void *p2, void *p3)
 {
@@ -434,6 +438,57 @@ ZTEST(events_api, test_event_receive)
 
 	test_wake_multiple_threads();
 }
+static void entry_wake_one(void *p1, void *p2, void *p3)
+{
+	uint32_t events = POINTER_TO_UINT(p1);
+
+	ARG_UNUSED(p3);
+
+	if (k_event_wait(&test_event, events, false, LONG_TIMEOUT) != 0) {
+		atomic_or(&wake_one_woken, POINTER_TO_UINT(p2));
+	}
+}
+
+/**
+ * Test posting events with the K_EVENT_WAKE_ONE option.
+ *
+ * Two threads of different priorities wait for the same event, one of them
+ * along with another event. Posting the event with K_EVENT_WAKE_ONE must only
+ * wake the highest priority thread, the other one staying pended until the
+ * event is posted again.
+ */
+
+ZTEST(events_api, test_event_wake_one)
+{
+	k_event_clear(&test_event, ~0);
+	atomic_clear(&wake_one_woken);
+
+	(void) k_thread_create(&twake_one[0], swake_one[0], STACK_SIZE,
+			       entry_wake_one, UINT_TO_POINTER(0x4),
+			       UINT_TO_POINTER(BIT(0)), NULL,
+			       K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+
+	(void) k_thread_create(&twake_one[1], swake_one[1], STACK_SIZE,
+			       entry_wake_one, UINT_TO_POINTER(0x6),
+			       UINT_TO_POINTER(BIT(1)), NULL,
+			       K_PRIO_PREEMPT(2), 0, K_NO_WAIT);
+
+	/* Let both threads pend on the event object */
+	k_sleep(DELAY);
+
+	k_event_post_options(&test_event, 0x4, K_EVENT_WAKE_ONE);
+	k_sleep(DELAY);
+	zassert_equal(atomic_get(&wake_one_woken), BIT(0));
+
+	k_event_post_options(&test_event, 0x4, K_EVENT_WAKE_ONE);
+	k_sleep(DELAY);
+	zassert_equal(atomic_get(&wake_one_woken), BIT(0) | BIT(1));
+
+	k_thread_join(&twake_one[0], K_FOREVER);
+	k_thread_join(&twake_one[1], K_FOREVER);
+
+	k_event_clear(&test_event, ~0);
+}
 /**
  * @}
  */
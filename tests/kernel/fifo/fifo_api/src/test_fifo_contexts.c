@@ -196,6 +196,29 @@ ZTEST(fifo_api, test_fifo_is_empty_isr)
 	/**TESTPOINT: check fifo is empty from isr*/
 	irq_offload((irq_offload_routine_t)tfifo_is_empty, &fifo);
 }
+/**
+ * @brief Test getting several data items from a fifo at once
+ * @see k_fifo_put(), k_fifo_get_batch()
+ */
+ZTEST(fifo_api, test_fifo_get_batch)
+{
+	void *rx_data[LIST_LEN + 1];
+
+	k_fifo_init(&fifo);
+	for (int i = 0; i < LIST_LEN; i++) {
+		k_fifo_put(&fifo, (void *)&data[i]);
+	}
+
+	/**TESTPOINT: data items come out first in, first out */
+	zassert_equal(k_fifo_get_batch(&fifo, rx_data, ARRAY_SIZE(rx_data),
+				       K_NO_WAIT), LIST_LEN);
+	for (int i = 0; i < LIST_LEN; i++) {
+		zassert_equal(rx_data[i], (void *)&data[i]);
+	}
+	zassert_equal(k_fifo_get_batch(&fifo, rx_data, ARRAY_SIZE(rx_data),
+				       K_MSEC(10)), 0);
+}
+
 /**
  * @}
  */
@@ -130,6 +130,27 @@ ZTEST(lifo_contexts, test_lifo_isr2thread)
 	tlifo_isr_thread(&klifo);
 }
 
+/**
+ * @brief Test getting several data items from a lifo at once
+ * @see k_lifo_put(), k_lifo_get_batch()
+ */
+ZTEST(lifo_contexts, test_lifo_get_batch)
+{
+	void *rx_data[LIST_LEN + 1];
+
+	k_lifo_init(&lifo);
+	tlifo_put(&lifo);
+
+	/**TESTPOINT: data items come out last in, first out */
+	zassert_equal(k_lifo_get_batch(&lifo, rx_data, ARRAY_SIZE(rx_data),
+				       K_NO_WAIT), LIST_LEN);
+	for (int i = 0; i < LIST_LEN; i++) {
+		zassert_equal(rx_data[i], (void *)&data[LIST_LEN - 1 - i]);
+	}
+	zassert_equal(k_lifo_get_batch(&lifo, rx_data, ARRAY_SIZE(rx_data),
+				       K_NO_WAIT), 0);
+}
+
 /**
  * @}
  */
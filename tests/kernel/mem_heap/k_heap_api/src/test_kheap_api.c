@@ -431,3 +431,70 @@ ZTEST(k_heap_api, test_k_heap_realloc_fail)
 
 	k_heap_free(&k_heap_test, p);
 }
+
+#ifdef CONFIG_SYS_HEAP_MAGAZINES
+#define MAG_HEAP_SIZE  65536
+#define MAG_BLOCK_SIZE 24
+#define MAG_FILL_SIZE  128
+#define MAG_NUM_BLOCKS 64
+
+K_HEAP_DEFINE(mag_heap, MAG_HEAP_SIZE);
+static void *mag_blocks[MAG_HEAP_SIZE / MAG_FILL_SIZE];
+#endif
+
+/**
+ * @brief Test k_heap allocations served from per-CPU magazines
+ *
+ * @ingroup k_heap_api_tests
+ *
+ * @details Validates that freed small blocks are reused from the
+ * magazines, that the heap stays consistent while blocks are cached,
+ * and that cached blocks are returned to the heap when a large
+ * allocation would otherwise fail.
+ *
+ * @see k_heap_alloc(), k_heap_free()
+ */
+ZTEST(k_heap_api, test_k_heap_magazines)
+{
+#ifdef CONFIG_SYS_HEAP_MAGAZINES
+	int n;
+	void *p;
+
+	for (n = 0; n < MAG_NUM_BLOCKS; n++) {
+		mag_blocks[n] = k_heap_alloc(&mag_heap, MAG_BLOCK_SIZE, K_NO_WAIT);
+		zassert_not_null(mag_blocks[n], "k_heap_alloc operation failed");
+	}
+	for (n = 0; n < MAG_NUM_BLOCKS; n++) {
+		k_heap_free(&mag_heap, mag_blocks[n]);
+	}
+	zassert_true(sys_heap_validate(&mag_heap.heap), "heap invalid with cached blocks");
+
+	/* The most recently freed block is handed out first (unless we
+	 * migrated to another CPU in between)
+	 */
+	p = k_heap_alloc(&mag_heap, MAG_BLOCK_SIZE, K_NO_WAIT);
+	if (arch_num_cpus() == 1) {
+		zassert_equal(p, mag_blocks[MAG_NUM_BLOCKS - 1], "block not taken from magazine");
+	}
+	k_heap_free(&mag_heap, p);
+
+	/* Exhaust the heap with cacheable blocks, many of which end up cached */
+	for (n = 0; n < ARRAY_SIZE(mag_blocks); n++) {
+		mag_blocks[n] = k_heap_alloc(&mag_heap, MAG_FILL_SIZE, K_NO_WAIT);
+		if (mag_blocks[n] == NULL) {
+			break;
+		}
+	}
+	zassert_true(n < ARRAY_SIZE(mag_blocks), "heap not exhausted");
+	while (n-- > 0) {
+		k_heap_free(&mag_heap, mag_blocks[n]);
+	}
+
+	p = k_heap_alloc(&mag_heap, MAG_HEAP_SIZE / 2, K_NO_WAIT);
+	zassert_not_null(p, "cached blocks not returned to the heap");
+	k_heap_free(&mag_heap, p);
+	zassert_true(sys_heap_validate(&mag_heap.heap), "heap invalid after drain");
+#else
+	ztest_test_skip();
+#endif
+}
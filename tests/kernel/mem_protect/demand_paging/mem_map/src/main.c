@@ -122,6 +122,9 @@ static void touch_anon_pages(bool zig, bool zag)
 	unsigned long faults;
 	struct k_mem_paging_stats_t stats;
 	k_tid_t tid = k_current_get();
+#ifdef CONFIG_BACKING_STORE_RAM_COMPRESSED
+	struct k_mem_paging_backing_store_compressed_stats_t cstats;
+#endif
 
 	faults = k_mem_num_pagefaults_get();
 
@@ -164,6 +167,18 @@ static void touch_anon_pages(bool zig, bool zag)
 	zassert_not_equal(stats.eviction.dirty, 0UL,
 			  "there should be dirty pages being evicted.");
 
+#ifdef CONFIG_BACKING_STORE_RAM_COMPRESSED
+	k_mem_paging_backing_store_compressed_stats_get(&cstats);
+	printk("* Compressed backing store:\n");
+	printk("    - Pages stored: %lu\n", cstats.pages);
+	printk("    - Same-filled pages: %lu\n", cstats.same_filled);
+	printk("    - Incompressible pages: %lu\n", cstats.incompressible);
+	printk("    - Bytes stored: %zu\n", cstats.stored_bytes);
+	zassert_not_equal(cstats.pages, 0UL, "no pages in backing store?");
+	zassert_true(cstats.stored_bytes <= cstats.pages * CONFIG_MMU_PAGE_SIZE,
+		     "pages stored larger than their size");
+#endif /* CONFIG_BACKING_STORE_RAM_COMPRESSED */
+
 #ifdef CONFIG_EVICTION_NRU
 	k_msleep(CONFIG_EVICTION_NRU_PERIOD * 2);
 #endif /* CONFIG_EVICTION_NRU */
@@ -252,9 +267,15 @@ static void test_k_mem_page_out(void)
 	faults = k_mem_num_pagefaults_get() - faults;
 	irq_unlock(key);
 
-	zassert_equal(faults, HALF_PAGES,
-		      "unexpected num pagefaults expected %lu got %d",
-		      HALF_PAGES, faults);
+	if (CONFIG_DEMAND_PAGING_READ_AHEAD > 0) {
+		zassert_true(faults > 0 && faults <= HALF_PAGES,
+			     "unexpected num pagefaults expected at most %lu got %d",
+			     HALF_PAGES, faults);
+	} else {
+		zassert_equal(faults, HALF_PAGES,
+			      "unexpected num pagefaults expected %lu got %d",
+			      HALF_PAGES, faults);
+	}
 
 	ret = k_mem_page_out(arena, arena_size);
 	zassert_equal(ret, -ENOMEM, "k_mem_page_out should have failed");
@@ -288,6 +309,103 @@ ZTEST(demand_paging_api, test_k_mem_page_in)
 		      faults);
 }
 
+ZTEST(demand_paging_api, test_read_ahead)
+{
+	unsigned long faults, hint_faults, max_faults;
+	int key, ret;
+
+	if (CONFIG_DEMAND_PAGING_READ_AHEAD == 0) {
+		ztest_test_skip();
+	}
+
+	/* Two faults to detect the sequence, then one every read ahead batch.
+	 * Batches get shorter as the page frames freed below run out.
+	 */
+	max_faults = 2 + DIV_ROUND_UP(HALF_PAGES - 2, CONFIG_DEMAND_PAGING_READ_AHEAD + 1) +
+		     CONFIG_DEMAND_PAGING_READ_AHEAD;
+
+	key = irq_lock();
+
+	ret = k_mem_page_out(arena, HALF_BYTES);
+	zassert_equal(ret, 0, "k_mem_page_out failed with %d", ret);
+
+	faults = k_mem_num_pagefaults_get();
+	/* Read the evicted region sequentially */
+	for (size_t i = 0; i < HALF_BYTES; i++) {
+		zassert_equal(arena[i], nums[i % 10], "arena corrupted at index %d", i);
+	}
+	faults = k_mem_num_pagefaults_get() - faults;
+
+	/* Reading ahead from the region given to k_mem_page_in() */
+	ret = k_mem_page_out(arena, HALF_BYTES);
+	zassert_equal(ret, 0, "k_mem_page_out failed with %d", ret);
+
+	k_mem_page_in(arena, CONFIG_MMU_PAGE_SIZE);
+
+	hint_faults = k_mem_num_pagefaults_get();
+	for (size_t i = 0; i < HALF_BYTES; i++) {
+		zassert_equal(arena[i], nums[i % 10], "arena corrupted at index %d", i);
+	}
+	hint_faults = k_mem_num_pagefaults_get() - hint_faults;
+	irq_unlock(key);
+
+	zassert_true(faults <= max_faults, "%lu page faults when at most %lu expected",
+		     faults, max_faults);
+
+	max_faults = DIV_ROUND_UP(HALF_PAGES - 1, CONFIG_DEMAND_PAGING_READ_AHEAD + 1) +
+		     CONFIG_DEMAND_PAGING_READ_AHEAD;
+	zassert_true(hint_faults <= max_faults,
+		     "%lu page faults after k_mem_page_in() when at most %lu expected",
+		     hint_faults, max_faults);
+}
+
+ZTEST(demand_paging_api, test_read_ahead_low_memory)
+{
+	struct k_mem_paging_stats_t before, after;
+	unsigned long faults, evictions;
+	char *page;
+	int key, ret;
+
+	if (CONFIG_DEMAND_PAGING_READ_AHEAD == 0) {
+		ztest_test_skip();
+	}
+
+	key = irq_lock();
+
+	ret = k_mem_page_out(arena, HALF_BYTES);
+	zassert_equal(ret, 0, "k_mem_page_out failed with %d", ret);
+
+	/* Use up the free page frames, backwards so that nothing is read ahead */
+	page = arena + arena_size;
+	while (k_mem_free_get() > 0 && page > arena + HALF_BYTES) {
+		page -= CONFIG_MMU_PAGE_SIZE;
+		*(volatile char *)page = nums[0];
+	}
+
+	/* Then free just enough page frames for a first read ahead batch */
+	page = arena + arena_size;
+	while (k_mem_free_get() < 2 * CONFIG_DEMAND_PAGING_READ_AHEAD * CONFIG_MMU_PAGE_SIZE &&
+	       page > arena + HALF_BYTES) {
+		page -= CONFIG_MMU_PAGE_SIZE;
+		ret = k_mem_page_out(page, CONFIG_MMU_PAGE_SIZE);
+		zassert_equal(ret, 0, "k_mem_page_out failed with %d", ret);
+	}
+
+	k_mem_paging_stats_get(&before);
+	for (size_t i = 0; i < HALF_BYTES; i++) {
+		zassert_equal(arena[i], nums[i % 10], "arena corrupted at index %d", i);
+	}
+	k_mem_paging_stats_get(&after);
+	irq_unlock(key);
+
+	/* Pages read ahead are not faults, and must not have evicted any page */
+	faults = after.pagefaults.cnt - before.pagefaults.cnt;
+	evictions = (after.eviction.clean - before.eviction.clean) +
+		    (after.eviction.dirty - before.eviction.dirty);
+	zassert_true(evictions <= faults, "%lu pages evicted for %lu page faults",
+		     evictions, faults);
+}
+
 ZTEST(demand_paging_api, test_k_mem_pin)
 {
 	unsigned long faults;
@@ -6,7 +6,9 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/syscall_batch.h>
 #include <zephyr/ztest.h>
+#include <zephyr/ztest_error_hook.h>
 #include <zephyr/linker/linker-defs.h>
 #include "test_syscalls.h"
 #include <mmu.h>
@@ -51,14 +53,6 @@ char kernel_string[BUF_SIZE];
 char kernel_buf[MAX_NR_THREADS][BUF_SIZE];
 ZTEST_BMEM char user_string[BUF_SIZE];
 
-void k_sys_fatal_error_handler(unsigned int reason, const struct arch_esf *pEsf)
-{
-	printk("Caught system error -- reason %d\n", reason);
-	printk("Unexpected fault during test\n");
-	TC_END_REPORT(TC_FAIL);
-	k_fatal_halt(reason);
-}
-
 size_t z_impl_string_nlen(char *src, size_t maxlen, int *err)
 {
 	YIELD_KERNEL;
@@ -507,6 +501,97 @@ ZTEST(syscalls, test_syscall_context)
 	k_thread_user_mode_enter(test_syscall_context_user, NULL, NULL, NULL);
 }
 
+void test_syscall_batch_user(void *p1, void *p2, void *p3)
+{
+	char buf[BUF_SIZE];
+	int err = -1;
+	struct k_syscall_batch_entry entries[] = {
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_SYSCALL_CONTEXT),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_STRING_NLEN, user_string, BUF_SIZE, &err),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_TO_COPY, buf),
+	};
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zassert_ok(k_syscall_batch(entries, ARRAY_SIZE(entries)));
+
+	zassert_true((bool)entries[0].ret, "not reported in user syscall");
+	zassert_equal(entries[1].ret, strlen(user_string));
+	zassert_equal(err, 0, "user string faulted (%d)", err);
+	zassert_equal(entries[2].ret, 0, "copy should have been a success");
+	zassert_str_equal(buf, user_string);
+
+	zassert_ok(k_syscall_batch(entries, 0));
+}
+
+/* Show that batched system calls run as if invoked on their own */
+ZTEST(syscalls, test_syscall_batch)
+{
+	struct k_syscall_batch_entry entry =
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_SYSCALL_CONTEXT);
+
+	/* Nothing to batch in supervisor mode */
+	zassert_equal(k_syscall_batch(&entry, 1), -ENOTSUP);
+
+	/* Remainder of the test in user mode */
+	k_thread_user_mode_enter(test_syscall_batch_user, NULL, NULL, NULL);
+}
+
+/* Show that a batch with an invalid system call ID oopses */
+ZTEST_USER(syscalls, test_syscall_batch_bad_id)
+{
+	struct k_syscall_batch_entry entries[] = {
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_SYSCALL_CONTEXT),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_LIMIT),
+	};
+
+	ztest_set_fault_valid(true);
+	(void)k_syscall_batch(entries, ARRAY_SIZE(entries));
+	ztest_test_fail();
+}
+
+/* Show that a batch within a batch oopses */
+ZTEST_USER(syscalls, test_syscall_batch_nested)
+{
+	struct k_syscall_batch_entry inner =
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_SYSCALL_CONTEXT);
+	struct k_syscall_batch_entry entry =
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SYSCALL_BATCH, &inner, 1);
+
+	ztest_set_fault_valid(true);
+	(void)k_syscall_batch(&entry, 1);
+	ztest_test_fail();
+}
+
+/* Not in any memory partition of the user threads */
+static struct k_syscall_batch_entry kernel_entries[] = {
+	K_SYSCALL_BATCH_ENTRY(K_SYSCALL_SYSCALL_CONTEXT),
+};
+
+/* Readable, but not writable by user threads */
+static const struct k_syscall_batch_entry ro_entries[] = {
+	K_SYSCALL_BATCH_ENTRY(K_SYSCALL_SYSCALL_CONTEXT),
+};
+
+/* Show that a batch in memory the caller cannot read oopses */
+ZTEST_USER(syscalls, test_syscall_batch_unreadable)
+{
+	ztest_set_fault_valid(true);
+	(void)k_syscall_batch(kernel_entries, ARRAY_SIZE(kernel_entries));
+	ztest_test_fail();
+}
+
+/* Show that a batch in memory the caller cannot write oopses */
+ZTEST_USER(syscalls, test_syscall_batch_unwritable)
+{
+	ztest_set_fault_valid(true);
+	(void)k_syscall_batch((struct k_syscall_batch_entry *)ro_entries,
+			      ARRAY_SIZE(ro_entries));
+	ztest_test_fail();
+}
+
 K_HEAP_DEFINE(test_heap, BUF_SIZE * (4 * MAX_NR_THREADS));
 
 void *syscalls_setup(void)
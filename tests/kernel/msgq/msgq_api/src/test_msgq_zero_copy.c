@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern struct k_thread tdata;
+extern k_tid_t tids[2];
+extern struct k_msgq msgq;
+static ZTEST_BMEM char __aligned(4) tbuffer[MSG_SIZE * MSGQ_LEN];
+static ZTEST_DMEM uint32_t data[MSGQ_LEN] = { MSG0, MSG1 };
+
+static void zero_copy_put(struct k_msgq *q, uint32_t msg)
+{
+	void *slot;
+
+	zassert_ok(k_msgq_alloc_put(q, &slot, K_NO_WAIT));
+	*(uint32_t *)slot = msg;
+	zassert_ok(k_msgq_commit(q, slot));
+}
+
+static uint32_t zero_copy_get(struct k_msgq *q, k_timeout_t timeout)
+{
+	uint32_t msg;
+	void *slot;
+
+	zassert_ok(k_msgq_claim(q, &slot, timeout));
+	msg = *(uint32_t *)slot;
+	zassert_ok(k_msgq_finish(q, slot));
+
+	return msg;
+}
+
+static void thread_claim_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t msg = zero_copy_get((struct k_msgq *)p1, K_FOREVER);
+
+	zassert_equal(msg, data[0]);
+}
+
+static void thread_alloc_put_entry(void *p1, void *p2, void *p3)
+{
+	struct k_msgq *q = p1;
+	void *slot;
+
+	/* the queue is full, wait until the main thread frees a slot */
+	zassert_ok(k_msgq_alloc_put(q, &slot, K_FOREVER));
+	*(uint32_t *)slot = data[1];
+	zassert_ok(k_msgq_commit(q, slot));
+}
+
+static void reserve_and_claim(struct k_msgq *q)
+{
+	uint32_t msg;
+	void *slot;
+	void *other;
+	void *claimed;
+
+	/* a reserved slot is neither free nor readable until committed */
+	zassert_ok(k_msgq_alloc_put(q, &slot, K_NO_WAIT));
+	zassert_equal(k_msgq_num_free_get(q), MSGQ_LEN - 1);
+	zassert_equal(k_msgq_num_used_get(q), 0);
+	zassert_equal(k_msgq_get(q, &msg, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_alloc_put(q, &other, K_NO_WAIT), -ENOMSG);
+
+	/* other messages are still sent, but only read after it */
+	zassert_ok(k_msgq_put(q, &data[1], K_NO_WAIT));
+	zassert_equal(k_msgq_num_free_get(q), 0);
+	zassert_equal(k_msgq_num_used_get(q), 0);
+	zassert_equal(k_msgq_get(q, &msg, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_commit(q, tbuffer + 1), -EINVAL);
+
+	*(uint32_t *)slot = data[0];
+	zassert_ok(k_msgq_commit(q, slot));
+	zassert_equal(k_msgq_commit(q, slot), -EINVAL);
+	zassert_equal(k_msgq_num_used_get(q), 2);
+	zassert_equal(k_msgq_num_free_get(q), 0);
+
+	/* the claimed slot is only reused once finished */
+	zassert_ok(k_msgq_claim(q, &claimed, K_NO_WAIT));
+	zassert_equal(*(uint32_t *)claimed, data[0]);
+	zassert_equal(k_msgq_num_used_get(q), 1);
+	zassert_equal(k_msgq_claim(q, &slot, K_NO_WAIT), -ENOMSG);
+
+	zassert_ok(k_msgq_get(q, &msg, K_NO_WAIT));
+	zassert_equal(msg, data[1]);
+	zassert_equal(k_msgq_num_free_get(q), 0);
+	zassert_equal(k_msgq_alloc_put(q, &slot, K_NO_WAIT), -ENOMSG);
+
+	zassert_equal(k_msgq_finish(q, (char *)claimed + MSG_SIZE), -EINVAL);
+	zassert_ok(k_msgq_finish(q, claimed));
+	zassert_equal(k_msgq_num_free_get(q), MSGQ_LEN);
+
+	/* mixed with copying calls, order is kept */
+	zero_copy_put(q, data[0]);
+	zassert_ok(k_msgq_put(q, &data[1], K_NO_WAIT));
+	zassert_equal(zero_copy_get(q, K_NO_WAIT), data[0]);
+	zassert_ok(k_msgq_get(q, &msg, K_NO_WAIT));
+	zassert_equal(msg, data[1]);
+}
+
+static void claim_when_empty(struct k_msgq *q, uint32_t options)
+{
+	uint32_t msg;
+
+	tids[0] = k_thread_create(&tdata, tstack, STACK_SIZE,
+				  thread_claim_entry, q, NULL, NULL,
+				  K_PRIO_PREEMPT(0), options, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	/**TESTPOINT: the message is handed to the thread waiting to claim */
+	zassert_ok(k_msgq_put(q, &data[0], K_NO_WAIT));
+	k_thread_join(tids[0], K_FOREVER);
+	tids[0] = NULL;
+	zassert_equal(k_msgq_num_free_get(q), MSGQ_LEN);
+
+	/* fill the queue, then wait to reserve a slot */
+	for (int i = 0; i < MSGQ_LEN; i++) {
+		zassert_ok(k_msgq_put(q, &data[0], K_NO_WAIT));
+	}
+	tids[0] = k_thread_create(&tdata, tstack, STACK_SIZE,
+				  thread_alloc_put_entry, q, NULL, NULL,
+				  K_PRIO_PREEMPT(0), options, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	/**TESTPOINT: the freed slot is reserved for the waiting thread */
+	zassert_equal(zero_copy_get(q, K_NO_WAIT), data[0]);
+	k_thread_join(tids[0], K_FOREVER);
+	tids[0] = NULL;
+
+	zassert_ok(k_msgq_get(q, &msg, K_NO_WAIT));
+	zassert_equal(msg, data[0]);
+	zassert_ok(k_msgq_get(q, &msg, K_NO_WAIT));
+	zassert_equal(msg, data[1]);
+}
+
+static void purge_when_claimed(struct k_msgq *q)
+{
+	void *claimed;
+	void *slot;
+	uint32_t msg;
+
+	zero_copy_put(q, data[0]);
+	zassert_ok(k_msgq_put(q, &data[1], K_NO_WAIT));
+	zassert_ok(k_msgq_claim(q, &claimed, K_NO_WAIT));
+
+	/**TESTPOINT: purge keeps the claimed slot busy */
+	k_msgq_purge(q);
+	zassert_equal(k_msgq_num_used_get(q), 0);
+	zassert_equal(k_msgq_num_free_get(q), 0);
+	zassert_equal(*(uint32_t *)claimed, data[0]);
+
+	zassert_ok(k_msgq_finish(q, claimed));
+	zassert_equal(k_msgq_num_free_get(q), MSGQ_LEN);
+
+	/**TESTPOINT: purge keeps a reserved slot, committed after it */
+	zassert_ok(k_msgq_put(q, &data[0], K_NO_WAIT));
+	zassert_ok(k_msgq_alloc_put(q, &slot, K_NO_WAIT));
+	k_msgq_purge(q);
+	*(uint32_t *)slot = data[1];
+	zassert_ok(k_msgq_commit(q, slot));
+	zassert_equal(k_msgq_num_used_get(q), 1);
+	zassert_ok(k_msgq_get(q, &msg, K_NO_WAIT));
+	zassert_equal(msg, data[1]);
+
+	/**TESTPOINT: purge drops the messages sent behind a reserved slot */
+	zassert_ok(k_msgq_alloc_put(q, &slot, K_NO_WAIT));
+	zassert_ok(k_msgq_put(q, &data[0], K_NO_WAIT));
+	k_msgq_purge(q);
+	zassert_equal(k_msgq_num_free_get(q), MSGQ_LEN - 1);
+	*(uint32_t *)slot = data[1];
+	zassert_ok(k_msgq_commit(q, slot));
+	zassert_equal(k_msgq_num_used_get(q), 1);
+	zassert_ok(k_msgq_put(q, &data[0], K_NO_WAIT));
+	zassert_ok(k_msgq_get(q, &msg, K_NO_WAIT));
+	zassert_equal(msg, data[1]);
+	zassert_ok(k_msgq_get(q, &msg, K_NO_WAIT));
+	zassert_equal(msg, data[0]);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test reserving, committing, claiming and finishing messages
+ * @see k_msgq_alloc_put(), k_msgq_commit(), k_msgq_claim(), k_msgq_finish()
+ */
+ZTEST(msgq_api, test_msgq_zero_copy)
+{
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MSGQ_LEN);
+
+	reserve_and_claim(&msgq);
+	purge_when_claimed(&msgq);
+}
+
+/**
+ * @brief Test threads waiting to claim a message or to reserve a slot
+ * @see k_msgq_alloc_put(), k_msgq_claim()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_zero_copy_wait)
+{
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MSGQ_LEN);
+
+	claim_when_empty(&msgq, 0);
+}
+
+#ifdef CONFIG_USERSPACE
+/**
+ * @brief Test zero-copy message passing from user mode threads
+ * @see k_msgq_alloc_put(), k_msgq_claim()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_user_zero_copy_wait)
+{
+	/* the ring buffer lives in the test memory partition */
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MSGQ_LEN);
+
+	claim_when_empty(&msgq, K_USER | K_INHERIT_PERMS);
+}
+#endif /* CONFIG_USERSPACE */
+
+/**
+ * @}
+ */
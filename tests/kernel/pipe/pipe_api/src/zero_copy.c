@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdint.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+ZTEST_SUITE(k_pipe_zero_copy, NULL, NULL, NULL, NULL, NULL);
+
+#define PIPE_SIZE 16
+static uint8_t buffer[PIPE_SIZE];
+static struct k_pipe pipe;
+static struct k_thread thread;
+static K_THREAD_STACK_DEFINE(stack, 1024);
+
+static uint8_t abcd[] = "abcd";
+static uint8_t abcdefgh[] = "abcdefgh";
+static uint8_t defgh[] = "defgh";
+
+static void thread_write(void *arg1, void *arg2, void *arg3)
+{
+	static const uint8_t data[4] = { 1, 2, 3, 4 };
+
+	zassert_equal(k_pipe_write(&pipe, data, sizeof(data), K_FOREVER), sizeof(data));
+}
+
+static void thread_read(void *arg1, void *arg2, void *arg3)
+{
+	uint8_t data[4];
+
+	zassert_equal(k_pipe_read(&pipe, data, sizeof(data), K_FOREVER), sizeof(data));
+	zassert_mem_equal(data, "abcd", sizeof(data));
+}
+
+static void thread_reset(void *arg1, void *arg2, void *arg3)
+{
+	k_pipe_reset(&pipe);
+}
+
+ZTEST(k_pipe_zero_copy, test_write_claim_commit)
+{
+	uint8_t *region;
+	uint8_t data[8];
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	zassert_equal(k_pipe_write_claim(&pipe, &region, 8, K_NO_WAIT), 8);
+	zassert_equal(region, buffer);
+	memcpy(region, "abcdefgh", 8);
+
+	/* Claimed data is not readable until committed */
+	zassert_equal(k_pipe_read(&pipe, data, 1, K_NO_WAIT), -EAGAIN);
+
+	/* The part not committed goes back to the pipe */
+	zassert_ok(k_pipe_write_commit(&pipe, 6));
+	zassert_equal(k_pipe_write_commit(&pipe, 0), -EINVAL);
+
+	zassert_equal(k_pipe_read(&pipe, data, sizeof(data), K_NO_WAIT), 6);
+	zassert_mem_equal(data, "abcdef", 6);
+}
+
+ZTEST(k_pipe_zero_copy, test_write_claim_wraps)
+{
+	uint8_t *region;
+	uint8_t data[PIPE_SIZE];
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	zassert_equal(k_pipe_write(&pipe, data, 12, K_NO_WAIT), 12);
+	zassert_equal(k_pipe_read(&pipe, data, 12, K_NO_WAIT), 12);
+
+	/* Only the space up to the end of the ring buffer is contiguous */
+	zassert_equal(k_pipe_write_claim(&pipe, &region, 8, K_NO_WAIT), 4);
+	zassert_equal(region, &buffer[12]);
+	memcpy(region, "wxyz", 4);
+	zassert_ok(k_pipe_write_commit(&pipe, 4));
+
+	zassert_equal(k_pipe_write_claim(&pipe, &region, 8, K_NO_WAIT), 8);
+	zassert_equal(region, &buffer[0]);
+	zassert_ok(k_pipe_write_commit(&pipe, 0));
+
+	zassert_equal(k_pipe_read(&pipe, data, sizeof(data), K_NO_WAIT), 4);
+	zassert_mem_equal(data, "wxyz", 4);
+}
+
+ZTEST(k_pipe_zero_copy, test_write_claim_blocks_writers)
+{
+	static const uint8_t data[4] = { 1, 2, 3, 4 };
+	uint8_t *region;
+	uint8_t read_data[8];
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	zassert_equal(k_pipe_write_claim(&pipe, &region, 4, K_NO_WAIT), 4);
+	zassert_equal(k_pipe_write_claim(&pipe, &region, 4, K_NO_WAIT), -EAGAIN);
+	zassert_equal(k_pipe_write(&pipe, data, sizeof(data), K_NO_WAIT), -EAGAIN);
+
+	/* A writer waiting for the claim goes ahead once it is committed */
+	k_thread_create(&thread, stack, K_THREAD_STACK_SIZEOF(stack), thread_write,
+			NULL, NULL, NULL, K_PRIO_COOP(0), 0, K_NO_WAIT);
+	k_sleep(K_MSEC(10));
+	memcpy(region, "abcd", 4);
+	zassert_ok(k_pipe_write_commit(&pipe, 4));
+	k_thread_join(&thread, K_FOREVER);
+
+	zassert_equal(k_pipe_read(&pipe, read_data, sizeof(read_data), K_NO_WAIT), 8);
+	zassert_mem_equal(read_data, "abcd", 4);
+	zassert_mem_equal(&read_data[4], data, 4);
+}
+
+ZTEST(k_pipe_zero_copy, test_commit_wakes_reader)
+{
+	uint8_t *region;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	k_thread_create(&thread, stack, K_THREAD_STACK_SIZEOF(stack), thread_read,
+			NULL, NULL, NULL, K_PRIO_COOP(0), 0, K_NO_WAIT);
+	k_sleep(K_MSEC(10));
+
+	zassert_equal(k_pipe_write_claim(&pipe, &region, 4, K_NO_WAIT), 4);
+	memcpy(region, "abcd", 4);
+	zassert_ok(k_pipe_write_commit(&pipe, 4));
+	k_thread_join(&thread, K_FOREVER);
+}
+
+ZTEST(k_pipe_zero_copy, test_read_claim_finish)
+{
+	uint8_t *region;
+	uint8_t data[8];
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	zassert_equal(k_pipe_read_claim(&pipe, &region, 4, K_NO_WAIT), -EAGAIN);
+
+	zassert_equal(k_pipe_write(&pipe, abcdefgh, 8, K_NO_WAIT), 8);
+	zassert_equal(k_pipe_read_claim(&pipe, &region, 4, K_NO_WAIT), 4);
+	zassert_equal(region, buffer);
+	zassert_mem_equal(region, "abcd", 4);
+
+	/* Only one reader claims data at a time */
+	zassert_equal(k_pipe_read_claim(&pipe, &region, 4, K_NO_WAIT), -EAGAIN);
+	zassert_equal(k_pipe_read(&pipe, data, 1, K_NO_WAIT), -EAGAIN);
+
+	/* The part not finished stays in the pipe */
+	zassert_ok(k_pipe_read_finish(&pipe, 2));
+	zassert_equal(k_pipe_read_finish(&pipe, 0), -EINVAL);
+
+	zassert_equal(k_pipe_read(&pipe, data, sizeof(data), K_NO_WAIT), 6);
+	zassert_mem_equal(data, "cdefgh", 6);
+}
+
+static void thread_read_behind_claim(void *arg1, void *arg2, void *arg3)
+{
+	uint8_t data[4];
+
+	zassert_equal(k_pipe_read(&pipe, data, sizeof(data), K_FOREVER), sizeof(data));
+	zassert_mem_equal(data, "cdef", sizeof(data));
+}
+
+ZTEST(k_pipe_zero_copy, test_read_claim_keeps_order)
+{
+	uint8_t *region;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	zassert_equal(k_pipe_write(&pipe, abcd, 4, K_NO_WAIT), 4);
+	zassert_equal(k_pipe_read_claim(&pipe, &region, 4, K_NO_WAIT), 4);
+
+	/* A reader waits behind the claim while more data is written */
+	k_thread_create(&thread, stack, K_THREAD_STACK_SIZEOF(stack),
+			thread_read_behind_claim, NULL, NULL, NULL, K_PRIO_COOP(0), 0,
+			K_NO_WAIT);
+	k_sleep(K_MSEC(10));
+	zassert_equal(k_pipe_write(&pipe, &abcdefgh[4], 4, K_NO_WAIT), 4);
+
+	/* The part not finished comes before the data written meanwhile */
+	zassert_ok(k_pipe_read_finish(&pipe, 2));
+	k_thread_join(&thread, K_FOREVER);
+}
+
+ZTEST(k_pipe_zero_copy, test_read_claim_waits)
+{
+	uint8_t *region;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	k_thread_create(&thread, stack, K_THREAD_STACK_SIZEOF(stack), thread_write,
+			NULL, NULL, NULL, K_PRIO_COOP(0), 0, K_MSEC(10));
+	zassert_equal(k_pipe_read_claim(&pipe, &region, 8, K_MSEC(1000)), 4);
+	zassert_mem_equal(region, ((uint8_t []){ 1, 2, 3, 4 }), 4);
+	zassert_ok(k_pipe_read_finish(&pipe, 4));
+	k_thread_join(&thread, K_FOREVER);
+}
+
+ZTEST(k_pipe_zero_copy, test_claim_reset)
+{
+	uint8_t *wregion, *rregion;
+	uint8_t data[PIPE_SIZE];
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	zassert_equal(k_pipe_write(&pipe, abcdefgh, 8, K_NO_WAIT), 8);
+	zassert_equal(k_pipe_read_claim(&pipe, &rregion, 4, K_NO_WAIT), 4);
+	zassert_equal(k_pipe_write_claim(&pipe, &wregion, 4, K_NO_WAIT), 4);
+
+	k_pipe_reset(&pipe);
+
+	/* Both claims are canceled and the unread data is gone */
+	zassert_equal(k_pipe_write_commit(&pipe, 4), -ECANCELED);
+	zassert_equal(k_pipe_read_finish(&pipe, 0), -ECANCELED);
+	zassert_equal(k_pipe_read(&pipe, data, sizeof(data), K_NO_WAIT), -EAGAIN);
+
+	/* And the pipe can be used as before */
+	zassert_equal(k_pipe_write(&pipe, data, sizeof(data), K_NO_WAIT), sizeof(data));
+	zassert_equal(k_pipe_read(&pipe, data, sizeof(data), K_NO_WAIT), sizeof(data));
+}
+
+ZTEST(k_pipe_zero_copy, test_claim_reset_waiting)
+{
+	uint8_t *region;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	k_thread_create(&thread, stack, K_THREAD_STACK_SIZEOF(stack), thread_reset,
+			NULL, NULL, NULL, K_PRIO_COOP(0), 0, K_MSEC(10));
+	zassert_equal(k_pipe_read_claim(&pipe, &region, 4, K_MSEC(1000)), -ECANCELED);
+	k_thread_join(&thread, K_FOREVER);
+}
+
+ZTEST(k_pipe_zero_copy, test_claim_close)
+{
+	uint8_t *region;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	zassert_equal(k_pipe_write(&pipe, abcd, 4, K_NO_WAIT), 4);
+	zassert_equal(k_pipe_write_claim(&pipe, &region, 4, K_NO_WAIT), 4);
+
+	k_pipe_close(&pipe);
+
+	/* Committed data can still be read, the rest is dropped */
+	zassert_equal(k_pipe_write_commit(&pipe, 4), -EPIPE);
+	zassert_equal(k_pipe_read_claim(&pipe, &region, 8, K_NO_WAIT), 4);
+	zassert_mem_equal(region, "abcd", 4);
+	zassert_ok(k_pipe_read_finish(&pipe, 4));
+	zassert_equal(k_pipe_read_claim(&pipe, &region, 8, K_NO_WAIT), -EPIPE);
+	zassert_equal(k_pipe_write_claim(&pipe, &region, 8, K_NO_WAIT), -EPIPE);
+}
+
+ZTEST(k_pipe_zero_copy, test_claim_no_buffer)
+{
+	uint8_t *region;
+
+	k_pipe_init(&pipe, NULL, 0);
+	zassert_equal(k_pipe_write_claim(&pipe, &region, 4, K_NO_WAIT), -ENOTSUP);
+	zassert_equal(k_pipe_read_claim(&pipe, &region, 4, K_NO_WAIT), -ENOTSUP);
+}
+
+ZTEST(k_pipe_zero_copy, test_writev_readv)
+{
+	uint8_t a[3], b[5], c[4];
+	const struct k_pipe_iovec wiov[] = {
+		{ .base = abcd, .len = 3 },
+		{ .base = NULL, .len = 0 },
+		{ .base = defgh, .len = 5 },
+	};
+	const struct k_pipe_iovec riov[] = {
+		{ .base = a, .len = sizeof(a) },
+		{ .base = b, .len = sizeof(b) },
+		{ .base = c, .len = sizeof(c) },
+	};
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	zassert_equal(k_pipe_writev(&pipe, wiov, ARRAY_SIZE(wiov), K_NO_WAIT), 8);
+	zassert_equal(k_pipe_readv(&pipe, riov, ARRAY_SIZE(riov), K_NO_WAIT), 8);
+	zassert_mem_equal(a, "abc", 3);
+	zassert_mem_equal(b, "defgh", 5);
+
+	zassert_equal(k_pipe_writev(&pipe, wiov, 0, K_NO_WAIT), 0);
+	zassert_equal(k_pipe_readv(&pipe, riov, ARRAY_SIZE(riov), K_NO_WAIT), -EAGAIN);
+}
+
+static void thread_readv(void *arg1, void *arg2, void *arg3)
+{
+	uint8_t a[2], b[6];
+	const struct k_pipe_iovec riov[] = {
+		{ .base = a, .len = sizeof(a) },
+		{ .base = b, .len = sizeof(b) },
+	};
+
+	zassert_equal(k_pipe_readv(&pipe, riov, ARRAY_SIZE(riov), K_FOREVER), 8);
+	zassert_mem_equal(a, "ab", 2);
+	zassert_mem_equal(b, "cdefgh", 6);
+}
+
+ZTEST(k_pipe_zero_copy, test_writev_to_waiting_readv)
+{
+	const struct k_pipe_iovec wiov[] = {
+		{ .base = abcd, .len = 3 },
+		{ .base = defgh, .len = 5 },
+	};
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	/* The data goes straight to the waiting reader */
+	k_thread_create(&thread, stack, K_THREAD_STACK_SIZEOF(stack), thread_readv,
+			NULL, NULL, NULL, K_PRIO_COOP(0), 0, K_NO_WAIT);
+	k_sleep(K_MSEC(10));
+	zassert_equal(k_pipe_writev(&pipe, wiov, ARRAY_SIZE(wiov), K_NO_WAIT), 8);
+	k_thread_join(&thread, K_FOREVER);
+}
@@ -865,6 +865,39 @@ ZTEST(poll_api_1cpu, test_poll_msgq)
 	wake_up_by_poll = false;
 }
 
+/**
+ * @brief Test that only committed messages signal a polled message queue
+ *
+ * @see k_msgq_alloc_put(), k_msgq_commit()
+ */
+ZTEST(poll_api_1cpu, test_poll_msgq_commit)
+{
+	static char __aligned(4) buf[MSGQ_MSG_SIZE * MSGQ_MAX_MSGS];
+	char msgq_msg[MSGQ_MSG_SIZE] = MSGQ_MSG_VALUE;
+	struct k_poll_event event;
+	struct k_msgq mq;
+	void *slot;
+
+	k_msgq_init(&mq, buf, MSGQ_MSG_SIZE, MSGQ_MAX_MSGS);
+	k_poll_event_init(&event, K_POLL_TYPE_MSGQ_DATA_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &mq);
+
+	zassert_ok(k_msgq_alloc_put(&mq, &slot, K_NO_WAIT));
+	memcpy(slot, msgq_msg, MSGQ_MSG_SIZE);
+
+	/* a reserved slot is not a message yet */
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+
+	event.state = K_POLL_STATE_NOT_READY;
+	zassert_ok(k_msgq_commit(&mq, slot));
+	zassert_ok(k_poll(&event, 1, K_NO_WAIT));
+	zassert_equal(event.state, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+
+	zassert_ok(k_msgq_claim(&mq, &slot, K_NO_WAIT));
+	zassert_mem_equal(slot, msgq_msg, MSGQ_MSG_SIZE);
+	zassert_ok(k_msgq_finish(&mq, slot));
+}
+
 ZTEST(poll_api_1cpu, test_poll_zero_events)
 {
 	struct k_poll_event event;
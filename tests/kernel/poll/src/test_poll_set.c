@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#define SET_SIZE 32
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct fifo_msg {
+	void *private;
+	uint32_t msg;
+};
+
+static struct k_sem sems[SET_SIZE];
+static struct k_poll_event events[SET_SIZE];
+static struct k_poll_event *ready[SET_SIZE];
+static struct k_poll_set set;
+
+static struct k_fifo set_fifo;
+static struct fifo_msg set_msg;
+static struct k_thread set_thread;
+static K_THREAD_STACK_DEFINE(set_stack, STACK_SIZE);
+
+static void init_sem_set(void)
+{
+	k_poll_set_init(&set);
+
+	for (int i = 0; i < SET_SIZE; i++) {
+		k_sem_init(&sems[i], 0, K_SEM_MAX_LIMIT);
+		k_poll_event_init(&events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &sems[i]);
+		k_poll_set_add(&set, &events[i]);
+	}
+}
+
+static void remove_sem_set(void)
+{
+	for (int i = 0; i < SET_SIZE; i++) {
+		zassert_ok(k_poll_set_remove(&set, &events[i]));
+	}
+}
+
+/**
+ * @brief Test that a wait on a poll set only returns the ready events
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_init(), k_poll_set_add(), k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_ready_only)
+{
+	init_sem_set();
+
+	zassert_equal(k_poll_set_wait(&set, ready, SET_SIZE, K_NO_WAIT), -EAGAIN);
+
+	k_sem_give(&sems[5]);
+	k_sem_give(&sems[17]);
+
+	zassert_equal(k_poll_set_wait(&set, ready, SET_SIZE, K_NO_WAIT), 2);
+	zassert_equal_ptr(ready[0], &events[5]);
+	zassert_equal_ptr(ready[1], &events[17]);
+	for (int i = 0; i < SET_SIZE; i++) {
+		if (i == 5 || i == 17) {
+			zassert_equal(events[i].state, K_POLL_STATE_SEM_AVAILABLE);
+		} else {
+			zassert_equal(events[i].state, K_POLL_STATE_NOT_READY);
+		}
+	}
+
+	/* Events stay ready for as long as their semaphore is available */
+	zassert_ok(k_sem_take(&sems[5], K_NO_WAIT));
+	zassert_equal(k_poll_set_wait(&set, ready, SET_SIZE, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &events[17]);
+	zassert_equal(events[5].state, K_POLL_STATE_NOT_READY);
+
+	/* ... and go back to their semaphore once it is not */
+	zassert_ok(k_sem_take(&sems[17], K_NO_WAIT));
+	zassert_equal(k_poll_set_wait(&set, ready, SET_SIZE, K_NO_WAIT), -EAGAIN);
+
+	k_sem_give(&sems[5]);
+	zassert_equal(k_poll_set_wait(&set, ready, 1, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &events[5]);
+
+	remove_sem_set();
+}
+
+/**
+ * @brief Test that events ready when added are returned by the next wait
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_add(), k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_add_ready)
+{
+	struct k_poll_signal signal;
+	struct k_poll_event event;
+
+	k_poll_set_init(&set);
+	k_poll_signal_init(&signal);
+	k_poll_signal_raise(&signal, 0);
+
+	k_poll_event_init(&event, K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY,
+			  &signal);
+	k_poll_set_add(&set, &event);
+
+	zassert_equal(k_poll_set_wait(&set, ready, SET_SIZE, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &event);
+	zassert_equal(event.state, K_POLL_STATE_SIGNALED);
+
+	k_poll_signal_reset(&signal);
+	zassert_equal(k_poll_set_wait(&set, ready, SET_SIZE, K_NO_WAIT), -EAGAIN);
+
+	k_poll_signal_raise(&signal, 0);
+	zassert_equal(k_poll_set_wait(&set, ready, SET_SIZE, K_NO_WAIT), 1);
+
+	zassert_ok(k_poll_set_remove(&set, &event));
+}
+
+static void fifo_put_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	if (POINTER_TO_INT(p1) != 0) {
+		k_fifo_cancel_wait(&set_fifo);
+	} else {
+		k_fifo_put(&set_fifo, &set_msg);
+	}
+}
+
+static void start_fifo_thread(bool cancel)
+{
+	k_thread_create(&set_thread, set_stack, STACK_SIZE, fifo_put_entry,
+			INT_TO_POINTER(cancel), NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_MSEC(50));
+}
+
+/**
+ * @brief Test waiting on a poll set for an event signaled by another thread
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait(), k_fifo_cancel_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_wait)
+{
+	struct k_poll_event event;
+
+	k_poll_set_init(&set);
+	k_fifo_init(&set_fifo);
+	k_poll_event_init(&event, K_POLL_TYPE_FIFO_DATA_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_fifo);
+	k_poll_set_add(&set, &event);
+
+	zassert_equal(k_poll_set_wait(&set, ready, SET_SIZE, K_MSEC(10)), -EAGAIN);
+
+	start_fifo_thread(false);
+	zassert_equal(k_poll_set_wait(&set, ready, SET_SIZE, K_FOREVER), 1);
+	zassert_equal_ptr(ready[0], &event);
+	zassert_equal(event.state, K_POLL_STATE_FIFO_DATA_AVAILABLE);
+	zassert_equal_ptr(k_fifo_get(&set_fifo, K_NO_WAIT), &set_msg);
+	k_thread_join(&set_thread, K_FOREVER);
+
+	/* A cancelled event is returned once */
+	start_fifo_thread(true);
+	zassert_equal(k_poll_set_wait(&set, ready, SET_SIZE, K_FOREVER), 1);
+	zassert_equal(event.state, K_POLL_STATE_CANCELLED);
+	zassert_equal(k_poll_set_wait(&set, ready, SET_SIZE, K_NO_WAIT), -EAGAIN);
+	zassert_equal(event.state, K_POLL_STATE_NOT_READY);
+	k_thread_join(&set_thread, K_FOREVER);
+
+	zassert_ok(k_poll_set_remove(&set, &event));
+}
+
+/**
+ * @brief Test removing events from a poll set
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_remove()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_remove)
+{
+	init_sem_set();
+
+	/* Removed events are neither waiting on their object nor ready */
+	k_sem_give(&sems[3]);
+	zassert_ok(k_poll_set_remove(&set, &events[3]));
+	zassert_ok(k_poll_set_remove(&set, &events[4]));
+	k_sem_give(&sems[4]);
+	zassert_equal(k_poll_set_wait(&set, ready, SET_SIZE, K_NO_WAIT), -EAGAIN);
+
+	zassert_equal(k_poll_set_remove(&set, &events[3]), -EINVAL);
+
+	/* The semaphores are polled as usual again */
+	zassert_ok(k_poll(&events[4], 1, K_NO_WAIT));
+	zassert_equal(events[4].state, K_POLL_STATE_SEM_AVAILABLE);
+
+	for (int i = 0; i < SET_SIZE; i++) {
+		if (i != 3 && i != 4) {
+			zassert_ok(k_poll_set_remove(&set, &events[i]));
+		}
+	}
+}
+
+/**
+ * @brief Test adding and removing an event that registers nothing
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_add(), k_poll_set_arm(), k_poll_set_remove()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_ignore)
+{
+	struct k_poll_event event;
+
+	k_poll_set_init(&set);
+
+	/* k_poll_event_init() leaves the list node as it finds it */
+	memset(&event, 0xa5, sizeof(event));
+	k_poll_event_init(&event, K_POLL_TYPE_IGNORE, K_POLL_MODE_NOTIFY_ONLY, &sems[0]);
+	k_poll_set_add(&set, &event);
+	zassert_equal(k_poll_set_wait(&set, ready, SET_SIZE, K_NO_WAIT), -EAGAIN);
+	zassert_ok(k_poll_set_remove(&set, &event));
+
+	memset(&event, 0xa5, sizeof(event));
+	k_poll_event_init(&event, K_POLL_TYPE_IGNORE, K_POLL_MODE_NOTIFY_ONLY, &sems[0]);
+	k_poll_set_arm(&set, &event);
+	zassert_ok(k_poll_set_remove(&set, &event));
+	zassert_equal(k_poll_set_wait(&set, ready, SET_SIZE, K_NO_WAIT), -EAGAIN);
+}
+
+static void poll_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zassert_ok(k_poll(p1, 1, K_FOREVER));
+}
+
+/**
+ * @brief Test that a thread polling an object is signaled before a set
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait(), k_poll()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_after_thread)
+{
+	struct k_poll_event event;
+
+	init_sem_set();
+
+	k_poll_event_init(&event, K_POLL_TYPE_SEM_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &sems[0]);
+
+	/* The thread starts polling after the set, but is signaled first */
+	k_thread_create(&set_thread, set_stack, STACK_SIZE, poll_entry,
+			&event, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_sem_give(&sems[0]);
+	zassert_ok(k_thread_join(&set_thread, K_FOREVER));
+	zassert_equal(event.state, K_POLL_STATE_SEM_AVAILABLE);
+
+	remove_sem_set();
+}
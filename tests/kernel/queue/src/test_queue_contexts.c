@@ -553,3 +553,66 @@ ZTEST(queue_api, test_queue_unique_append)
 	ret = k_queue_unique_append(&queue, (void *)&data[1]);
 	zassert_true(ret, "queue unique append failed");
 }
+
+static void tThread_get_batch(void *p1, void *p2, void *p3)
+{
+	void *rx_data[LIST_LEN];
+	size_t count;
+
+	count = k_queue_get_batch((struct k_queue *)p1, rx_data, LIST_LEN, K_FOREVER);
+	zassert_true(count > 0 && count <= LIST_LEN);
+	zassert_equal(rx_data[0], (void *)&data[0]);
+	k_sem_give(&end_sema);
+}
+
+/**
+ * @brief Verify k_queue_get_batch()
+ *
+ * @ingroup kernel_queue_tests
+ *
+ * @details Get several data items at once, in queue order and no more
+ * than requested. Then verify that a thread waiting on an empty queue
+ * is woken up by the first appended data item.
+ *
+ * @see k_queue_get_batch()
+ */
+ZTEST(queue_api_1cpu, test_queue_get_batch)
+{
+	void *rx_data[LIST_LEN * 2];
+	size_t count;
+
+	k_queue_init(&queue);
+
+	/**TESTPOINT: nothing to get without waiting */
+	zassert_equal(k_queue_get_batch(&queue, rx_data, ARRAY_SIZE(rx_data),
+					K_NO_WAIT), 0);
+
+	for (int i = 0; i < LIST_LEN; i++) {
+		k_queue_append(&queue, (void *)&data[i]);
+		k_queue_append(&queue, (void *)&data_p[i]);
+	}
+
+	/**TESTPOINT: no more data items than requested, in order */
+	zassert_equal(k_queue_get_batch(&queue, rx_data, 0, K_NO_WAIT), 0);
+	count = k_queue_get_batch(&queue, rx_data, 3, K_NO_WAIT);
+	zassert_equal(count, 3);
+	zassert_equal(rx_data[0], (void *)&data[0]);
+	zassert_equal(rx_data[1], (void *)&data_p[0]);
+	zassert_equal(rx_data[2], (void *)&data[1]);
+
+	count = k_queue_get_batch(&queue, rx_data, ARRAY_SIZE(rx_data), K_NO_WAIT);
+	zassert_equal(count, 1);
+	zassert_equal(rx_data[0], (void *)&data_p[1]);
+	zassert_true(k_queue_is_empty(&queue));
+
+	/**TESTPOINT: wait for the first data item */
+	k_sem_init(&end_sema, 0, 1);
+	k_tid_t tid = k_thread_create(&tdata, tstack, STACK_SIZE,
+				      tThread_get_batch, &queue, NULL, NULL,
+				      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	k_sleep(K_MSEC(10));
+	k_queue_append(&queue, (void *)&data[0]);
+	k_sem_take(&end_sema, K_FOREVER);
+	k_thread_abort(tid);
+}
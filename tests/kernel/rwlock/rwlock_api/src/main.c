@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel/obj_core.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* The test thread runs at PRIO_MAIN, helper threads preempt it as soon
+ * as they are created and run until they block on the lock.
+ */
+#define PRIO_MAIN   K_PRIO_PREEMPT(8)
+#define PRIO_HIGH   K_PRIO_PREEMPT(1)
+#define PRIO_WRITER K_PRIO_PREEMPT(5)
+#define PRIO_LOW    K_PRIO_PREEMPT(6)
+
+#define NUM_HELPERS 3
+
+K_THREAD_STACK_ARRAY_DEFINE(helper_stack, NUM_HELPERS, STACK_SIZE);
+static struct k_thread helper_thread[NUM_HELPERS];
+
+static struct k_rwlock rwlock;
+K_RWLOCK_DEFINE(user_rwlock);
+
+/* Order in which the helper threads got the lock */
+static char order[NUM_HELPERS + 1];
+static int order_len;
+static int helper_ret[NUM_HELPERS];
+
+static void record(char id)
+{
+	unsigned int key = irq_lock();
+
+	order[order_len++] = id;
+	irq_unlock(key);
+}
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	char id = (char)POINTER_TO_INT(p1);
+	int *ret = p2;
+	k_timeout_t timeout = *(k_timeout_t *)p3;
+
+	*ret = k_rwlock_read_lock(&rwlock, timeout);
+	if (*ret == 0) {
+		record(id);
+		k_rwlock_read_unlock(&rwlock);
+	}
+}
+
+static void writer_entry(void *p1, void *p2, void *p3)
+{
+	char id = (char)POINTER_TO_INT(p1);
+	int *ret = p2;
+	k_timeout_t timeout = *(k_timeout_t *)p3;
+
+	*ret = k_rwlock_write_lock(&rwlock, timeout);
+	if (*ret == 0) {
+		record(id);
+		k_rwlock_write_unlock(&rwlock);
+	}
+}
+
+static k_timeout_t forever = K_FOREVER;
+static k_timeout_t no_wait = K_NO_WAIT;
+static k_timeout_t short_wait = K_MSEC(10);
+
+static void spawn(int idx, k_thread_entry_t entry, char id, int prio,
+		  k_timeout_t *timeout)
+{
+	k_thread_create(&helper_thread[idx], helper_stack[idx], STACK_SIZE,
+			entry, INT_TO_POINTER(id), &helper_ret[idx], timeout,
+			prio, 0, K_NO_WAIT);
+}
+
+static void join_helpers(int count)
+{
+	for (int i = 0; i < count; i++) {
+		k_thread_join(&helper_thread[i], K_FOREVER);
+	}
+}
+
+/**
+ * @brief Test that any number of threads can read at the same time
+ */
+ZTEST(rwlock_api, test_rwlock_concurrent_readers)
+{
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+
+	spawn(0, reader_entry, 'a', PRIO_HIGH, &no_wait);
+	spawn(1, reader_entry, 'b', PRIO_LOW, &no_wait);
+	join_helpers(2);
+
+	zassert_ok(helper_ret[0]);
+	zassert_ok(helper_ret[1]);
+	zassert_str_equal(order, "ab");
+
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+}
+
+/**
+ * @brief Test that a writer excludes both readers and other writers
+ */
+ZTEST(rwlock_api, test_rwlock_writer_exclusion)
+{
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+
+	spawn(0, reader_entry, 'a', PRIO_HIGH, &no_wait);
+	spawn(1, writer_entry, 'b', PRIO_HIGH, &no_wait);
+	join_helpers(2);
+
+	zassert_equal(helper_ret[0], -EBUSY);
+	zassert_equal(helper_ret[1], -EBUSY);
+	zassert_str_equal(order, "");
+
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+
+	/* Readers keep writers out as well */
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	spawn(0, writer_entry, 'a', PRIO_HIGH, &no_wait);
+	join_helpers(1);
+	zassert_equal(helper_ret[0], -EBUSY);
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+}
+
+/**
+ * @brief Test the errors returned for misuse of the lock
+ */
+ZTEST(rwlock_api, test_rwlock_errors)
+{
+	zassert_equal(k_rwlock_write_unlock(&rwlock), -EPERM);
+	zassert_equal(k_rwlock_read_unlock(&rwlock), -EINVAL);
+
+	/* An unbalanced unlock leaves the lock usable */
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	zassert_equal(k_rwlock_read_unlock(&rwlock), -EINVAL);
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+	zassert_equal(k_rwlock_read_unlock(&rwlock), -EINVAL);
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_FOREVER), -EDEADLK);
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_FOREVER), -EDEADLK);
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+	zassert_equal(k_rwlock_write_unlock(&rwlock), -EPERM);
+}
+
+static void foreign_unlock_entry(void *p1, void *p2, void *p3)
+{
+	int *ret = p2;
+
+	*ret = k_rwlock_write_unlock(&rwlock);
+}
+
+/**
+ * @brief Test that only the writer can release a lock held for writing
+ */
+ZTEST(rwlock_api, test_rwlock_write_unlock_not_owner)
+{
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+
+	spawn(0, foreign_unlock_entry, 'a', PRIO_HIGH, &no_wait);
+	join_helpers(1);
+	zassert_equal(helper_ret[0], -EPERM);
+
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+}
+
+/**
+ * @brief Test that waiting for the lock times out
+ */
+ZTEST(rwlock_api, test_rwlock_timeout)
+{
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+	spawn(0, reader_entry, 'a', PRIO_HIGH, &short_wait);
+	join_helpers(1);
+	zassert_equal(helper_ret[0], -EAGAIN);
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	spawn(0, writer_entry, 'a', PRIO_HIGH, &short_wait);
+	join_helpers(1);
+	zassert_equal(helper_ret[0], -EAGAIN);
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+
+	zassert_str_equal(order, "");
+}
+
+/**
+ * @brief Test that a waiting writer holds back new readers of lower or
+ * equal priority, but not more important ones
+ */
+ZTEST(rwlock_api, test_rwlock_writer_preference)
+{
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+
+	spawn(0, writer_entry, 'w', PRIO_WRITER, &forever);
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), -EBUSY);
+
+	/* A reader more important than the writer is not held back */
+	spawn(1, reader_entry, 'h', PRIO_HIGH, &forever);
+	zassert_str_equal(order, "h");
+
+	/* A less important one is */
+	spawn(2, reader_entry, 'l', PRIO_LOW, &forever);
+	zassert_str_equal(order, "h");
+
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	join_helpers(3);
+
+	zassert_str_equal(order, "hwl");
+}
+
+/**
+ * @brief Test that a released lock goes to the most important waiters
+ */
+ZTEST(rwlock_api, test_rwlock_priority_wakeup)
+{
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+
+	spawn(0, reader_entry, 'l', PRIO_LOW, &forever);
+	spawn(1, writer_entry, 'w', PRIO_WRITER, &forever);
+	spawn(2, reader_entry, 'h', PRIO_HIGH, &forever);
+	zassert_str_equal(order, "");
+
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+	join_helpers(3);
+
+	zassert_str_equal(order, "hwl");
+}
+
+/**
+ * @brief Test that readers held back by a writer go ahead once it gives up
+ */
+ZTEST(rwlock_api, test_rwlock_writer_timeout_releases_readers)
+{
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+
+	spawn(0, writer_entry, 'w', PRIO_WRITER, &short_wait);
+	spawn(1, reader_entry, 'l', PRIO_LOW, &forever);
+	zassert_str_equal(order, "");
+
+	join_helpers(2);
+	zassert_equal(helper_ret[0], -EAGAIN);
+	zassert_ok(helper_ret[1]);
+	zassert_str_equal(order, "l");
+
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+}
+
+/**
+ * @brief Test the lock from a user mode thread
+ */
+ZTEST_USER(rwlock_api, test_rwlock_user)
+{
+	zassert_ok(k_rwlock_read_lock(&user_rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_lock(&user_rwlock, K_NO_WAIT));
+	zassert_equal(k_rwlock_write_lock(&user_rwlock, K_NO_WAIT), -EBUSY);
+	zassert_ok(k_rwlock_read_unlock(&user_rwlock));
+	zassert_ok(k_rwlock_read_unlock(&user_rwlock));
+
+	zassert_ok(k_rwlock_write_lock(&user_rwlock, K_NO_WAIT));
+	zassert_equal(k_rwlock_read_lock(&user_rwlock, K_MSEC(1)), -EDEADLK);
+	zassert_ok(k_rwlock_write_unlock(&user_rwlock));
+}
+
+/**
+ * @brief Test the object core statistics of the lock
+ */
+ZTEST(rwlock_api, test_rwlock_stats)
+{
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	struct k_rwlock_stats stats;
+
+	zassert_ok(k_obj_core_stats_reset(K_OBJ_CORE(&rwlock)));
+
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	spawn(0, writer_entry, 'w', PRIO_WRITER, &forever);
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	join_helpers(1);
+
+	zassert_ok(k_obj_core_stats_query(K_OBJ_CORE(&rwlock), &stats,
+					  sizeof(stats)));
+	zassert_equal(stats.read_locks, 2);
+	zassert_equal(stats.write_locks, 1);
+	zassert_equal(stats.read_waits, 0);
+	zassert_equal(stats.write_waits, 1);
+
+	zassert_ok(k_obj_core_stats_reset(K_OBJ_CORE(&rwlock)));
+	zassert_ok(k_obj_core_stats_query(K_OBJ_CORE(&rwlock), &stats,
+					  sizeof(stats)));
+	zassert_equal(stats.read_locks, 0);
+	zassert_equal(stats.write_locks, 0);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+}
+
+static void rwlock_api_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_rwlock_init(&rwlock);
+	memset(order, 0, sizeof(order));
+	order_len = 0;
+
+	k_thread_priority_set(k_current_get(), PRIO_MAIN);
+}
+
+static void *rwlock_api_setup(void)
+{
+	k_thread_access_grant(k_current_get(), &user_rwlock);
+
+	return NULL;
+}
+
+ZTEST_SUITE(rwlock_api, NULL, rwlock_api_setup, rwlock_api_before, NULL, NULL);
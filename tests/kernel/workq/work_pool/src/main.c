@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_WORKERS 3
+
+/* Workers preempt the test thread as soon as there is work for them */
+#define WORKER_PRIO K_PRIO_PREEMPT(2)
+#define TEST_PRIO   K_PRIO_PREEMPT(4)
+
+#define NUM_ITEMS 4
+#define SLEEP_MS  10
+
+static K_KERNEL_STACK_ARRAY_DEFINE(pool_stacks, NUM_WORKERS, STACK_SIZE);
+static struct k_work_q_worker pool_workers[NUM_WORKERS];
+static struct k_work_q pool;
+
+/* Work items block on release_sem until the test gives it */
+static struct k_sem release_sem;
+static struct k_sem done_sem;
+
+static struct k_work items[NUM_ITEMS];
+static struct k_work chained_work;
+static struct k_work_sync work_sync;
+
+static atomic_t running;
+static atomic_t max_running;
+static atomic_t runs[NUM_ITEMS];
+static atomic_t overlaps;
+static k_tid_t runner[NUM_ITEMS];
+
+static void enter(int idx)
+{
+	atomic_val_t now = atomic_inc(&running) + 1;
+	atomic_val_t max;
+
+	do {
+		max = atomic_get(&max_running);
+	} while ((now > max) && !atomic_cas(&max_running, max, now));
+
+	/* An item must never run on two workers at once */
+	if (atomic_inc(&runs[idx]) != 0) {
+		atomic_inc(&overlaps);
+	}
+	runner[idx] = k_current_get();
+}
+
+static void leave(int idx)
+{
+	atomic_dec(&runs[idx]);
+	atomic_dec(&running);
+	k_sem_give(&done_sem);
+}
+
+static void blocking_handler(struct k_work *work)
+{
+	int idx = work - items;
+
+	enter(idx);
+	k_sem_take(&release_sem, K_FOREVER);
+	leave(idx);
+}
+
+/* Items started together complete one after the other */
+static void sleeping_handler(struct k_work *work)
+{
+	int idx = work - items;
+
+	enter(idx);
+	k_msleep(SLEEP_MS * (idx + 1));
+	leave(idx);
+}
+
+static void chained_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_sem_give(&done_sem);
+}
+
+static void submitting_handler(struct k_work *work)
+{
+	int idx = work - items;
+
+	enter(idx);
+	zassert_equal(k_work_submit_to_queue(&pool, &chained_work), 1);
+	k_sem_take(&release_sem, K_FOREVER);
+	leave(idx);
+}
+
+static bool is_worker(k_tid_t tid)
+{
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		if (tid == &pool_workers[i].thread) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void init_items(k_work_handler_t handler)
+{
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i], handler);
+	}
+}
+
+/**
+ * @brief Test that the workers of a pool run different items at once
+ */
+ZTEST(work_pool, test_pool_parallel)
+{
+	init_items(blocking_handler);
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		zassert_equal(k_work_submit_to_queue(&pool, &items[i]), 1);
+	}
+
+	zassert_equal(atomic_get(&running), NUM_WORKERS);
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		zassert_true(is_worker(runner[i]));
+		for (int j = 0; j < i; j++) {
+			zassert_not_equal(runner[i], runner[j]);
+		}
+	}
+
+	/* Every worker is busy, so the last item has to wait */
+	zassert_equal(k_work_submit_to_queue(&pool, &items[NUM_WORKERS]), 1);
+	zassert_equal(k_work_busy_get(&items[NUM_WORKERS]), K_WORK_QUEUED);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_sem_give(&release_sem);
+		zassert_ok(k_sem_take(&done_sem, K_FOREVER));
+	}
+
+	zassert_equal(atomic_get(&max_running), NUM_WORKERS);
+	zassert_equal(atomic_get(&overlaps), 0);
+}
+
+/**
+ * @brief Test that an item resubmitted while it runs is not run by an
+ * idle worker until the first run completes
+ */
+ZTEST(work_pool, test_pool_no_self_concurrency)
+{
+	init_items(blocking_handler);
+
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0]), 1);
+	zassert_equal(k_work_busy_get(&items[0]), K_WORK_RUNNING);
+
+	/* Other workers are idle, but must leave the item alone */
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0]), 2);
+	zassert_equal(k_work_busy_get(&items[0]), K_WORK_RUNNING | K_WORK_QUEUED);
+	zassert_equal(atomic_get(&running), 1);
+
+	k_sem_give(&release_sem);
+	zassert_ok(k_sem_take(&done_sem, K_FOREVER));
+	k_sem_give(&release_sem);
+	zassert_ok(k_sem_take(&done_sem, K_FOREVER));
+
+	zassert_equal(atomic_get(&overlaps), 0);
+	zassert_equal(k_work_busy_get(&items[0]), 0);
+}
+
+/**
+ * @brief Test items resubmitted over and over while they run
+ */
+ZTEST(work_pool, test_pool_resubmit_stress)
+{
+	init_items(sleeping_handler);
+
+	for (int n = 0; n < 20; n++) {
+		for (int i = 0; i < NUM_ITEMS; i++) {
+			(void)k_work_submit_to_queue(&pool, &items[i]);
+		}
+		k_yield();
+	}
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		(void)k_work_flush(&items[i], &work_sync);
+		zassert_equal(k_work_busy_get(&items[i]), 0);
+	}
+
+	zassert_equal(atomic_get(&overlaps), 0);
+}
+
+/**
+ * @brief Test that items submitted by a worker run after its current item
+ * or on an idle worker
+ */
+ZTEST(work_pool, test_pool_chained)
+{
+	init_items(submitting_handler);
+	k_work_init(&chained_work, chained_handler);
+
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0]), 1);
+
+	/* An idle worker takes over the chained item */
+	zassert_ok(k_sem_take(&done_sem, K_MSEC(100)));
+	zassert_equal(atomic_get(&running), 1);
+
+	k_sem_give(&release_sem);
+	zassert_ok(k_sem_take(&done_sem, K_FOREVER));
+}
+
+/**
+ * @brief Test flushing items running and queued on a pool
+ */
+ZTEST(work_pool, test_pool_flush)
+{
+	init_items(sleeping_handler);
+
+	zassert_false(k_work_flush(&items[0], &work_sync));
+
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0]), 1);
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0]), 2);
+
+	/* The flush completes once the second run completes */
+	zassert_true(k_work_flush(&items[0], &work_sync));
+	zassert_equal(k_work_busy_get(&items[0]), 0);
+	zassert_equal(k_sem_count_get(&done_sem), 2);
+	zassert_equal(atomic_get(&overlaps), 0);
+}
+
+/**
+ * @brief Test cancelling items running and queued on a pool
+ */
+ZTEST(work_pool, test_pool_cancel)
+{
+	init_items(sleeping_handler);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_submit_to_queue(&pool, &items[i]), 1);
+	}
+
+	/* The last item is still queued and goes away at once */
+	zassert_equal(k_work_cancel(&items[NUM_ITEMS - 1]), 0);
+	zassert_false(k_work_cancel_sync(&items[NUM_ITEMS - 1], &work_sync));
+
+	/* The others complete before the cancel returns */
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		zassert_true(k_work_cancel_sync(&items[i], &work_sync));
+		zassert_equal(k_work_busy_get(&items[i]), 0);
+	}
+
+	zassert_equal(k_sem_count_get(&done_sem), NUM_WORKERS);
+}
+
+/**
+ * @brief Test that a drain waits for items queued behind a running item
+ */
+ZTEST(work_pool, test_pool_drain_requeued)
+{
+	init_items(sleeping_handler);
+
+	/* The second run stays on the worker running the first one, where
+	 * the idle workers may not take it over.
+	 */
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0]), 1);
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0]), 2);
+
+	zassert_true(k_work_queue_drain(&pool, false) >= 0);
+	zassert_equal(k_work_busy_get(&items[0]), 0);
+	zassert_equal(k_sem_count_get(&done_sem), 2);
+}
+
+/**
+ * @brief Test draining and stopping a pool
+ */
+ZTEST(work_pool, test_pool_drain_stop)
+{
+	init_items(sleeping_handler);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_submit_to_queue(&pool, &items[i]), 1);
+	}
+
+	zassert_equal(k_work_queue_stop(&pool, K_FOREVER), -EBUSY);
+	zassert_true(k_work_queue_drain(&pool, true) >= 0);
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_busy_get(&items[i]), 0);
+	}
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0]), -EBUSY);
+
+	zassert_ok(k_work_queue_stop(&pool, K_FOREVER));
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		zassert_ok(k_thread_join(&pool_workers[i].thread, K_NO_WAIT));
+	}
+	zassert_equal(k_work_queue_stop(&pool, K_FOREVER), -EALREADY);
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0]), -ENODEV);
+}
+
+/**
+ * @brief Test the system work queue when it runs as a pool
+ */
+ZTEST(work_pool, test_pool_system_workqueue)
+{
+	if (CONFIG_SYSTEM_WORKQUEUE_NUM_WORKERS < 2) {
+		ztest_test_skip();
+	}
+
+	init_items(blocking_handler);
+
+	for (int i = 0; i < 2; i++) {
+		zassert_equal(k_work_submit(&items[i]), 1);
+	}
+	zassert_equal(atomic_get(&max_running), 2);
+
+	for (int i = 0; i < 2; i++) {
+		k_sem_give(&release_sem);
+		zassert_ok(k_sem_take(&done_sem, K_FOREVER));
+	}
+}
+
+static void work_pool_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_sem_init(&release_sem, 0, K_SEM_MAX_LIMIT);
+	k_sem_init(&done_sem, 0, K_SEM_MAX_LIMIT);
+
+	atomic_clear(&running);
+	atomic_clear(&max_running);
+	atomic_clear(&overlaps);
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		atomic_clear(&runs[i]);
+		runner[i] = NULL;
+	}
+
+	k_thread_priority_set(k_current_get(), TEST_PRIO);
+
+	/* Start the pool again after test_pool_drain_stop */
+	if (k_work_queue_stop(&pool, K_NO_WAIT) == -EALREADY) {
+		static const struct k_work_queue_config cfg = {
+			.name = "wq.pool",
+			.pin_workers = true,
+		};
+
+		k_work_queue_init(&pool);
+		k_work_queue_start_pool(&pool, pool_workers, NUM_WORKERS,
+					(k_thread_stack_t *)pool_stacks, STACK_SIZE,
+					WORKER_PRIO, &cfg);
+	}
+}
+
+ZTEST_SUITE(work_pool, NULL, NULL, work_pool_before, NULL, NULL);
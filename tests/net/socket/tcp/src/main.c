@@ -303,6 +303,9 @@ ZTEST_USER(net_socket_tcp, test_v6_send_recv)
 
 #define TCP_SERVER_STACK_SIZE 2048
 
+/* Congestion control algorithm of the sending socket, default if NULL */
+static const char *test_congestion;
+
 K_THREAD_STACK_DEFINE(tcp_server_stack_area, TCP_SERVER_STACK_SIZE);
 struct k_thread tcp_server_thread_data;
 
@@ -384,6 +387,12 @@ void test_send_recv_large_common(int tcp_nodelay, int family)
 		zassert_unreachable();
 	}
 
+	if (test_congestion != NULL) {
+		rv = zsock_setsockopt(c_sock, IPPROTO_TCP, TCP_CONGESTION, test_congestion,
+				      strlen(test_congestion));
+		zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+	}
+
 	test_bind(s_sock, s_saddr, addrlen);
 	test_listen(s_sock);
 
@@ -490,6 +499,83 @@ ZTEST(net_socket_tcp, test_v6_send_recv_large_no_delay)
 	restore_packet_loss_ratio();
 }
 
+#ifdef CONFIG_NET_LOOPBACK_SIMULATE_PACKET_DELAY
+/* Emulate a link with some latency and losses, like netem would */
+#define TEST_LINK_DELAY_MS 5
+
+static void test_send_recv_large_congestion(const char *algorithm)
+{
+	test_congestion = algorithm;
+	zassert_equal(loopback_set_packet_delay(TEST_LINK_DELAY_MS), 0,
+		      "Error setting packet delay");
+	set_packet_loss_ratio();
+
+	test_send_recv_large_common(0, AF_INET);
+
+	restore_packet_loss_ratio();
+	zassert_equal(loopback_set_packet_delay(0), 0, "Error setting packet delay");
+	test_congestion = NULL;
+}
+
+ZTEST(net_socket_tcp, test_v4_send_recv_large_reno)
+{
+	test_send_recv_large_congestion("reno");
+}
+
+ZTEST(net_socket_tcp, test_v4_send_recv_large_cubic)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_CONGESTION_CUBIC);
+
+	test_send_recv_large_congestion("cubic");
+}
+
+ZTEST(net_socket_tcp, test_v4_send_recv_large_bbr)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_CONGESTION_BBR);
+
+	test_send_recv_large_congestion("bbr");
+}
+#endif /* CONFIG_NET_LOOPBACK_SIMULATE_PACKET_DELAY */
+
+ZTEST(net_socket_tcp, test_tcp_congestion)
+{
+	struct sockaddr_in addr;
+	char name[16];
+	socklen_t optlen;
+	int sock;
+	int rv;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_CONGESTION_CUBIC);
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &sock, &addr);
+
+	optlen = sizeof(name);
+	rv = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(rv, 0, "getsockopt failed (%d)", errno);
+	zassert_str_equal(name, "reno", "Unexpected default algorithm %s", name);
+
+	rv = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "cubic", strlen("cubic"));
+	zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+
+	optlen = sizeof(name);
+	rv = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(rv, 0, "getsockopt failed (%d)", errno);
+	zassert_str_equal(name, "cubic", "Unexpected algorithm %s", name);
+	zassert_equal(optlen, sizeof("cubic"), "Unexpected optlen %zu", optlen);
+
+	rv = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "unknown", strlen("unknown"));
+	zassert_equal(rv, -1, "setsockopt of an unknown algorithm succeeded");
+	zassert_equal(errno, ENOENT, "Unexpected errno %d", errno);
+
+	optlen = sizeof(name);
+	rv = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(rv, 0, "getsockopt failed (%d)", errno);
+	zassert_str_equal(name, "cubic", "Algorithm changed to %s", name);
+
+	test_close(sock);
+	test_context_cleanup();
+}
+
 ZTEST(net_socket_tcp, test_v4_broken_link)
 {
 	/* Test if the data stops transmitting after the send returned with a timeout. */
@@ -1422,6 +1508,182 @@ ZTEST(net_socket_tcp, test_so_rcvbuf_win_size)
 	test_context_cleanup();
 }
 
+static void test_recvmsg_zc_connect(int *c_sock, int *s_sock, int *new_sock)
+{
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, s_sock, &s_saddr);
+
+	test_bind(*s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(*s_sock);
+
+	test_connect(*c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+
+	test_accept(*s_sock, new_sock, &addr, &addrlen);
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "wrong addrlen");
+}
+
+ZTEST(net_socket_tcp, test_v4_recvmsg_zc_partial)
+{
+	static char rx_buf[sizeof(TEST_STR_LONG)];
+	struct zsock_rx_loan loan;
+	struct iovec iov;
+	struct msghdr msg;
+	size_t received;
+	int new_sock;
+	int c_sock;
+	int s_sock;
+	ssize_t rv;
+
+	test_recvmsg_zc_connect(&c_sock, &s_sock, &new_sock);
+
+	test_send(c_sock, TEST_STR_LONG, strlen(TEST_STR_LONG), 0);
+
+	/* The data is larger than a network buffer, so that a single iovec
+	 * cannot describe all of it.
+	 */
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+
+	rv = zsock_recvmsg_zc(new_sock, &msg, 0, &loan);
+	zassert_true(rv > 0, "recvmsg_zc failed (%d)", errno);
+	zassert_true((size_t)rv < strlen(TEST_STR_LONG), "all the data lent");
+	zassert_equal(msg.msg_iovlen, 1, "wrong number of iovecs");
+	zassert_equal(iov.iov_len, rv, "wrong length lent");
+	zassert_mem_equal(iov.iov_base, TEST_STR_LONG, rv, "wrong data");
+
+	/* The rest is left queued, past the data lent */
+	received = rv;
+	while (received < strlen(TEST_STR_LONG)) {
+		rv = zsock_recv(new_sock, rx_buf + received,
+				strlen(TEST_STR_LONG) - received, 0);
+		zassert_true(rv > 0, "recv failed (%d)", errno);
+		received += rv;
+	}
+
+	zassert_mem_equal(rx_buf + iov.iov_len, TEST_STR_LONG + iov.iov_len,
+			  strlen(TEST_STR_LONG) - iov.iov_len, "wrong data");
+
+	/* Still valid until given back */
+	zassert_mem_equal(iov.iov_base, TEST_STR_LONG, iov.iov_len, "wrong data");
+
+	rv = zsock_recvmsg_zc_release(&loan);
+	zassert_equal(rv, 0, "release failed");
+
+	rv = zsock_recv(new_sock, rx_buf, sizeof(rx_buf), ZSOCK_MSG_DONTWAIT);
+	zassert_equal(rv, -1, "data left queued");
+	zassert_equal(errno, EAGAIN, "Unexpected errno value: %d", errno);
+
+	test_close(c_sock);
+	test_close(new_sock);
+	test_close(s_sock);
+
+	test_context_cleanup();
+}
+
+ZTEST(net_socket_tcp, test_v4_recvmsg_zc_window)
+{
+	char tx_buf[] = TEST_STR_SMALL;
+	int buf_optval = sizeof(TEST_STR_SMALL);
+	struct zsock_rx_loan loan;
+	struct iovec iov[4];
+	struct msghdr msg;
+	int new_sock;
+	int c_sock;
+	int s_sock;
+	ssize_t rv;
+
+	test_recvmsg_zc_connect(&c_sock, &s_sock, &new_sock);
+
+	/* Lower server-side RX window size. */
+	rv = zsock_setsockopt(new_sock, SOL_SOCKET, SO_RCVBUF, &buf_optval,
+			      sizeof(buf_optval));
+	zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+
+	rv = zsock_send(c_sock, tx_buf, sizeof(tx_buf), ZSOCK_MSG_DONTWAIT);
+	zassert_equal(rv, sizeof(tx_buf), "Unexpected return code %d", rv);
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = iov;
+	msg.msg_iovlen = ARRAY_SIZE(iov);
+
+	rv = zsock_recvmsg_zc(new_sock, &msg, 0, &loan);
+	zassert_equal(rv, sizeof(tx_buf), "recvmsg_zc failed (%d)", errno);
+
+	/* Wait for the ACK of the full window, which would be followed by a
+	 * window update if the data lent was counted as consumed.
+	 */
+	k_msleep(150);
+
+	/* Client should not be able to send now (RX window full). */
+	rv = zsock_send(c_sock, tx_buf, 1, ZSOCK_MSG_DONTWAIT);
+	zassert_equal(rv, -1, "window reopened before the loan was given back");
+	zassert_equal(errno, EAGAIN, "Unexpected errno value: %d", errno);
+
+	rv = zsock_recvmsg_zc_release(&loan);
+	zassert_equal(rv, 0, "release failed");
+
+	/* Wait for the window update */
+	k_msleep(150);
+
+	rv = zsock_send(c_sock, tx_buf, 1, ZSOCK_MSG_DONTWAIT);
+	zassert_equal(rv, 1, "window not reopened by the release (%d)", errno);
+
+	test_close(c_sock);
+	test_close(new_sock);
+	test_close(s_sock);
+
+	test_context_cleanup();
+}
+
+ZTEST(net_socket_tcp, test_v4_recvmsg_zc_release_after_close)
+{
+	struct zsock_rx_loan loan;
+	struct iovec iov[4];
+	struct msghdr msg;
+	size_t received = 0;
+	char rx_buf[sizeof(TEST_STR_SMALL)];
+	int new_sock;
+	int c_sock;
+	int s_sock;
+	ssize_t rv;
+
+	test_recvmsg_zc_connect(&c_sock, &s_sock, &new_sock);
+
+	test_send(c_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0);
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = iov;
+	msg.msg_iovlen = ARRAY_SIZE(iov);
+
+	rv = zsock_recvmsg_zc(new_sock, &msg, 0, &loan);
+	zassert_equal(rv, strlen(TEST_STR_SMALL), "recvmsg_zc failed (%d)", errno);
+
+	test_close(c_sock);
+	test_close(new_sock);
+	test_close(s_sock);
+
+	/* The data stays valid after close() until the loan is given back */
+	for (size_t i = 0; i < msg.msg_iovlen; i++) {
+		memcpy(rx_buf + received, iov[i].iov_base, iov[i].iov_len);
+		received += iov[i].iov_len;
+	}
+
+	zassert_equal(received, strlen(TEST_STR_SMALL), "wrong length lent");
+	zassert_mem_equal(rx_buf, TEST_STR_SMALL, strlen(TEST_STR_SMALL), "wrong data");
+
+	rv = zsock_recvmsg_zc_release(&loan);
+	zassert_equal(rv, 0, "release failed");
+
+	/* The context of the socket is only freed once the loan is given back */
+	test_context_cleanup();
+}
+
 ZTEST(net_socket_tcp, test_so_sndbuf)
 {
 	struct sockaddr_in bind_addr4;
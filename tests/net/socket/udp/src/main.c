@@ -3112,6 +3112,256 @@ ZTEST(net_socket_udp, test_40_clamp_udp_tcp_port_range)
 #endif
 }
 
+#define MMSG_COUNT 4
+
+ZTEST_USER(net_socket_udp, test_41_v4_sendmmsg_recvmmsg)
+{
+	static const char *const msgs[MMSG_COUNT] = {
+		"one", "two", "three", "four",
+	};
+	struct mmsghdr tx_msgs[MMSG_COUNT] = { 0 };
+	struct mmsghdr rx_msgs[MMSG_COUNT + 1] = { 0 };
+	struct iovec tx_iov[MMSG_COUNT];
+	struct iovec rx_iov[MMSG_COUNT + 1];
+	char bufs[MMSG_COUNT + 1][16];
+	struct sockaddr_in client_addr;
+	struct sockaddr_in6 addr;
+	struct sockaddr_in server_addr;
+	int client_sock;
+	int server_sock;
+	int rv;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	rv = zsock_connect(client_sock, (struct sockaddr *)&server_addr,
+			   sizeof(server_addr));
+	zassert_equal(rv, 0, "connect failed");
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		tx_iov[i].iov_base = (void *)msgs[i];
+		tx_iov[i].iov_len = strlen(msgs[i]);
+		tx_msgs[i].msg_hdr.msg_iov = &tx_iov[i];
+		tx_msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	rv = zsock_sendmmsg(client_sock, tx_msgs, MMSG_COUNT, 0);
+	zassert_equal(rv, MMSG_COUNT, "sendmmsg failed (%d)", errno);
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(tx_msgs[i].msg_len, strlen(msgs[i]),
+			      "wrong length sent for message %d", i);
+	}
+
+	for (int i = 0; i < MMSG_COUNT + 1; i++) {
+		rx_iov[i].iov_base = bufs[i];
+		rx_iov[i].iov_len = sizeof(bufs[i]);
+		rx_msgs[i].msg_hdr.msg_iov = &rx_iov[i];
+		rx_msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	/* Let the datagrams all be delivered, even with preemptive threads */
+	k_msleep(100);
+
+	/* Only the first message is waited for, so the batch ends with the
+	 * datagrams sent, without filling the extra buffer.
+	 */
+	rv = zsock_recvmmsg(server_sock, rx_msgs, MMSG_COUNT + 1,
+			    ZSOCK_MSG_WAITFORONE, NULL);
+	zassert_equal(rv, MMSG_COUNT, "recvmmsg failed (%d)", errno);
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(rx_msgs[i].msg_len, strlen(msgs[i]),
+			      "wrong length received for message %d", i);
+		zassert_mem_equal(bufs[i], msgs[i], strlen(msgs[i]),
+				  "wrong data in message %d", i);
+	}
+
+	rv = zsock_recvmmsg(server_sock, rx_msgs, MMSG_COUNT,
+			    ZSOCK_MSG_DONTWAIT, NULL);
+	zassert_equal(rv, -1, "recvmmsg should have failed");
+	zassert_equal(errno, EAGAIN, "incorrect errno");
+
+	/* An empty datagram still reports where it came from */
+	rv = zsock_send(client_sock, bufs[0], 0, 0);
+	zassert_equal(rv, 0, "send failed (%d)", errno);
+
+	memset(&addr, 0, sizeof(addr));
+	rx_msgs[0].msg_hdr.msg_name = &addr;
+	rx_msgs[0].msg_hdr.msg_namelen = sizeof(addr);
+	rx_msgs[0].msg_len = sizeof(bufs[0]);
+
+	rv = zsock_recvmmsg(server_sock, rx_msgs, 1, 0, NULL);
+	zassert_equal(rv, 1, "recvmmsg failed (%d)", errno);
+	zassert_equal(rx_msgs[0].msg_len, 0, "empty datagram has data");
+	zassert_equal(rx_msgs[0].msg_hdr.msg_namelen, sizeof(struct sockaddr_in),
+		      "wrong address length");
+	zassert_equal(((struct sockaddr_in *)&addr)->sin_family, AF_INET,
+		      "wrong address family");
+	zassert_equal(((struct sockaddr_in *)&addr)->sin_addr.s_addr,
+		      client_addr.sin_addr.s_addr, "wrong source address");
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
+ZTEST(net_socket_udp, test_42_v4_udp_segment)
+{
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	socklen_t optlen = sizeof(int);
+	int segment = 64;
+	int client_sock;
+	int server_sock;
+	int value = 0;
+	int rv;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_CONTEXT_UDP_SEGMENT);
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	rv = zsock_connect(client_sock, (struct sockaddr *)&server_addr,
+			   sizeof(server_addr));
+	zassert_equal(rv, 0, "connect failed");
+
+	rv = zsock_setsockopt(client_sock, IPPROTO_UDP, UDP_SEGMENT, &segment,
+			      sizeof(segment));
+	zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+
+	rv = zsock_getsockopt(client_sock, IPPROTO_UDP, UDP_SEGMENT, &value,
+			      &optlen);
+	zassert_equal(rv, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(value, segment, "wrong segment size");
+
+	rv = zsock_send(client_sock, TEST_STR2, STRLEN(TEST_STR2), 0);
+	zassert_equal(rv, STRLEN(TEST_STR2), "send failed (%d)", errno);
+
+	/* Each segment is received as a datagram of its own */
+	for (size_t offset = 0; offset < STRLEN(TEST_STR2); offset += segment) {
+		size_t len = MIN((size_t)segment, STRLEN(TEST_STR2) - offset);
+
+		clear_buf(rx_buf);
+		rv = zsock_recv(server_sock, rx_buf, sizeof(rx_buf), 0);
+		zassert_equal(rv, len, "unexpected received bytes");
+		zassert_mem_equal(rx_buf, TEST_STR2 + offset, len, "wrong data");
+	}
+
+	rv = zsock_recv(server_sock, rx_buf, sizeof(rx_buf), ZSOCK_MSG_DONTWAIT);
+	zassert_equal(rv, -1, "recv should have failed");
+	zassert_equal(errno, EAGAIN, "incorrect errno");
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
+ZTEST(net_socket_udp, test_43_v4_recvmsg_zc)
+{
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_in src_addr;
+	struct zsock_rx_loan loan;
+	struct iovec iov[4];
+	struct msghdr msg;
+	size_t received = 0;
+	int client_sock;
+	int server_sock;
+	int rv;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(client_sock, (struct sockaddr *)&client_addr,
+			sizeof(client_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	rv = zsock_sendto(client_sock, TEST_STR2, STRLEN(TEST_STR2), 0,
+			  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, STRLEN(TEST_STR2), "sendto failed (%d)", errno);
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = iov;
+	msg.msg_iovlen = ARRAY_SIZE(iov);
+	msg.msg_name = &src_addr;
+	msg.msg_namelen = sizeof(src_addr);
+
+	rv = zsock_recvmsg_zc(server_sock, &msg, 0, &loan);
+	zassert_equal(rv, STRLEN(TEST_STR2), "recvmsg_zc failed (%d)", errno);
+	zassert_equal(msg.msg_flags, 0, "unexpected flags");
+	zassert_equal(msg.msg_namelen, sizeof(struct sockaddr_in),
+		      "wrong address length");
+	zassert_equal(src_addr.sin_port, client_addr.sin_port, "wrong port");
+
+	/* The data lent may span several fragments */
+	clear_buf(rx_buf);
+	for (size_t i = 0; i < msg.msg_iovlen; i++) {
+		memcpy(rx_buf + received, iov[i].iov_base, iov[i].iov_len);
+		received += iov[i].iov_len;
+	}
+
+	zassert_equal(received, STRLEN(TEST_STR2), "wrong length lent");
+	zassert_mem_equal(rx_buf, TEST_STR2, STRLEN(TEST_STR2), "wrong data");
+
+	rv = zsock_recvmsg_zc_release(&loan);
+	zassert_equal(rv, 0, "release failed");
+
+	/* Giving back twice is harmless */
+	rv = zsock_recvmsg_zc_release(&loan);
+	zassert_equal(rv, 0, "release failed");
+
+	/* A datagram larger than the iovecs is truncated */
+	rv = zsock_sendto(client_sock, TEST_STR2, STRLEN(TEST_STR2), 0,
+			  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, STRLEN(TEST_STR2), "sendto failed (%d)", errno);
+
+	msg.msg_name = NULL;
+	msg.msg_iovlen = 1;
+
+	rv = zsock_recvmsg_zc(server_sock, &msg, 0, &loan);
+	zassert_true(rv > 0, "recvmsg_zc failed (%d)", errno);
+	zassert_equal(msg.msg_iovlen, 1, "wrong number of iovecs");
+	zassert_equal(iov[0].iov_len, rv, "wrong length lent");
+	zassert_mem_equal(iov[0].iov_base, TEST_STR2, rv, "wrong data");
+
+	if (rv < STRLEN(TEST_STR2)) {
+		zassert_equal(msg.msg_flags, ZSOCK_MSG_TRUNC, "not truncated");
+	}
+
+	rv = zsock_recvmsg_zc_release(&loan);
+	zassert_equal(rv, 0, "release failed");
+
+	msg.msg_iovlen = ARRAY_SIZE(iov);
+
+	rv = zsock_recvmsg_zc(server_sock, &msg, ZSOCK_MSG_DONTWAIT, &loan);
+	zassert_equal(rv, -1, "recvmsg_zc should have failed");
+	zassert_equal(errno, EAGAIN, "incorrect errno");
+
+	rv = zsock_recvmsg_zc(server_sock, &msg, ZSOCK_MSG_PEEK, &loan);
+	zassert_equal(rv, -1, "recvmsg_zc should have failed");
+	zassert_equal(errno, EINVAL, "incorrect errno");
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
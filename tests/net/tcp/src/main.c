@@ -116,6 +116,8 @@ static enum test_case_no {
 	TEST_CLIENT_FIN_ACK_WITH_DATA = 18,
 	TEST_CLIENT_SEQ_VALIDATION = 19,
 	TEST_SERVER_ACK_VALIDATION = 20,
+	TEST_CLIENT_SACK_IPV4 = 21,
+	TEST_CLIENT_SACK_DATA_IPV4 = 22,
 } test_case_no;
 
 static enum test_state t_state;
@@ -142,6 +144,7 @@ static void handle_syn_invalid_ack(sa_family_t af, struct tcphdr *th);
 static void handle_client_fin_ack_with_data_test(sa_family_t af, struct tcphdr *th);
 static void handle_client_seq_validation_test(sa_family_t af, struct tcphdr *th);
 static void handle_server_ack_validation_test(struct net_pkt *pkt);
+static void handle_client_sack_test(struct net_pkt *pkt);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -239,6 +242,10 @@ static uint8_t tcp_options[20] = {
 	0x01, /* NOP */
 	0x03, 0x03, 0x07 /* Win scale*/ };
 
+/* Options of the next packets sent by the tester, if not empty */
+static uint8_t tester_options[40];
+static size_t tester_options_len;
+
 static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 					      uint16_t src_port,
 					      uint16_t dst_port,
@@ -249,11 +256,16 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct net_pkt *pkt;
 	struct tcphdr *th;
+	const uint8_t *opts = NULL;
 	uint8_t opts_len = 0;
 	int ret = -EINVAL;
 
 	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+		opts = tcp_options;
 		opts_len = sizeof(tcp_options);
+	} else if (tester_options_len > 0) {
+		opts = tester_options;
+		opts_len = tester_options_len;
 	}
 
 	/* Allocate buffer */
@@ -288,11 +300,7 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		th->th_off = 10U;
-	} else {
-		th->th_off = 5U;
-	}
+	th->th_off = 5U + opts_len / 4U;
 
 	th->th_flags = flags;
 	th->th_win = htons(NET_IPV6_MTU);
@@ -307,9 +315,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if (opts_len > 0) {
 		/* Add TCP Options */
-		ret = net_pkt_write(pkt, tcp_options, opts_len);
+		ret = net_pkt_write(pkt, opts, opts_len);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -494,6 +502,10 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_SERVER_ACK_VALIDATION:
 		handle_server_ack_validation_test(pkt);
 		break;
+	case TEST_CLIENT_SACK_IPV4:
+	case TEST_CLIENT_SACK_DATA_IPV4:
+		handle_client_sack_test(pkt);
+		break;
 	default:
 		zassert_true(false, "Undefined test case");
 	}
@@ -3002,4 +3014,420 @@ ZTEST(net_tcp, test_server_ack_validation)
 	net_context_put(accepted_ctx);
 }
 
+/* MSS announced by the tester, below the one of the 127 bytes MTU of the interface */
+#define SACK_SEG_LEN 80
+#define SACK_SEG_COUNT 6
+/* Segments the peer does not receive the first time they are sent */
+#define SACK_SEG_LOST (BIT(0) | BIT(2))
+
+static uint16_t sack_peer_port;
+static uint32_t sack_expected_ack;
+static uint32_t sack_expected_start;
+static uint32_t sack_expected_end;
+static uint8_t sack_seg_sent;
+static uint8_t sack_seg_rcvd;
+static uint8_t sack_seg_rexmit;
+static size_t sack_data_rcvd;
+
+static size_t read_tcp_options(struct net_pkt *pkt, struct tcphdr *th, uint8_t *buf)
+{
+	size_t len = (th->th_off - 5U) * 4U;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt) +
+			 sizeof(struct tcphdr)) < 0 ||
+	    net_pkt_read(pkt, buf, len) < 0) {
+		len = 0;
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	return len;
+}
+
+static const uint8_t *find_tcp_option(const uint8_t *opts, size_t len, uint8_t kind)
+{
+	size_t i = 0;
+
+	while (i < len && opts[i] != NET_TCP_END_OPT) {
+		if (opts[i] == NET_TCP_NOP_OPT) {
+			i++;
+			continue;
+		}
+
+		if (i + 1 >= len || opts[i + 1] < 2) {
+			break;
+		}
+
+		if (opts[i] == kind) {
+			return &opts[i];
+		}
+
+		i += opts[i + 1];
+	}
+
+	return NULL;
+}
+
+/* Acknowledge the received segments, reporting those after a hole in SACK
+ * blocks, like a peer supporting SACK would do.
+ */
+static struct net_pkt *prepare_sack_ack_packet(void)
+{
+	uint8_t *block;
+	uint8_t cum = 0;
+	uint8_t i;
+
+	while (cum < SACK_SEG_COUNT && (sack_seg_rcvd & BIT(cum))) {
+		cum++;
+	}
+
+	ack = device_initial_seq + 1U + cum * SACK_SEG_LEN;
+
+	tester_options[0] = NET_TCP_NOP_OPT;
+	tester_options[1] = NET_TCP_NOP_OPT;
+	tester_options[2] = NET_TCP_SACK_OPT;
+	tester_options_len = 4U;
+
+	for (i = cum; i < SACK_SEG_COUNT; i++) {
+		uint8_t start = i;
+
+		if (!(sack_seg_rcvd & BIT(i))) {
+			continue;
+		}
+
+		while (i < SACK_SEG_COUNT && (sack_seg_rcvd & BIT(i))) {
+			i++;
+		}
+
+		block = &tester_options[tester_options_len];
+		sys_put_be32(device_initial_seq + 1U + start * SACK_SEG_LEN, block);
+		sys_put_be32(device_initial_seq + 1U + i * SACK_SEG_LEN, block + 4);
+		tester_options_len += NET_TCP_SACK_BLOCK_SIZE;
+	}
+
+	tester_options[3] = tester_options_len - 2U;
+
+	if (tester_options_len == 4U) {
+		tester_options_len = 0U;
+	}
+
+	return prepare_ack_packet(AF_INET, htons(MY_PORT), sack_peer_port);
+}
+
+static void handle_client_sack_test(struct net_pkt *pkt)
+{
+	struct net_pkt *reply;
+	const uint8_t *opt;
+	uint8_t opts[40];
+	struct tcphdr th;
+	size_t opts_len;
+	size_t data_len;
+	uint8_t seg;
+
+	zassert_ok(read_tcp_header(pkt, &th), "Cannot read TCP header");
+
+	opts_len = read_tcp_options(pkt, &th, opts);
+	data_len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt) -
+		   net_pkt_ip_opts_len(pkt) - th.th_off * 4U;
+
+	switch (t_state) {
+	case T_SYN:
+		test_verify_flags(&th, SYN);
+		zassert_not_null(find_tcp_option(opts, opts_len, NET_TCP_SACK_PERM_OPT),
+				 "SACK not offered in SYN");
+
+		device_initial_seq = ntohl(th.th_seq);
+		sack_peer_port = th.th_sport;
+		seq = 0U;
+		ack = ntohl(th.th_seq) + 1U;
+
+		/* Small segments so that several of them fit in the window */
+		tester_options[0] = NET_TCP_MSS_OPT;
+		tester_options[1] = NET_TCP_MSS_SIZE;
+		sys_put_be16(SACK_SEG_LEN, &tester_options[2]);
+		tester_options[4] = NET_TCP_NOP_OPT;
+		tester_options[5] = NET_TCP_NOP_OPT;
+		tester_options[6] = NET_TCP_SACK_PERM_OPT;
+		tester_options[7] = NET_TCP_SACK_PERM_SIZE;
+		tester_options_len = 8U;
+
+		reply = prepare_syn_ack_packet(AF_INET, htons(MY_PORT), sack_peer_port);
+		tester_options_len = 0U;
+		seq++;
+		t_state = T_SYN_ACK;
+		break;
+	case T_SYN_ACK:
+		test_verify_flags(&th, ACK);
+		t_state = T_DATA;
+		test_sem_give();
+		return;
+	case T_DATA:
+		/* ACKs of the data sent by the tester */
+		test_verify_flags(&th, ACK);
+		zassert_equal(ntohl(th.th_ack), sack_expected_ack, "Unexpected ACK %u",
+			      ntohl(th.th_ack));
+
+		opt = find_tcp_option(opts, opts_len, NET_TCP_SACK_OPT);
+		if (sack_expected_start == sack_expected_end) {
+			zassert_is_null(opt, "Unexpected SACK option");
+		} else {
+			zassert_not_null(opt, "Missing SACK option");
+			zassert_equal(opt[1], 2U + NET_TCP_SACK_BLOCK_SIZE,
+				      "Unexpected SACK option length %u", opt[1]);
+			zassert_equal(sys_get_be32(&opt[2]), sack_expected_start,
+				      "Unexpected SACK block start");
+			zassert_equal(sys_get_be32(&opt[6]), sack_expected_end,
+				      "Unexpected SACK block end");
+		}
+
+		test_sem_give();
+		return;
+	case T_DATA_ACK:
+		if (data_len == 0) {
+			return;
+		}
+
+		test_verify_flags(&th, PSH | ACK);
+
+		if (test_case_no == TEST_CLIENT_SACK_DATA_IPV4) {
+			/* The SACK block of the out-of-order data queued counts
+			 * against the MSS like any other option.
+			 */
+			zassert_not_null(find_tcp_option(opts, opts_len, NET_TCP_SACK_OPT),
+					 "Missing SACK option");
+			zassert_true(data_len + opts_len <= SACK_SEG_LEN,
+				     "Segment of %zu bytes with %zu bytes of options exceeds MSS",
+				     data_len, opts_len);
+			zassert_equal(get_rel_seq(&th), 1U + sack_data_rcvd,
+				      "Unexpected sequence number");
+
+			sack_data_rcvd += data_len;
+			ack = device_initial_seq + 1U + sack_data_rcvd;
+			reply = prepare_ack_packet(AF_INET, htons(MY_PORT), sack_peer_port);
+
+			if (sack_data_rcvd == SACK_SEG_LEN * 2U) {
+				t_state = T_RST;
+				test_sem_give();
+			}
+			break;
+		}
+
+		zassert_equal(data_len, SACK_SEG_LEN, "Unexpected segment length %zu", data_len);
+
+		seg = (get_rel_seq(&th) - 1U) / SACK_SEG_LEN;
+		zassert_true(seg < SACK_SEG_COUNT, "Unexpected segment %u", seg);
+
+		if (sack_seg_sent & BIT(seg)) {
+			zassert_true(SACK_SEG_LOST & BIT(seg),
+				     "Received segment %u retransmitted", seg);
+			sack_seg_rexmit |= BIT(seg);
+		} else {
+			sack_seg_sent |= BIT(seg);
+
+			if (SACK_SEG_LOST & BIT(seg)) {
+				/* Lost, no ACK for it */
+				return;
+			}
+		}
+
+		sack_seg_rcvd |= BIT(seg);
+
+		reply = prepare_sack_ack_packet();
+		tester_options_len = 0U;
+
+		if (sack_seg_rcvd == BIT_MASK(SACK_SEG_COUNT)) {
+			t_state = T_RST;
+			test_sem_give();
+		}
+		break;
+	default:
+		zassert_true(false, "%s unexpected state", __func__);
+		return;
+	}
+
+	zassert_ok(net_recv_data(net_iface, reply), "%s failed", __func__);
+}
+
+/* Connect to the tester, which offers SACK and a small MSS */
+static struct net_context *sack_connect(enum test_case_no tc)
+{
+	struct net_context *ctx;
+
+	k_sem_reset(&test_sem);
+
+	t_state = T_SYN;
+	test_case_no = tc;
+	seq = ack = 0;
+
+	zassert_ok(net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx),
+		   "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	zassert_ok(net_context_connect(ctx, (struct sockaddr *)&peer_addr_s,
+				       sizeof(struct sockaddr_in), NULL,
+				       K_MSEC(100), NULL),
+		   "Failed to connect to peer");
+	zassert_ok(net_context_recv(ctx, test_tcp_recv_cb, K_NO_WAIT, NULL),
+		   "Failed to recv data from peer");
+
+	/* Peer will release the semaphore after it receives
+	 * proper ACK to SYN | ACK
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	return ctx;
+}
+
+/* Send data after a hole at base_seq, which is reported in a SACK block */
+static void sack_send_out_of_order(uint32_t base_seq)
+{
+	struct net_pkt *pkt;
+
+	seq = base_seq + 10U;
+	sack_expected_ack = base_seq;
+	sack_expected_start = base_seq + 10U;
+	sack_expected_end = base_seq + 20U;
+
+	pkt = prepare_data_packet(AF_INET, htons(MY_PORT), sack_peer_port,
+				  lorem_ipsum + 10, 10U);
+	zassert_not_null(pkt, "Cannot create pkt");
+	zassert_ok(net_recv_data(net_iface, pkt), "recv data failed");
+
+	test_sem_take(K_MSEC(100), __LINE__);
+}
+
+/* Test case scenario IPv4
+ *   expect SYN offering SACK,
+ *   send SYN ACK with SACK permitted,
+ *   expect ACK,
+ *   send out-of-order data,
+ *   expect duplicate ACK with a SACK block for it,
+ *   send the missing data,
+ *   expect ACK without SACK block,
+ *   expect data segments, drop two of them and SACK the others,
+ *   expect only the dropped segments to be retransmitted, without timeout,
+ *   send RST.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_client_sack_ipv4)
+{
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	uint32_t base_seq;
+	int ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_SACK);
+	/* The congestion window would only let the first segment through */
+	Z_TEST_SKIP_IFDEF(CONFIG_NET_TCP_CONGESTION_AVOIDANCE);
+
+	sack_seg_sent = 0U;
+	sack_seg_rcvd = 0U;
+	sack_seg_rexmit = 0U;
+
+	ctx = sack_connect(TEST_CLIENT_SACK_IPV4);
+
+	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT) {
+		base_seq = seq;
+		sack_send_out_of_order(base_seq);
+
+		/* Filling the hole acknowledges all the data */
+		seq = base_seq;
+		sack_expected_ack = base_seq + 20U;
+		sack_expected_start = sack_expected_end = 0U;
+
+		pkt = prepare_data_packet(AF_INET, htons(MY_PORT), sack_peer_port,
+					  lorem_ipsum, 10U);
+		zassert_not_null(pkt, "Cannot create pkt");
+		zassert_ok(net_recv_data(net_iface, pkt), "recv data failed");
+
+		test_sem_take(K_MSEC(100), __LINE__);
+
+		seq = base_seq + 20U;
+	}
+
+	t_state = T_DATA_ACK;
+
+	ret = net_context_send(ctx, lorem_ipsum, SACK_SEG_LEN * SACK_SEG_COUNT, NULL,
+			       K_NO_WAIT, NULL);
+	zassert_equal(ret, SACK_SEG_LEN * SACK_SEG_COUNT, "Failed to send data to peer (%d)",
+		      ret);
+
+	/* Peer will release the semaphore once it has received all the data,
+	 * which must not take a retransmission timeout.
+	 */
+	test_sem_take(K_MSEC(CONFIG_NET_TCP_INIT_RETRANSMISSION_TIMEOUT / 2), __LINE__);
+	zassert_equal(sack_seg_rexmit, SACK_SEG_LOST, "Unexpected retransmissions 0x%02x",
+		      sack_seg_rexmit);
+
+	/* Just send a RST packet to abort the underlying connection, so that
+	 * the testcase does not need to implement full TCP closing handshake.
+	 */
+	pkt = prepare_rst_packet(AF_INET, htons(MY_PORT), sack_peer_port);
+	zassert_not_null(pkt, "Cannot create pkt");
+	zassert_ok(net_recv_data(net_iface, pkt), "recv data failed");
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+}
+
+/* Test case scenario IPv4
+ *   expect SYN offering SACK,
+ *   send SYN ACK with SACK permitted and a small MSS,
+ *   expect ACK,
+ *   send out-of-order data,
+ *   expect duplicate ACK with a SACK block for it,
+ *   expect data segments carrying the SACK block, whose payload and
+ *   options together fit in the MSS,
+ *   send RST.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_client_sack_data_ipv4)
+{
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	uint32_t base_seq;
+	int ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_SACK);
+
+	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT == 0) {
+		ztest_test_skip();
+	}
+
+	sack_data_rcvd = 0U;
+
+	ctx = sack_connect(TEST_CLIENT_SACK_DATA_IPV4);
+
+	/* Keep the hole open while sending, so that every ACK of the device
+	 * carries a SACK block.
+	 */
+	base_seq = seq;
+	sack_send_out_of_order(base_seq);
+	seq = base_seq;
+
+	t_state = T_DATA_ACK;
+
+	ret = net_context_send(ctx, lorem_ipsum, SACK_SEG_LEN * 2U, NULL,
+			       K_NO_WAIT, NULL);
+	zassert_equal(ret, SACK_SEG_LEN * 2U, "Failed to send data to peer (%d)", ret);
+
+	/* Peer will release the semaphore once it has received all the data */
+	test_sem_take(K_MSEC(CONFIG_NET_TCP_INIT_RETRANSMISSION_TIMEOUT / 2), __LINE__);
+
+	pkt = prepare_rst_packet(AF_INET, htons(MY_PORT), sack_peer_port);
+	zassert_not_null(pkt, "Cannot create pkt");
+	zassert_ok(net_recv_data(net_iface, pkt), "recv data failed");
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+}
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
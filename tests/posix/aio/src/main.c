@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+
+#include <zephyr/posix/aio.h>
+#include <zephyr/posix/sys/eventfd.h>
+#include <zephyr/posix/unistd.h>
+#include <zephyr/ztest.h>
+
+#define NUM_EFDS 2
+
+static int efds[NUM_EFDS];
+static K_SEM_DEFINE(notify_sem, 0, 2);
+static int notify_val;
+static k_tid_t notify_thread;
+
+static void notify(union sigval val)
+{
+	notify_val = val.sival_int;
+	notify_thread = k_current_get();
+	k_sem_give(&notify_sem);
+}
+
+static void init_aiocb(struct aiocb *aiocbp, int fd, eventfd_t *val, int opcode)
+{
+	*aiocbp = (struct aiocb){
+		.aio_fildes = fd,
+		.aio_buf = val,
+		.aio_nbytes = sizeof(*val),
+		.aio_sigevent.sigev_notify = SIGEV_NONE,
+		.aio_lio_opcode = opcode,
+	};
+}
+
+static void wait_done(const struct aiocb *aiocbp)
+{
+	const struct aiocb *list[] = {aiocbp};
+
+	zassert_ok(aio_suspend(list, 1, NULL), "aio_suspend() failed: %d", errno);
+	zassert_not_equal(aio_error(aiocbp), EINPROGRESS);
+}
+
+ZTEST(aio, test_write_read)
+{
+	eventfd_t wval = 10;
+	eventfd_t rval = 0;
+	struct aiocb wcb;
+	struct aiocb rcb;
+
+	init_aiocb(&wcb, efds[0], &wval, LIO_WRITE);
+	zassert_ok(aio_write(&wcb), "aio_write() failed: %d", errno);
+	wait_done(&wcb);
+	zassert_ok(aio_error(&wcb));
+	zassert_equal(aio_return(&wcb), sizeof(wval));
+
+	init_aiocb(&rcb, efds[0], &rval, LIO_READ);
+	zassert_ok(aio_read(&rcb), "aio_read() failed: %d", errno);
+	wait_done(&rcb);
+	zassert_ok(aio_error(&rcb));
+	zassert_equal(aio_return(&rcb), sizeof(rval));
+	zassert_equal(rval, wval);
+}
+
+ZTEST(aio, test_suspend_cancel)
+{
+	const struct aiocb *list[1];
+	struct timespec timeout = {
+		.tv_nsec = 10 * NSEC_PER_MSEC,
+	};
+	eventfd_t rval = 0;
+	struct aiocb rcb;
+
+	/* Blocks until the eventfd is written */
+	init_aiocb(&rcb, efds[1], &rval, LIO_READ);
+	zassert_ok(aio_read(&rcb));
+	list[0] = &rcb;
+
+	zassert_equal(aio_suspend(list, 1, &timeout), -1);
+	zassert_equal(errno, EAGAIN);
+	zassert_equal(aio_error(&rcb), EINPROGRESS);
+	zassert_equal(aio_return(&rcb), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(aio_cancel(efds[1], &rcb), AIO_NOTCANCELED);
+	zassert_equal(aio_cancel(efds[1], NULL), AIO_NOTCANCELED);
+	zassert_equal(aio_cancel(efds[0], NULL), AIO_ALLDONE);
+
+	zassert_ok(eventfd_write(efds[1], 3));
+	wait_done(&rcb);
+	zassert_equal(aio_return(&rcb), sizeof(rval));
+	zassert_equal(rval, 3);
+
+	zassert_equal(aio_cancel(efds[1], &rcb), AIO_ALLDONE);
+}
+
+ZTEST(aio, test_sigev_thread)
+{
+	eventfd_t wval = 5;
+	struct aiocb wcb;
+
+	init_aiocb(&wcb, efds[0], &wval, LIO_WRITE);
+	wcb.aio_sigevent.sigev_notify = SIGEV_THREAD;
+	wcb.aio_sigevent.sigev_notify_function = notify;
+	wcb.aio_sigevent.sigev_value.sival_int = 42;
+
+	zassert_ok(aio_write(&wcb));
+	zassert_ok(k_sem_take(&notify_sem, K_MSEC(1000)));
+	zassert_equal(notify_val, 42);
+	zassert_not_equal(notify_thread, k_current_get());
+	zassert_ok(aio_error(&wcb));
+	zassert_equal(aio_return(&wcb), sizeof(wval));
+
+	/* Signals cannot be delivered */
+	wcb.aio_sigevent.sigev_notify = SIGEV_SIGNAL;
+	zassert_equal(aio_write(&wcb), -1);
+	zassert_equal(errno, EINVAL);
+}
+
+ZTEST(aio, test_lio_listio_wait)
+{
+	eventfd_t wvals[NUM_EFDS] = {1, 2};
+	struct aiocb cbs[NUM_EFDS + 1];
+	struct aiocb *list[NUM_EFDS + 1];
+	eventfd_t val;
+
+	for (int i = 0; i < NUM_EFDS; i++) {
+		init_aiocb(&cbs[i], efds[i], &wvals[i], LIO_WRITE);
+		list[i] = &cbs[i];
+	}
+
+	/* Ignored */
+	init_aiocb(&cbs[NUM_EFDS], -1, NULL, LIO_NOP);
+	list[NUM_EFDS] = &cbs[NUM_EFDS];
+
+	zassert_ok(lio_listio(LIO_WAIT, list, ARRAY_SIZE(list), NULL),
+		   "lio_listio() failed: %d", errno);
+
+	for (int i = 0; i < NUM_EFDS; i++) {
+		zassert_ok(aio_error(&cbs[i]));
+		zassert_ok(eventfd_read(efds[i], &val));
+		zassert_equal(val, wvals[i]);
+	}
+}
+
+ZTEST(aio, test_lio_listio_nowait)
+{
+	struct sigevent sig = {
+		.sigev_notify = SIGEV_THREAD,
+		.sigev_notify_function = notify,
+		.sigev_value.sival_int = 7,
+	};
+	eventfd_t wvals[NUM_EFDS] = {3, 4};
+	struct aiocb cbs[NUM_EFDS];
+	struct aiocb *list[NUM_EFDS];
+
+	for (int i = 0; i < NUM_EFDS; i++) {
+		init_aiocb(&cbs[i], efds[i], &wvals[i], LIO_WRITE);
+		list[i] = &cbs[i];
+	}
+
+	zassert_ok(lio_listio(LIO_NOWAIT, list, NUM_EFDS, &sig));
+	zassert_ok(k_sem_take(&notify_sem, K_MSEC(1000)));
+	zassert_equal(notify_val, 7);
+	zassert_not_equal(notify_thread, k_current_get());
+
+	for (int i = 0; i < NUM_EFDS; i++) {
+		zassert_ok(aio_error(&cbs[i]));
+		zassert_equal(aio_return(&cbs[i]), sizeof(eventfd_t));
+	}
+
+	/* Notified once for the whole list */
+	zassert_equal(k_sem_take(&notify_sem, K_MSEC(50)), -EAGAIN);
+
+	/* An empty list is complete at once, but not notified by the caller */
+	zassert_ok(lio_listio(LIO_NOWAIT, list, 0, &sig));
+	zassert_ok(k_sem_take(&notify_sem, K_MSEC(1000)));
+	zassert_not_equal(notify_thread, k_current_get());
+}
+
+ZTEST(aio, test_errors)
+{
+	struct aiocb *list[AIO_LISTIO_MAX + 1];
+	eventfd_t val = 1;
+	struct aiocb cb;
+
+	init_aiocb(&cb, -1, &val, LIO_WRITE);
+	zassert_ok(aio_write(&cb));
+	wait_done(&cb);
+	zassert_equal(aio_error(&cb), EBADF);
+	zassert_equal(aio_return(&cb), -1);
+
+	list[0] = &cb;
+	zassert_equal(lio_listio(LIO_WAIT, list, 1, NULL), -1);
+	zassert_equal(errno, EIO);
+	zassert_equal(aio_error(&cb), EBADF);
+
+	init_aiocb(&cb, efds[0], &val, LIO_WRITE);
+	cb.aio_offset = -1;
+	zassert_equal(aio_write(&cb), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(lio_listio(-1, list, 1, NULL), -1);
+	zassert_equal(errno, EINVAL);
+
+	for (int i = 0; i < ARRAY_SIZE(list); i++) {
+		list[i] = NULL;
+	}
+	zassert_equal(lio_listio(LIO_WAIT, list, ARRAY_SIZE(list), NULL), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(aio_read(NULL), -1);
+	zassert_equal(errno, EINVAL);
+}
+
+static void before(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	for (int i = 0; i < NUM_EFDS; i++) {
+		efds[i] = eventfd(0, 0);
+		zassert_true(efds[i] >= 0, "eventfd() failed: %d", errno);
+	}
+
+	k_sem_reset(&notify_sem);
+}
+
+static void after(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	for (int i = 0; i < NUM_EFDS; i++) {
+		close(efds[i]);
+	}
+}
+
+ZTEST_SUITE(aio, NULL, NULL, before, after, NULL);
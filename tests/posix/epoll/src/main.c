@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/net/socket.h>
+#include <zephyr/posix/sys/epoll.h>
+#include <zephyr/posix/sys/eventfd.h>
+#include <zephyr/posix/unistd.h>
+#include <zephyr/ztest.h>
+
+#define NUM_EFDS 8
+#define TESTVAL  10
+
+static int epfd = -1;
+static int efds[NUM_EFDS];
+
+static struct k_thread thread;
+static K_THREAD_STACK_DEFINE(thread_stack, 1024 + CONFIG_TEST_EXTRA_STACK_SIZE);
+
+static void add(int fd, uint32_t events)
+{
+	struct epoll_event ev = {
+		.events = events,
+		.data.fd = fd,
+	};
+
+	zassert_ok(epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev), "epoll_ctl() failed: %d", errno);
+}
+
+static int wait_events(struct epoll_event *events, int maxevents, int timeout)
+{
+	int ret = epoll_wait(epfd, events, maxevents, timeout);
+
+	zassert_true(ret >= 0, "epoll_wait() failed: %d", errno);
+
+	return ret;
+}
+
+static void drain(int fd)
+{
+	eventfd_t val;
+
+	zassert_ok(eventfd_read(fd, &val));
+}
+
+ZTEST(epoll, test_level_triggered)
+{
+	struct epoll_event ev;
+
+	add(efds[0], EPOLLIN);
+
+	zassert_equal(wait_events(&ev, 1, 0), 0);
+
+	zassert_ok(eventfd_write(efds[0], TESTVAL));
+	zassert_equal(wait_events(&ev, 1, 0), 1);
+	zassert_equal(ev.events, EPOLLIN);
+	zassert_equal(ev.data.fd, efds[0]);
+
+	/* Reported for as long as it is readable */
+	zassert_equal(wait_events(&ev, 1, 0), 1);
+	zassert_equal(ev.data.fd, efds[0]);
+
+	drain(efds[0]);
+	zassert_equal(wait_events(&ev, 1, 0), 0);
+}
+
+ZTEST(epoll, test_edge_triggered)
+{
+	struct epoll_event ev;
+
+	add(efds[0], EPOLLIN | EPOLLET);
+
+	zassert_ok(eventfd_write(efds[0], TESTVAL));
+	zassert_equal(wait_events(&ev, 1, 0), 1);
+	zassert_equal(ev.events, EPOLLIN);
+
+	/* Still readable, but nothing new happened */
+	zassert_equal(wait_events(&ev, 1, 0), 0);
+
+	zassert_ok(eventfd_write(efds[0], TESTVAL));
+	zassert_equal(wait_events(&ev, 1, 0), 1);
+	zassert_equal(ev.data.fd, efds[0]);
+}
+
+ZTEST(epoll, test_oneshot)
+{
+	struct epoll_event ev = {
+		.events = EPOLLIN | EPOLLONESHOT,
+		.data.u32 = 0x1234,
+	};
+
+	zassert_ok(epoll_ctl(epfd, EPOLL_CTL_ADD, efds[0], &ev));
+
+	zassert_ok(eventfd_write(efds[0], TESTVAL));
+	zassert_equal(wait_events(&ev, 1, 0), 1);
+	zassert_equal(ev.data.u32, 0x1234);
+
+	zassert_ok(eventfd_write(efds[0], TESTVAL));
+	zassert_equal(wait_events(&ev, 1, 0), 0);
+
+	/* Enabled again by a modification */
+	ev.events = EPOLLIN | EPOLLONESHOT;
+	ev.data.u32 = 0x5678;
+	zassert_ok(epoll_ctl(epfd, EPOLL_CTL_MOD, efds[0], &ev));
+	zassert_equal(wait_events(&ev, 1, 0), 1);
+	zassert_equal(ev.data.u32, 0x5678);
+}
+
+ZTEST(epoll, test_ready_only)
+{
+	struct epoll_event events[NUM_EFDS];
+	bool seen[NUM_EFDS] = {0};
+
+	for (int i = 0; i < NUM_EFDS; i++) {
+		add(efds[i], EPOLLIN);
+	}
+
+	zassert_ok(eventfd_write(efds[2], TESTVAL));
+	zassert_ok(eventfd_write(efds[5], TESTVAL));
+
+	zassert_equal(wait_events(events, NUM_EFDS, 0), 2);
+	for (int i = 0; i < 2; i++) {
+		for (int j = 0; j < NUM_EFDS; j++) {
+			if (events[i].data.fd == efds[j]) {
+				seen[j] = true;
+			}
+		}
+	}
+	zassert_true(seen[2] && seen[5]);
+
+	/* Not more than asked for */
+	zassert_equal(wait_events(events, 1, 0), 1);
+}
+
+ZTEST(epoll, test_pollout)
+{
+	struct epoll_event ev;
+
+	add(efds[0], EPOLLIN | EPOLLOUT);
+
+	zassert_equal(wait_events(&ev, 1, 0), 1);
+	zassert_equal(ev.events, EPOLLOUT);
+
+	zassert_ok(eventfd_write(efds[0], TESTVAL));
+	zassert_equal(wait_events(&ev, 1, 0), 1);
+	zassert_equal(ev.events, EPOLLIN | EPOLLOUT);
+}
+
+static void write_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zassert_ok(eventfd_write(POINTER_TO_INT(p1), TESTVAL));
+}
+
+ZTEST(epoll, test_wait_blocking)
+{
+	struct epoll_event ev;
+
+	add(efds[3], EPOLLIN);
+
+	zassert_equal(wait_events(&ev, 1, 50), 0);
+
+	k_thread_create(&thread, thread_stack, K_THREAD_STACK_SIZEOF(thread_stack),
+			write_entry, INT_TO_POINTER(efds[3]), NULL, NULL, 0, 0, K_MSEC(100));
+
+	zassert_equal(wait_events(&ev, 1, -1), 1);
+	zassert_equal(ev.data.fd, efds[3]);
+
+	zassert_ok(k_thread_join(&thread, K_FOREVER));
+}
+
+ZTEST(epoll, test_socketpair)
+{
+	struct epoll_event ev;
+	int sv[2];
+
+	zassert_ok(zsock_socketpair(AF_UNIX, SOCK_STREAM, 0, sv));
+
+	add(sv[0], EPOLLIN);
+	zassert_equal(wait_events(&ev, 1, 0), 0);
+
+	zassert_equal(zsock_send(sv[1], "x", 1, 0), 1);
+	zassert_equal(wait_events(&ev, 1, 100), 1);
+	zassert_equal(ev.events, EPOLLIN);
+	zassert_equal(ev.data.fd, sv[0]);
+
+	/* Closing a descriptor removes it */
+	zassert_ok(zsock_close(sv[0]));
+	zassert_equal(wait_events(&ev, 1, 0), 0);
+	zassert_ok(zsock_close(sv[1]));
+}
+
+ZTEST(epoll, test_close_removes)
+{
+	struct epoll_event ev;
+
+	add(efds[0], EPOLLIN | EPOLLET);
+	zassert_ok(eventfd_write(efds[0], TESTVAL));
+
+	/* A descriptor reusing the number is not watched */
+	zassert_ok(close(efds[0]));
+	efds[0] = eventfd(0, EFD_NONBLOCK);
+	zassert_true(efds[0] >= 0, "eventfd() failed: %d", errno);
+	zassert_ok(eventfd_write(efds[0], TESTVAL));
+	zassert_equal(wait_events(&ev, 1, 0), 0);
+
+	add(efds[0], EPOLLIN);
+	zassert_equal(wait_events(&ev, 1, 0), 1);
+	zassert_equal(ev.data.fd, efds[0]);
+}
+
+ZTEST(epoll, test_ctl_errors)
+{
+	struct epoll_event ev = {
+		.events = EPOLLIN,
+	};
+	int epfd2;
+
+	add(efds[0], EPOLLIN);
+
+	zassert_equal(epoll_ctl(epfd, EPOLL_CTL_ADD, efds[0], &ev), -1);
+	zassert_equal(errno, EEXIST);
+
+	zassert_equal(epoll_ctl(epfd, EPOLL_CTL_MOD, efds[1], &ev), -1);
+	zassert_equal(errno, ENOENT);
+
+	zassert_equal(epoll_ctl(epfd, EPOLL_CTL_DEL, efds[1], NULL), -1);
+	zassert_equal(errno, ENOENT);
+
+	zassert_equal(epoll_ctl(epfd, EPOLL_CTL_ADD, epfd, &ev), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(epoll_ctl(efds[1], EPOLL_CTL_ADD, efds[0], &ev), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(epoll_ctl(epfd, EPOLL_CTL_ADD, -1, &ev), -1);
+	zassert_equal(errno, EBADF);
+
+	zassert_equal(epoll_wait(epfd, &ev, 0, 0), -1);
+	zassert_equal(errno, EINVAL);
+
+	/* An epoll instance cannot be watched */
+	epfd2 = epoll_create1(0);
+	zassert_true(epfd2 >= 0);
+	zassert_equal(epoll_ctl(epfd2, EPOLL_CTL_ADD, epfd, &ev), -1);
+	zassert_equal(errno, EPERM);
+	zassert_ok(close(epfd2));
+
+	zassert_ok(epoll_ctl(epfd, EPOLL_CTL_DEL, efds[0], NULL));
+	zassert_ok(eventfd_write(efds[0], TESTVAL));
+	zassert_equal(wait_events(&ev, 1, 0), 0);
+}
+
+static void before(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	epfd = epoll_create1(0);
+	zassert_true(epfd >= 0, "epoll_create1() failed: %d", errno);
+
+	for (int i = 0; i < NUM_EFDS; i++) {
+		efds[i] = eventfd(0, EFD_NONBLOCK);
+		zassert_true(efds[i] >= 0, "eventfd() failed: %d", errno);
+	}
+}
+
+static void after(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	close(epfd);
+	for (int i = 0; i < NUM_EFDS; i++) {
+		close(efds[i]);
+	}
+}
+
+ZTEST_SUITE(epoll, NULL, NULL, before, after, NULL);
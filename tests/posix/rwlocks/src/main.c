@@ -119,6 +119,29 @@ ZTEST(posix_rw_locks, test_rw_lock)
 	zassert_ok(pthread_rwlock_destroy(&rwlock), "Failed to destroy rwlock");
 }
 
+ZTEST(posix_rw_locks, test_rw_lock_deadlock)
+{
+	zassert_ok(pthread_rwlock_init(&rwlock, NULL));
+
+	zassert_ok(pthread_rwlock_wrlock(&rwlock));
+	zassert_equal(pthread_rwlock_rdlock(&rwlock), EDEADLK);
+	zassert_equal(pthread_rwlock_wrlock(&rwlock), EDEADLK);
+	zassert_equal(pthread_rwlock_destroy(&rwlock), EBUSY);
+	zassert_ok(pthread_rwlock_unlock(&rwlock));
+
+	zassert_ok(pthread_rwlock_rdlock(&rwlock));
+	zassert_ok(pthread_rwlock_rdlock(&rwlock));
+	zassert_equal(pthread_rwlock_trywrlock(&rwlock), EBUSY);
+	zassert_equal(pthread_rwlock_destroy(&rwlock), EBUSY);
+	zassert_ok(pthread_rwlock_unlock(&rwlock));
+	zassert_ok(pthread_rwlock_unlock(&rwlock));
+	zassert_equal(pthread_rwlock_unlock(&rwlock), EPERM);
+	zassert_ok(pthread_rwlock_trywrlock(&rwlock));
+	zassert_ok(pthread_rwlock_unlock(&rwlock));
+
+	zassert_ok(pthread_rwlock_destroy(&rwlock));
+}
+
 static void test_pthread_rwlockattr_pshared_common(bool set, int pshared)
 {
 	int tmp_pshared = 4242;
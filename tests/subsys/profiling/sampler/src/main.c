@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/profiling/sampler.h>
+
+#define SAMPLE_FREQUENCY 100
+#define BUSY_TIME_US     (200 * USEC_PER_MSEC)
+
+/* Deeper than CONFIG_PROFILING_SAMPLER_STACK_DEPTH on its own */
+#define CALL_DEPTH (2 * CONFIG_PROFILING_SAMPLER_STACK_DEPTH)
+
+/* Written by the RAM tracing backend */
+extern uint8_t ram_tracing[CONFIG_RAM_TRACING_BUFFER_SIZE];
+
+struct sample_stats {
+	size_t samples;
+	size_t truncated;
+};
+
+/*
+ * On native_sim interrupts are only taken while busy waiting, so the samples
+ * are taken in the busy wait below CALL_DEPTH frames of this function.
+ */
+static void __noinline busy_wait_deep(int depth)
+{
+	if (depth == 0) {
+		k_busy_wait(BUSY_TIME_US);
+	} else {
+		busy_wait_deep(depth - 1);
+	}
+
+	/* Not a tail call, so that the frame is kept */
+	compiler_barrier();
+}
+
+/* Parse the "sample <thread> <address>... [...]" lines of the trace */
+static void check_samples(struct sample_stats *stats)
+{
+	const char *line = (const char *)ram_tracing;
+	const char *end = line + sizeof(ram_tracing);
+
+	memset(stats, 0, sizeof(*stats));
+
+	while (line < end && *line != '\0') {
+		const char *eol = memchr(line, '\n', end - line);
+		size_t addrs = 0;
+		bool truncated = false;
+		const char *p;
+		char *next;
+
+		zassert_not_null(eol, "unterminated line");
+
+		if (strncmp(line, "sample ", strlen("sample ")) != 0) {
+			line = eol + 1;
+			continue;
+		}
+
+		p = line + strlen("sample ");
+		zassert_equal(strtoul(p, &next, 16), (unsigned long)(uintptr_t)k_current_get(),
+			      "sample of another thread");
+		p = next;
+
+		while (p < eol) {
+			if (strncmp(p, " ...", strlen(" ...")) == 0) {
+				truncated = true;
+				p += strlen(" ...");
+				break;
+			}
+			zassert_not_equal(strtoul(p, &next, 16), 0, "null return address");
+			zassert_true(next > p, "malformed sample");
+			p = next;
+			addrs++;
+		}
+
+		zassert_equal(p, eol, "trailing data after the call stack");
+		zassert_true(addrs > 0, "sample without a call stack");
+		zassert_true(addrs <= CONFIG_PROFILING_SAMPLER_STACK_DEPTH,
+			     "call stack deeper than the maximum");
+		if (truncated) {
+			zassert_equal(addrs, CONFIG_PROFILING_SAMPLER_STACK_DEPTH,
+				      "truncated call stack not at the maximum depth");
+			stats->truncated++;
+		}
+
+		stats->samples++;
+		line = eol + 1;
+	}
+}
+
+ZTEST(profiling_sampler, test_sample_deep_stack)
+{
+	struct sample_stats stats;
+
+	zassert_ok(profiling_sampler_start(SAMPLE_FREQUENCY));
+	zassert_equal(profiling_sampler_start(SAMPLE_FREQUENCY), -EALREADY);
+
+	busy_wait_deep(CALL_DEPTH);
+
+	/* Flushes the buffered samples */
+	zassert_ok(profiling_sampler_stop());
+	zassert_equal(profiling_sampler_stop(), -EALREADY);
+
+	check_samples(&stats);
+
+	zassert_true(stats.samples > 0, "no sample written");
+	zassert_equal(stats.truncated, stats.samples, "deep call stack not truncated");
+}
+
+ZTEST(profiling_sampler, test_start_invalid)
+{
+	zassert_equal(profiling_sampler_start(0), -EINVAL);
+}
+
+ZTEST_SUITE(profiling_sampler, NULL, NULL, NULL, NULL, NULL);